@@ -43,6 +43,10 @@ export interface Spec {
   +appendChild: (parentNode: Node, child: Node) => Node;
   +appendChildToSet: (childSet: NodeSet, child: Node) => void;
   +completeRoot: (rootTag: RootTag, childSet: NodeSet) => void;
+  +executeCommandBuffer: (
+    commands: ArrayBuffer,
+    values: $ReadOnlyArray<mixed>,
+  ) => $ReadOnlyArray<?Node>;
   +measure: (
     node: Node | NativeElementReference,
     callback: MeasureOnSuccessCallback,
@@ -114,6 +118,7 @@ const CACHED_PROPERTIES = [
   'appendChild',
   'appendChildToSet',
   'completeRoot',
+  'executeCommandBuffer',
   'measure',
   'measureInWindow',
   'measureLayout',
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict-local
+ * @format
+ */
+
+'use strict';
+
+import type {
+  InternalInstanceHandle,
+  Node,
+} from '../Renderer/shims/ReactNativeTypes';
+import type {RootTag} from '../Types/RootTagTypes';
+import type {NodeProps, Spec} from './FabricUIManager';
+
+// Keep in sync with `UIManagerCommand` in
+// ReactCommon/react/renderer/uimanager/UIManagerCommandBuffer.h.
+export const UIManagerCommand = {
+  LoadNode: 0,
+  CreateNode: 1,
+  CloneNodeWithNewChildren: 2,
+  CloneNodeWithNewProps: 3,
+  CloneNodeWithNewChildrenAndProps: 4,
+  AppendChild: 5,
+  CreateChildSet: 6,
+  AppendChildToSet: 7,
+  CompleteRoot: 8,
+};
+
+// Registers holding nodes and child sets produced by the commands.
+export opaque type NodeRegister = number;
+export opaque type ChildSetRegister = number;
+
+const NO_CHILD_SET = -1;
+const INITIAL_CAPACITY = 256;
+
+function getSurfaceId(rootTag: RootTag): number {
+  // $FlowExpectedError[incompatible-type] RootTag is an opaque number.
+  return rootTag;
+}
+
+/**
+ * Records calls to the node manipulation methods of `nativeFabricUIManager`
+ * and sends them to native in a single `executeCommandBuffer` call.
+ *
+ * Nodes and child sets produced by the recorded commands are referred to by
+ * register. The nodes are available after `execute`, through `getNode`.
+ */
+export default class FabricUIManagerCommandBuffer {
+  _commands: Int32Array = new Int32Array(INITIAL_CAPACITY);
+  _commandsLength: number = 0;
+  _values: Array<mixed> = [];
+  _nodeRegisterCount: number = 0;
+  _childSetRegisterCount: number = 0;
+  _loadedNodes: Array<?Node> = [];
+  _nodes: ?$ReadOnlyArray<?Node> = null;
+
+  loadNode(node: Node): NodeRegister {
+    this._push1(UIManagerCommand.LoadNode, this._addValue(node));
+    this._loadedNodes[this._nodeRegisterCount] = node;
+    return this._nodeRegisterCount++;
+  }
+
+  createNode(
+    reactTag: number,
+    viewName: string,
+    rootTag: RootTag,
+    props: NodeProps,
+    instanceHandle: InternalInstanceHandle,
+  ): NodeRegister {
+    this._ensureCapacity(6);
+    const commands = this._commands;
+    let length = this._commandsLength;
+    commands[length++] = UIManagerCommand.CreateNode;
+    commands[length++] = reactTag;
+    commands[length++] = this._addValue(viewName);
+    commands[length++] = getSurfaceId(rootTag);
+    commands[length++] = this._addValue(props);
+    commands[length++] = this._addValue(instanceHandle);
+    this._commandsLength = length;
+    return this._nodeRegisterCount++;
+  }
+
+  cloneNodeWithNewChildren(
+    node: NodeRegister,
+    childSet: ?ChildSetRegister,
+  ): NodeRegister {
+    this._push2(
+      UIManagerCommand.CloneNodeWithNewChildren,
+      node,
+      childSet ?? NO_CHILD_SET,
+    );
+    return this._nodeRegisterCount++;
+  }
+
+  cloneNodeWithNewProps(node: NodeRegister, newProps: NodeProps): NodeRegister {
+    this._push2(
+      UIManagerCommand.CloneNodeWithNewProps,
+      node,
+      this._addValue(newProps),
+    );
+    return this._nodeRegisterCount++;
+  }
+
+  cloneNodeWithNewChildrenAndProps(
+    node: NodeRegister,
+    childSet: ?ChildSetRegister,
+    newProps: NodeProps,
+  ): NodeRegister {
+    this._ensureCapacity(4);
+    const commands = this._commands;
+    let length = this._commandsLength;
+    commands[length++] = UIManagerCommand.CloneNodeWithNewChildrenAndProps;
+    commands[length++] = node;
+    commands[length++] = childSet ?? NO_CHILD_SET;
+    commands[length++] = this._addValue(newProps);
+    this._commandsLength = length;
+    return this._nodeRegisterCount++;
+  }
+
+  appendChild(parentNode: NodeRegister, child: NodeRegister): void {
+    this._push2(UIManagerCommand.AppendChild, parentNode, child);
+  }
+
+  createChildSet(): ChildSetRegister {
+    this._ensureCapacity(1);
+    this._commands[this._commandsLength++] = UIManagerCommand.CreateChildSet;
+    return this._childSetRegisterCount++;
+  }
+
+  appendChildToSet(childSet: ChildSetRegister, child: NodeRegister): void {
+    this._push2(UIManagerCommand.AppendChildToSet, childSet, child);
+  }
+
+  completeRoot(rootTag: RootTag, childSet: ChildSetRegister): void {
+    this._push2(UIManagerCommand.CompleteRoot, getSurfaceId(rootTag), childSet);
+  }
+
+  /**
+   * Returns the recorded commands, as expected by `executeCommandBuffer`.
+   */
+  getCommands(): ArrayBuffer {
+    return this._commands.buffer.slice(0, this._commandsLength * 4);
+  }
+
+  getValues(): $ReadOnlyArray<mixed> {
+    return this._values;
+  }
+
+  /**
+   * Executes the recorded commands. Throws if native rejects the buffer.
+   * A malformed buffer is rejected before any command runs, but an error
+   * raised by a command itself (e.g. an invalid value passed to it) leaves
+   * the commands before it applied.
+   */
+  execute(fabricUIManager: Spec): void {
+    this._nodes = fabricUIManager.executeCommandBuffer(
+      this.getCommands(),
+      this._values,
+    );
+  }
+
+  /**
+   * Returns the node stored in the given register by `execute`.
+   */
+  getNode(register: NodeRegister): Node {
+    const node = this._nodes?.[register] ?? this._loadedNodes[register];
+    if (node == null) {
+      throw new Error(
+        `Node register ${register} is not available. Was the buffer executed?`,
+      );
+    }
+    return node;
+  }
+
+  _addValue(value: mixed): number {
+    return this._values.push(value) - 1;
+  }
+
+  _push1(command: number, operand: number): void {
+    this._ensureCapacity(2);
+    const commands = this._commands;
+    commands[this._commandsLength++] = command;
+    commands[this._commandsLength++] = operand;
+  }
+
+  _push2(command: number, operand0: number, operand1: number): void {
+    this._ensureCapacity(3);
+    const commands = this._commands;
+    commands[this._commandsLength++] = command;
+    commands[this._commandsLength++] = operand0;
+    commands[this._commandsLength++] = operand1;
+  }
+
+  _ensureCapacity(wordCount: number): void {
+    const requiredLength = this._commandsLength + wordCount;
+    if (requiredLength <= this._commands.length) {
+      return;
+    }
+    const commands = new Int32Array(
+      Math.max(requiredLength, this._commands.length * 2),
+    );
+    commands.set(this._commands.subarray(0, this._commandsLength));
+    this._commands = commands;
+  }
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict-local
+ * @format
+ */
+
+import type {Node} from '../../Renderer/shims/ReactNativeTypes';
+import type {Spec} from '../FabricUIManager';
+
+import {createRootTag} from '../RootTag';
+
+const FabricUIManagerCommandBuffer =
+  require('../FabricUIManagerCommandBuffer').default;
+const {UIManagerCommand} = require('../FabricUIManagerCommandBuffer');
+
+function createNode(): Node {
+  // $FlowExpectedError[incompatible-return]
+  return {};
+}
+
+describe('FabricUIManagerCommandBuffer', () => {
+  it('encodes commands and values', () => {
+    const commandBuffer = new FabricUIManagerCommandBuffer();
+    const rootTag = createRootTag(1);
+    const props = {nativeID: 'view'};
+    const newProps = {nativeID: 'root'};
+    const instanceHandle = {};
+    const existingNode = createNode();
+
+    const node = commandBuffer.createNode(
+      11,
+      'View',
+      rootTag,
+      props,
+      instanceHandle,
+    );
+    const loadedNode = commandBuffer.loadNode(existingNode);
+    const clonedNode = commandBuffer.cloneNodeWithNewProps(
+      loadedNode,
+      newProps,
+    );
+    commandBuffer.appendChild(clonedNode, node);
+    const childSet = commandBuffer.createChildSet();
+    commandBuffer.appendChildToSet(childSet, clonedNode);
+    commandBuffer.completeRoot(rootTag, childSet);
+
+    expect(Array.from(new Int32Array(commandBuffer.getCommands()))).toEqual([
+      ...[UIManagerCommand.CreateNode, 11, 0, 1, 1, 2],
+      ...[UIManagerCommand.LoadNode, 3],
+      ...[UIManagerCommand.CloneNodeWithNewProps, 1, 4],
+      ...[UIManagerCommand.AppendChild, 2, 0],
+      ...[UIManagerCommand.CreateChildSet],
+      ...[UIManagerCommand.AppendChildToSet, 0, 2],
+      ...[UIManagerCommand.CompleteRoot, 1, 0],
+    ]);
+    expect(commandBuffer.getValues()).toEqual([
+      'View',
+      props,
+      instanceHandle,
+      existingNode,
+      newProps,
+    ]);
+  });
+
+  it('encodes clones without children', () => {
+    const commandBuffer = new FabricUIManagerCommandBuffer();
+    const node = commandBuffer.loadNode(createNode());
+    commandBuffer.cloneNodeWithNewChildren(node);
+    commandBuffer.cloneNodeWithNewChildrenAndProps(node, null, {});
+
+    expect(Array.from(new Int32Array(commandBuffer.getCommands()))).toEqual([
+      ...[UIManagerCommand.LoadNode, 0],
+      ...[UIManagerCommand.CloneNodeWithNewChildren, 0, -1],
+      ...[UIManagerCommand.CloneNodeWithNewChildrenAndProps, 0, -1, 1],
+    ]);
+  });
+
+  it('grows the buffer', () => {
+    const commandBuffer = new FabricUIManagerCommandBuffer();
+    for (let i = 0; i < 1000; i++) {
+      commandBuffer.createChildSet();
+    }
+
+    const commands = new Int32Array(commandBuffer.getCommands());
+    expect(commands.length).toBe(1000);
+    expect(commands.every(command => command === 6)).toBe(true);
+  });
+
+  it('executes the commands in a single call', () => {
+    const existingNode = createNode();
+    const clonedNode = createNode();
+    const executeCommandBuffer = jest.fn(() => [undefined, clonedNode]);
+    // $FlowExpectedError[incompatible-type]
+    const fabricUIManager: Spec = {executeCommandBuffer};
+
+    const commandBuffer = new FabricUIManagerCommandBuffer();
+    const loadedNode = commandBuffer.loadNode(existingNode);
+    const newNode = commandBuffer.cloneNodeWithNewProps(loadedNode, {});
+
+    expect(() => commandBuffer.getNode(newNode)).toThrow();
+
+    commandBuffer.execute(fabricUIManager);
+
+    expect(executeCommandBuffer).toHaveBeenCalledTimes(1);
+    expect(executeCommandBuffer).toHaveBeenCalledWith(
+      commandBuffer.getCommands(),
+      commandBuffer.getValues(),
+    );
+    expect(commandBuffer.getNode(loadedNode)).toBe(existingNode);
+    expect(commandBuffer.getNode(newNode)).toBe(clonedNode);
+  });
+});
@@ -8,6 +8,7 @@
 #include "AppleEventBeat.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 
 namespace facebook::react {
 
@@ -17,6 +18,14 @@ AppleEventBeat::AppleEventBeat(
     RuntimeScheduler& runtimeScheduler)
     : EventBeat(std::move(ownerBox), runtimeScheduler),
       uiRunLoopObserver_(std::move(uiRunLoopObserver)) {
+  if (ReactNativeFeatureFlags::enableFrameDeadlineScheduling()) {
+    displayLinkObserver_ = std::make_unique<MainDisplayLinkObserver>(
+        ownerBox_->owner,
+        [this](HighResTimeStamp frameDeadline, HighResDuration frameInterval) {
+          setFrameDeadline(frameDeadline, frameInterval);
+        });
+  }
+
   uiRunLoopObserver_->setDelegate(this);
   uiRunLoopObserver_->enable();
 }
@@ -25,6 +34,11 @@ void AppleEventBeat::activityDidChange(
     const RunLoopObserver::Delegate* delegate,
     RunLoopObserver::Activity /*activity*/) const noexcept {
   react_native_assert(delegate == this);
+  if (displayLinkObserver_ && isEventBeatRequested_) {
+    // Samples the timing of the upcoming frame only while there is work to
+    // do; `RuntimeScheduler` extrapolates it to later frames.
+    displayLinkObserver_->requestFrame();
+  }
   induce();
 }
 
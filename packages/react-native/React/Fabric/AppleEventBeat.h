@@ -11,6 +11,8 @@
 #include <react/renderer/core/EventBeat.h>
 #include <react/utils/RunLoopObserver.h>
 
+#include "MainDisplayLinkObserver.h"
+
 namespace facebook::react {
 
 class RuntimeScheduler;
@@ -18,7 +20,8 @@ class RuntimeScheduler;
 /*
  * Event beat associated with JavaScript runtime.
  * The beat is called on `RuntimeExecutor`'s thread induced by the UI thread
- * event loop.
+ * event loop. With `enableFrameDeadlineScheduling`, the timing of the next
+ * frame is sampled from the display link whenever a beat is requested.
  */
 class AppleEventBeat : public EventBeat, public RunLoopObserver::Delegate {
  public:
@@ -34,6 +37,7 @@ class AppleEventBeat : public EventBeat, public RunLoopObserver::Delegate {
 
  private:
   std::unique_ptr<const RunLoopObserver> uiRunLoopObserver_;
+  std::unique_ptr<MainDisplayLinkObserver> displayLinkObserver_;
 };
 
 } // namespace facebook::react
@@ -23,6 +23,7 @@
 #import <React/RCTUtils.h>
 #import <react/renderer/core/ReactRootViewTagGenerator.h>
 #import <react/renderer/mounting/MountingCoordinator.h>
+#import <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #import <react/utils/FollyConvert.h>
 
 #import "RCTSurfacePresenter.h"
@@ -271,6 +272,14 @@ using namespace facebook::react;
 
 - (void)handleContentSizeCategoryDidChangeNotification:(NSNotification *)notification
 {
+  // Measurements persisted for the previous font scale must not be reused.
+  auto persistentTextMeasureCache =
+      _surfacePresenter.contextContainer->find<std::shared_ptr<PersistentTextMeasureCache>>(
+          PersistentTextMeasureCache::ContextContainerKey);
+  if (persistentTextMeasureCache.has_value()) {
+    (*persistentTextMeasureCache)->setFontScale(RCTFontSizeMultiplier());
+  }
+
   [self _updateLayoutContext];
 }
 
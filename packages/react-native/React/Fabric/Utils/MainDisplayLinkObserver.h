@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <react/timing/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * Reports the timing of the next frame of the main display, using
+ * `CADisplayLink` under the hood.
+ * The display link only runs between a call to `requestFrame` and the next
+ * frame, so observing the frame timing doesn't keep the app awake.
+ * The callback is called on the main thread, only while `owner` is alive.
+ */
+class MainDisplayLinkObserver final {
+ public:
+  using Callback = std::function<void(HighResTimeStamp frameDeadline, HighResDuration frameInterval)>;
+
+  MainDisplayLinkObserver(std::weak_ptr<const void> owner, Callback callback);
+
+  ~MainDisplayLinkObserver();
+
+  /*
+   * Requests the timing of the next frame to be reported.
+   * Must be called on the main thread.
+   */
+  void requestFrame() const noexcept;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#import "MainDisplayLinkObserver.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+using namespace facebook::react;
+
+@interface RCTMainDisplayLinkTarget : NSObject
+
+- (instancetype)initWithOwner:(std::weak_ptr<const void>)owner callback:(MainDisplayLinkObserver::Callback)callback;
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink;
+
+@end
+
+@implementation RCTMainDisplayLinkTarget {
+  std::weak_ptr<const void> _owner;
+  MainDisplayLinkObserver::Callback _callback;
+}
+
+- (instancetype)initWithOwner:(std::weak_ptr<const void>)owner callback:(MainDisplayLinkObserver::Callback)callback
+{
+  if (self = [super init]) {
+    _owner = std::move(owner);
+    _callback = std::move(callback);
+  }
+  return self;
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink
+{
+  displayLink.paused = YES;
+
+  auto strongOwner = _owner.lock();
+  if (!strongOwner) {
+    return;
+  }
+
+  // `CADisplayLink` timestamps are based on `CACurrentMediaTime`, which is
+  // not guaranteed to share its base with `std::chrono::steady_clock`.
+  auto now = HighResTimeStamp::now();
+  auto mediaTime = CACurrentMediaTime();
+  auto frameDeadline = now + HighResDuration::fromDOMHighResTimeStamp((displayLink.targetTimestamp - mediaTime) * 1000);
+  auto frameInterval =
+      HighResDuration::fromDOMHighResTimeStamp((displayLink.targetTimestamp - displayLink.timestamp) * 1000);
+
+  _callback(frameDeadline, frameInterval);
+}
+
+@end
+
+namespace facebook::react {
+
+struct MainDisplayLinkObserver::Impl {
+  CADisplayLink *displayLink;
+};
+
+MainDisplayLinkObserver::MainDisplayLinkObserver(std::weak_ptr<const void> owner, Callback callback)
+    : impl_(std::make_unique<Impl>())
+{
+  auto target = [[RCTMainDisplayLinkTarget alloc] initWithOwner:std::move(owner) callback:std::move(callback)];
+  // The display link retains its target until it's invalidated.
+  impl_->displayLink = [CADisplayLink displayLinkWithTarget:target selector:@selector(displayLinkDidFire:)];
+  impl_->displayLink.paused = YES;
+  [impl_->displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+MainDisplayLinkObserver::~MainDisplayLinkObserver()
+{
+  CADisplayLink *displayLink = impl_->displayLink;
+  if ([NSThread isMainThread]) {
+    [displayLink invalidate];
+  } else {
+    dispatch_async(dispatch_get_main_queue(), ^{
+      [displayLink invalidate];
+    });
+  }
+}
+
+void MainDisplayLinkObserver::requestFrame() const noexcept
+{
+  impl_->displayLink.paused = NO;
+}
+
+} // namespace facebook::react
@@ -82,6 +82,7 @@ import com.facebook.react.devsupport.interfaces.DevSupportManager;
 import com.facebook.react.devsupport.interfaces.PackagerStatusCallback;
 import com.facebook.react.devsupport.interfaces.PausedInDebuggerOverlayManager;
 import com.facebook.react.devsupport.interfaces.RedBoxHandler;
+import com.facebook.react.fabric.FabricUIManager;
 import com.facebook.react.interfaces.TaskInterface;
 import com.facebook.react.internal.AndroidChoreographerProvider;
 import com.facebook.react.internal.ChoreographerProvider;
@@ -888,6 +889,12 @@ public class ReactInstanceManager {
       if (appearanceModule != null) {
         appearanceModule.onConfigurationChanged(updatedContext);
       }
+
+      UIManager fabricUIManager = currentReactContext.getFabricUIManager();
+      if (fabricUIManager instanceof FabricUIManager) {
+        ((FabricUIManager) fabricUIManager)
+            .onFontScaleChanged(updatedContext.getResources().getConfiguration().fontScale);
+      }
     }
   }
 
@@ -23,6 +23,7 @@ import android.content.Context;
 import android.graphics.Point;
 import android.os.SystemClock;
 import android.view.View;
+import android.view.WindowManager;
 import android.view.accessibility.AccessibilityEvent;
 import androidx.annotation.AnyThread;
 import androidx.annotation.Nullable;
@@ -53,6 +54,7 @@ import com.facebook.react.bridge.WritableMap;
 import com.facebook.react.common.annotations.UnstableReactNativeAPI;
 import com.facebook.react.common.build.ReactBuildConfig;
 import com.facebook.react.common.mapbuffer.ReadableMapBuffer;
+import com.facebook.react.fabric.events.EventBeatManager;
 import com.facebook.react.fabric.events.EventEmitterWrapper;
 import com.facebook.react.fabric.events.FabricEventEmitter;
 import com.facebook.react.fabric.internal.interop.InteropUIBlockListener;
@@ -981,6 +983,18 @@ public class FabricUIManager
     mBinding = binding;
   }
 
+  /**
+   * Called when the font scale of the configuration changed, which invalidates the text
+   * measurements persisted across app launches.
+   */
+  @AnyThread
+  public void onFontScaleChanged(float fontScale) {
+    final @Nullable FabricUIManagerBinding binding = mBinding;
+    if (binding != null) {
+      binding.setFontScale(fontScale);
+    }
+  }
+
   /**
    * Updates the layout metrics of the root view based on the Measure specs received by parameters.
    */
@@ -1430,10 +1444,24 @@ public class FabricUIManager
     @ThreadConfined(UI)
     private boolean mIsScheduled = false;
 
+    @ThreadConfined(UI)
+    private long mFrameIntervalNanos = 0;
+
     private DispatchUIFrameCallback(ReactContext reactContext) {
       super(reactContext);
     }
 
+    @SuppressWarnings("deprecation")
+    private long getFrameIntervalNanos() {
+      WindowManager windowManager =
+          (WindowManager) mReactApplicationContext.getSystemService(Context.WINDOW_SERVICE);
+      if (windowManager == null) {
+        return 0;
+      }
+      float refreshRate = windowManager.getDefaultDisplay().getRefreshRate();
+      return refreshRate > 0 ? (long) (1_000_000_000 / refreshRate) : 0;
+    }
+
     @UiThread
     @ThreadConfined(UI)
     private void schedule() {
@@ -1447,6 +1475,10 @@ public class FabricUIManager
     @UiThread
     @ThreadConfined(UI)
     void resume() {
+      // The refresh rate may have changed while the app was in background.
+      if (ReactNativeFeatureFlags.enableFrameDeadlineScheduling()) {
+        mFrameIntervalNanos = getFrameIntervalNanos();
+      }
       mShouldSchedule = true;
       schedule();
     }
@@ -1476,6 +1508,14 @@ public class FabricUIManager
         return;
       }
 
+      // Let JavaScript work scheduled by the RuntimeScheduler yield before
+      // the frame deadline.
+      if (ReactNativeFeatureFlags.enableFrameDeadlineScheduling()
+          && mBatchEventDispatchedListener instanceof EventBeatManager) {
+        ((EventBeatManager) mBatchEventDispatchedListener)
+            .onFrame(frameTimeNanos, mFrameIntervalNanos);
+      }
+
       // Drive any animations from C++.
       // There is a race condition here between getting/setting
       // `mDriveCxxAnimations` which shouldn't matter; it's safe to call
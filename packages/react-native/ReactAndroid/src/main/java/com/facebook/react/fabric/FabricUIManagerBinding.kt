@@ -8,13 +8,18 @@
 package com.facebook.react.fabric
 
 import android.annotation.SuppressLint
+import android.content.Context
+import android.content.pm.PackageManager
+import android.os.Build
 import com.facebook.jni.HybridClassBase
 import com.facebook.proguard.annotations.DoNotStrip
 import com.facebook.react.bridge.NativeMap
 import com.facebook.react.bridge.RuntimeExecutor
 import com.facebook.react.bridge.RuntimeScheduler
 import com.facebook.react.fabric.events.EventBeatManager
+import com.facebook.react.internal.featureflags.ReactNativeFeatureFlags
 import com.facebook.react.uimanager.PixelUtil.getDisplayMetricDensity
+import java.io.File
 
 @DoNotStrip
 @SuppressLint("MissingNativeLoadLibrary")
@@ -31,6 +36,9 @@ internal class FabricUIManagerBinding : HybridClassBase() {
       uiManager: FabricUIManager,
       eventBeatManager: EventBeatManager,
       componentsRegistry: ComponentFactory,
+      textMeasureCacheFilePath: String?,
+      fontConfigurationFingerprint: Long,
+      fontScale: Float,
   )
 
   external fun startSurface(surfaceId: Int, moduleName: String, initialProps: NativeMap?)
@@ -65,6 +73,8 @@ internal class FabricUIManagerBinding : HybridClassBase() {
 
   external fun setPixelDensity(pointScaleFactor: Float)
 
+  external fun setFontScale(fontScale: Float)
+
   external fun setConstraints(
       surfaceId: Int,
       minWidth: Float,
@@ -84,6 +94,7 @@ internal class FabricUIManagerBinding : HybridClassBase() {
   external fun reportMount(surfaceId: Int)
 
   fun register(
+      context: Context,
       runtimeExecutor: RuntimeExecutor,
       runtimeScheduler: RuntimeScheduler,
       fabricUIManager: FabricUIManager,
@@ -91,12 +102,16 @@ internal class FabricUIManagerBinding : HybridClassBase() {
       componentFactory: ComponentFactory,
   ) {
     fabricUIManager.setBinding(this)
+    val textMeasureCacheFilePath = getTextMeasureCacheFilePath(context)
     installFabricUIManager(
         runtimeExecutor,
         runtimeScheduler,
         fabricUIManager,
         eventBeatManager,
         componentFactory,
+        textMeasureCacheFilePath,
+        if (textMeasureCacheFilePath != null) getFontConfigurationFingerprint(context) else 0L,
+        context.resources.configuration.fontScale,
     )
     setPixelDensity(getDisplayMetricDensity())
   }
@@ -108,8 +123,30 @@ internal class FabricUIManagerBinding : HybridClassBase() {
   }
 
   private companion object {
+    private const val TEXT_MEASURE_CACHE_FILE_NAME = "RNTextMeasureCache"
+
     init {
       FabricSoLoader.staticInit()
     }
+
+    private fun getTextMeasureCacheFilePath(context: Context): String? =
+        if (ReactNativeFeatureFlags.enablePersistentTextMeasureCache())
+            File(context.cacheDir, TEXT_MEASURE_CACHE_FILE_NAME).path
+        else null
+
+    /**
+     * Identifies the fonts which text is measured with: system fonts change with OS updates, and
+     * fonts bundled with the app change with app updates.
+     */
+    @Suppress("DEPRECATION")
+    private fun getFontConfigurationFingerprint(context: Context): Long {
+      val lastUpdateTime =
+          try {
+            context.packageManager.getPackageInfo(context.packageName, 0).lastUpdateTime
+          } catch (e: PackageManager.NameNotFoundException) {
+            0L
+          }
+      return (Build.FINGERPRINT.hashCode().toLong() shl 32) xor lastUpdateTime
+    }
   }
 }
@@ -60,6 +60,7 @@ public class FabricUIManagerProviderImpl(
 
     if (runtimeExecutor != null && runtimeScheduler != null) {
       binding.register(
+          context,
           runtimeExecutor,
           runtimeScheduler,
           fabricUIManager,
@@ -27,10 +27,21 @@ internal class EventBeatManager : HybridClassBase(), BatchEventDispatchedListene
 
   private external fun tick()
 
+  private external fun frame(frameTimeNanos: Long, frameIntervalNanos: Long)
+
   override fun onBatchEventDispatched() {
     tick()
   }
 
+  /**
+   * Reports a frame produced by the Choreographer, so that JavaScript work can yield before the
+   * frame deadline. [frameTimeNanos] is the vsync time of the frame and [frameIntervalNanos] the
+   * interval between frames; an interval of zero disables the frame budget.
+   */
+  fun onFrame(frameTimeNanos: Long, frameIntervalNanos: Long) {
+    frame(frameTimeNanos, frameIntervalNanos)
+  }
+
   private companion object {
     init {
       FabricSoLoader.staticInit()
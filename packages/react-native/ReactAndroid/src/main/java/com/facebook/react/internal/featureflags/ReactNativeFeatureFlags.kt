@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<adc6b24ae04487d2b82a2bac35f027a7>>
+ * @generated SignedSource<<65f4861457ae380610c33bb1a103cd72>>
  */
 
 /**
@@ -120,12 +120,30 @@ public object ReactNativeFeatureFlags {
   @JvmStatic
   public fun enableAndroidTextMeasurementOptimizations(): Boolean = accessor.enableAndroidTextMeasurementOptimizations()
 
+  /**
+   * Commits the trees completed by React (with layout, commit hooks and mounting) on the background executor of the host, instead of on the JavaScript thread.
+   */
+  @JvmStatic
+  public fun enableBackgroundCommits(): Boolean = accessor.enableBackgroundCommits()
+
+  /**
+   * Calculates the mutations of committed trees on the background executor of the host ahead of mounting, instead of on the mounting thread.
+   */
+  @JvmStatic
+  public fun enableBackgroundDiffing(): Boolean = accessor.enableBackgroundDiffing()
+
   /**
    * Feature flag to enable the new bridgeless architecture. Note: Enabling this will force enable the following flags: `useTurboModules` & `enableFabricRenderer`.
    */
   @JvmStatic
   public fun enableBridgelessArchitecture(): Boolean = accessor.enableBridgelessArchitecture()
 
+  /**
+   * Keeps JS timers in a timer wheel and wakes them up with a single platform timer, instead of scheduling a platform timer for each JS timer.
+   */
+  @JvmStatic
+  public fun enableCoalescedTimers(): Boolean = accessor.enableCoalescedTimers()
+
   /**
    * Enable prop iterator setter-style construction of Props in C++ (this flag is not used in Java).
    */
@@ -186,6 +204,12 @@ public object ReactNativeFeatureFlags {
   @JvmStatic
   public fun enableFontScaleChangesUpdatingLayout(): Boolean = accessor.enableFontScaleChangesUpdatingLayout()
 
+  /**
+   * Reports the frame timing of the host platform to the RuntimeScheduler, which then asks JavaScript tasks to yield at frame deadlines and reports tasks which miss a frame as long tasks.
+   */
+  @JvmStatic
+  public fun enableFrameDeadlineScheduling(): Boolean = accessor.enableFrameDeadlineScheduling()
+
   /**
    * Applies base offset for each line of text separately on iOS.
    */
@@ -282,6 +306,12 @@ public object ReactNativeFeatureFlags {
   @JvmStatic
   public fun enableNetworkEventReporting(): Boolean = accessor.enableNetworkEventReporting()
 
+  /**
+   * Persists text measurements in a file across app launches, as a second-level cache of the TextLayoutManager.
+   */
+  @JvmStatic
+  public fun enablePersistentTextMeasureCache(): Boolean = accessor.enablePersistentTextMeasureCache()
+
   /**
    * Enables caching text layout artifacts for later reuse
    */
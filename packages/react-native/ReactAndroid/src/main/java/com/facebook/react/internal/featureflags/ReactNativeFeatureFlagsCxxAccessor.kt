@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<3ebb3c265193b4f61e5bf43082c5be54>>
+ * @generated SignedSource<<f636e7e9e1b6ceafcdfa9cf128b58a14>>
  */
 
 /**
@@ -35,7 +35,10 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
   private var enableAndroidAntialiasedBorderRadiusClippingCache: Boolean? = null
   private var enableAndroidLinearTextCache: Boolean? = null
   private var enableAndroidTextMeasurementOptimizationsCache: Boolean? = null
+  private var enableBackgroundCommitsCache: Boolean? = null
+  private var enableBackgroundDiffingCache: Boolean? = null
   private var enableBridgelessArchitectureCache: Boolean? = null
+  private var enableCoalescedTimersCache: Boolean? = null
   private var enableCppPropsIteratorSetterCache: Boolean? = null
   private var enableCustomFocusSearchOnClippedElementsAndroidCache: Boolean? = null
   private var enableDestroyShadowTreeRevisionAsyncCache: Boolean? = null
@@ -46,6 +49,7 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
   private var enableFabricLogsCache: Boolean? = null
   private var enableFabricRendererCache: Boolean? = null
   private var enableFontScaleChangesUpdatingLayoutCache: Boolean? = null
+  private var enableFrameDeadlineSchedulingCache: Boolean? = null
   private var enableIOSTextBaselineOffsetPerLineCache: Boolean? = null
   private var enableIOSViewClipToPaddingBoxCache: Boolean? = null
   private var enableImagePrefetchingAndroidCache: Boolean? = null
@@ -62,6 +66,7 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
   private var enableModuleArgumentNSNullConversionIOSCache: Boolean? = null
   private var enableNativeCSSParsingCache: Boolean? = null
   private var enableNetworkEventReportingCache: Boolean? = null
+  private var enablePersistentTextMeasureCacheCache: Boolean? = null
   private var enablePreparedTextLayoutCache: Boolean? = null
   private var enablePropsUpdateReconciliationAndroidCache: Boolean? = null
   private var enableSwiftUIBasedFiltersCache: Boolean? = null
@@ -246,6 +251,24 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
     return cached
   }
 
+  override fun enableBackgroundCommits(): Boolean {
+    var cached = enableBackgroundCommitsCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enableBackgroundCommits()
+      enableBackgroundCommitsCache = cached
+    }
+    return cached
+  }
+
+  override fun enableBackgroundDiffing(): Boolean {
+    var cached = enableBackgroundDiffingCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enableBackgroundDiffing()
+      enableBackgroundDiffingCache = cached
+    }
+    return cached
+  }
+
   override fun enableBridgelessArchitecture(): Boolean {
     var cached = enableBridgelessArchitectureCache
     if (cached == null) {
@@ -255,6 +278,15 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
     return cached
   }
 
+  override fun enableCoalescedTimers(): Boolean {
+    var cached = enableCoalescedTimersCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enableCoalescedTimers()
+      enableCoalescedTimersCache = cached
+    }
+    return cached
+  }
+
   override fun enableCppPropsIteratorSetter(): Boolean {
     var cached = enableCppPropsIteratorSetterCache
     if (cached == null) {
@@ -345,6 +377,15 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
     return cached
   }
 
+  override fun enableFrameDeadlineScheduling(): Boolean {
+    var cached = enableFrameDeadlineSchedulingCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enableFrameDeadlineScheduling()
+      enableFrameDeadlineSchedulingCache = cached
+    }
+    return cached
+  }
+
   override fun enableIOSTextBaselineOffsetPerLine(): Boolean {
     var cached = enableIOSTextBaselineOffsetPerLineCache
     if (cached == null) {
@@ -489,6 +530,15 @@ internal class ReactNativeFeatureFlagsCxxAccessor : ReactNativeFeatureFlagsAcces
     return cached
   }
 
+  override fun enablePersistentTextMeasureCache(): Boolean {
+    var cached = enablePersistentTextMeasureCacheCache
+    if (cached == null) {
+      cached = ReactNativeFeatureFlagsCxxInterop.enablePersistentTextMeasureCache()
+      enablePersistentTextMeasureCacheCache = cached
+    }
+    return cached
+  }
+
   override fun enablePreparedTextLayout(): Boolean {
     var cached = enablePreparedTextLayoutCache
     if (cached == null) {
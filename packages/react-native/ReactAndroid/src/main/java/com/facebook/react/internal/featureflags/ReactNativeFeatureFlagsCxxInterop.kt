@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<eb11cf643c4e94eddc5d7985a8a7a03a>>
+ * @generated SignedSource<<b31a317a568634b1cd8956b8f105b2c8>>
  */
 
 /**
@@ -58,8 +58,14 @@ public object ReactNativeFeatureFlagsCxxInterop {
 
   @DoNotStrip @JvmStatic public external fun enableAndroidTextMeasurementOptimizations(): Boolean
 
+  @DoNotStrip @JvmStatic public external fun enableBackgroundCommits(): Boolean
+
+  @DoNotStrip @JvmStatic public external fun enableBackgroundDiffing(): Boolean
+
   @DoNotStrip @JvmStatic public external fun enableBridgelessArchitecture(): Boolean
 
+  @DoNotStrip @JvmStatic public external fun enableCoalescedTimers(): Boolean
+
   @DoNotStrip @JvmStatic public external fun enableCppPropsIteratorSetter(): Boolean
 
   @DoNotStrip @JvmStatic public external fun enableCustomFocusSearchOnClippedElementsAndroid(): Boolean
@@ -80,6 +86,8 @@ public object ReactNativeFeatureFlagsCxxInterop {
 
   @DoNotStrip @JvmStatic public external fun enableFontScaleChangesUpdatingLayout(): Boolean
 
+  @DoNotStrip @JvmStatic public external fun enableFrameDeadlineScheduling(): Boolean
+
   @DoNotStrip @JvmStatic public external fun enableIOSTextBaselineOffsetPerLine(): Boolean
 
   @DoNotStrip @JvmStatic public external fun enableIOSViewClipToPaddingBox(): Boolean
@@ -112,6 +120,8 @@ public object ReactNativeFeatureFlagsCxxInterop {
 
   @DoNotStrip @JvmStatic public external fun enableNetworkEventReporting(): Boolean
 
+  @DoNotStrip @JvmStatic public external fun enablePersistentTextMeasureCache(): Boolean
+
   @DoNotStrip @JvmStatic public external fun enablePreparedTextLayout(): Boolean
 
   @DoNotStrip @JvmStatic public external fun enablePropsUpdateReconciliationAndroid(): Boolean
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<58cb08dbd188ec64d3738f548567bcde>>
+ * @generated SignedSource<<98a41ee3c230f18f19e26c5f39734204>>
  */
 
 /**
@@ -53,8 +53,14 @@ public open class ReactNativeFeatureFlagsDefaults : ReactNativeFeatureFlagsProvi
 
   override fun enableAndroidTextMeasurementOptimizations(): Boolean = false
 
+  override fun enableBackgroundCommits(): Boolean = false
+
+  override fun enableBackgroundDiffing(): Boolean = false
+
   override fun enableBridgelessArchitecture(): Boolean = false
 
+  override fun enableCoalescedTimers(): Boolean = false
+
   override fun enableCppPropsIteratorSetter(): Boolean = false
 
   override fun enableCustomFocusSearchOnClippedElementsAndroid(): Boolean = true
@@ -75,6 +81,8 @@ public open class ReactNativeFeatureFlagsDefaults : ReactNativeFeatureFlagsProvi
 
   override fun enableFontScaleChangesUpdatingLayout(): Boolean = true
 
+  override fun enableFrameDeadlineScheduling(): Boolean = false
+
   override fun enableIOSTextBaselineOffsetPerLine(): Boolean = false
 
   override fun enableIOSViewClipToPaddingBox(): Boolean = false
@@ -107,6 +115,8 @@ public open class ReactNativeFeatureFlagsDefaults : ReactNativeFeatureFlagsProvi
 
   override fun enableNetworkEventReporting(): Boolean = false
 
+  override fun enablePersistentTextMeasureCache(): Boolean = false
+
   override fun enablePreparedTextLayout(): Boolean = false
 
   override fun enablePropsUpdateReconciliationAndroid(): Boolean = false
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<f9ee0d1f23024b026d065ffc3d48cfcf>>
+ * @generated SignedSource<<72f47222443e67f67a72e8a0043ce50f>>
  */
 
 /**
@@ -39,7 +39,10 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
   private var enableAndroidAntialiasedBorderRadiusClippingCache: Boolean? = null
   private var enableAndroidLinearTextCache: Boolean? = null
   private var enableAndroidTextMeasurementOptimizationsCache: Boolean? = null
+  private var enableBackgroundCommitsCache: Boolean? = null
+  private var enableBackgroundDiffingCache: Boolean? = null
   private var enableBridgelessArchitectureCache: Boolean? = null
+  private var enableCoalescedTimersCache: Boolean? = null
   private var enableCppPropsIteratorSetterCache: Boolean? = null
   private var enableCustomFocusSearchOnClippedElementsAndroidCache: Boolean? = null
   private var enableDestroyShadowTreeRevisionAsyncCache: Boolean? = null
@@ -50,6 +53,7 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
   private var enableFabricLogsCache: Boolean? = null
   private var enableFabricRendererCache: Boolean? = null
   private var enableFontScaleChangesUpdatingLayoutCache: Boolean? = null
+  private var enableFrameDeadlineSchedulingCache: Boolean? = null
   private var enableIOSTextBaselineOffsetPerLineCache: Boolean? = null
   private var enableIOSViewClipToPaddingBoxCache: Boolean? = null
   private var enableImagePrefetchingAndroidCache: Boolean? = null
@@ -66,6 +70,7 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
   private var enableModuleArgumentNSNullConversionIOSCache: Boolean? = null
   private var enableNativeCSSParsingCache: Boolean? = null
   private var enableNetworkEventReportingCache: Boolean? = null
+  private var enablePersistentTextMeasureCacheCache: Boolean? = null
   private var enablePreparedTextLayoutCache: Boolean? = null
   private var enablePropsUpdateReconciliationAndroidCache: Boolean? = null
   private var enableSwiftUIBasedFiltersCache: Boolean? = null
@@ -265,6 +270,26 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
     return cached
   }
 
+  override fun enableBackgroundCommits(): Boolean {
+    var cached = enableBackgroundCommitsCache
+    if (cached == null) {
+      cached = currentProvider.enableBackgroundCommits()
+      accessedFeatureFlags.add("enableBackgroundCommits")
+      enableBackgroundCommitsCache = cached
+    }
+    return cached
+  }
+
+  override fun enableBackgroundDiffing(): Boolean {
+    var cached = enableBackgroundDiffingCache
+    if (cached == null) {
+      cached = currentProvider.enableBackgroundDiffing()
+      accessedFeatureFlags.add("enableBackgroundDiffing")
+      enableBackgroundDiffingCache = cached
+    }
+    return cached
+  }
+
   override fun enableBridgelessArchitecture(): Boolean {
     var cached = enableBridgelessArchitectureCache
     if (cached == null) {
@@ -275,6 +300,16 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
     return cached
   }
 
+  override fun enableCoalescedTimers(): Boolean {
+    var cached = enableCoalescedTimersCache
+    if (cached == null) {
+      cached = currentProvider.enableCoalescedTimers()
+      accessedFeatureFlags.add("enableCoalescedTimers")
+      enableCoalescedTimersCache = cached
+    }
+    return cached
+  }
+
   override fun enableCppPropsIteratorSetter(): Boolean {
     var cached = enableCppPropsIteratorSetterCache
     if (cached == null) {
@@ -375,6 +410,16 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
     return cached
   }
 
+  override fun enableFrameDeadlineScheduling(): Boolean {
+    var cached = enableFrameDeadlineSchedulingCache
+    if (cached == null) {
+      cached = currentProvider.enableFrameDeadlineScheduling()
+      accessedFeatureFlags.add("enableFrameDeadlineScheduling")
+      enableFrameDeadlineSchedulingCache = cached
+    }
+    return cached
+  }
+
   override fun enableIOSTextBaselineOffsetPerLine(): Boolean {
     var cached = enableIOSTextBaselineOffsetPerLineCache
     if (cached == null) {
@@ -535,6 +580,16 @@ internal class ReactNativeFeatureFlagsLocalAccessor : ReactNativeFeatureFlagsAcc
     return cached
   }
 
+  override fun enablePersistentTextMeasureCache(): Boolean {
+    var cached = enablePersistentTextMeasureCacheCache
+    if (cached == null) {
+      cached = currentProvider.enablePersistentTextMeasureCache()
+      accessedFeatureFlags.add("enablePersistentTextMeasureCache")
+      enablePersistentTextMeasureCacheCache = cached
+    }
+    return cached
+  }
+
   override fun enablePreparedTextLayout(): Boolean {
     var cached = enablePreparedTextLayoutCache
     if (cached == null) {
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<09cef8cedd515f477a32c2ed77d86fc4>>
+ * @generated SignedSource<<645c700d187e680a9d8159bd9c0c2f27>>
  */
 
 /**
@@ -53,8 +53,14 @@ public interface ReactNativeFeatureFlagsProvider {
 
   @DoNotStrip public fun enableAndroidTextMeasurementOptimizations(): Boolean
 
+  @DoNotStrip public fun enableBackgroundCommits(): Boolean
+
+  @DoNotStrip public fun enableBackgroundDiffing(): Boolean
+
   @DoNotStrip public fun enableBridgelessArchitecture(): Boolean
 
+  @DoNotStrip public fun enableCoalescedTimers(): Boolean
+
   @DoNotStrip public fun enableCppPropsIteratorSetter(): Boolean
 
   @DoNotStrip public fun enableCustomFocusSearchOnClippedElementsAndroid(): Boolean
@@ -75,6 +81,8 @@ public interface ReactNativeFeatureFlagsProvider {
 
   @DoNotStrip public fun enableFontScaleChangesUpdatingLayout(): Boolean
 
+  @DoNotStrip public fun enableFrameDeadlineScheduling(): Boolean
+
   @DoNotStrip public fun enableIOSTextBaselineOffsetPerLine(): Boolean
 
   @DoNotStrip public fun enableIOSViewClipToPaddingBox(): Boolean
@@ -107,6 +115,8 @@ public interface ReactNativeFeatureFlagsProvider {
 
   @DoNotStrip public fun enableNetworkEventReporting(): Boolean
 
+  @DoNotStrip public fun enablePersistentTextMeasureCache(): Boolean
+
   @DoNotStrip public fun enablePreparedTextLayout(): Boolean
 
   @DoNotStrip public fun enablePropsUpdateReconciliationAndroid(): Boolean
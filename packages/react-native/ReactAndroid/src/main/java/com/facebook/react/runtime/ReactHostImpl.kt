@@ -683,6 +683,8 @@ public class ReactHostImpl(
   override fun onConfigurationChanged(context: Context) {
     val currentReactContext = this.currentReactContext
     if (currentReactContext != null) {
+      uiManager?.onFontScaleChanged(context.resources.configuration.fontScale)
+
       if (ReactNativeFeatureFlags.enableFontScaleChangesUpdatingLayout()) {
         val previousFontScale = PixelUtil.toPixelFromSP(1.0)
         DisplayMetricsHolder.initDisplayMetrics(currentReactContext)
@@ -252,6 +252,7 @@ internal class ReactInstance(
 
     val binding = FabricUIManagerBinding()
     binding.register(
+        context,
         getBufferedRuntimeExecutor(),
         getRuntimeScheduler(),
         fabricUIManager,
@@ -32,6 +32,12 @@ void AndroidEventBeat::tick() const {
   induce();
 }
 
+void AndroidEventBeat::onFrame(
+    HighResTimeStamp frameDeadline,
+    HighResDuration frameInterval) const {
+  setFrameDeadline(frameDeadline, frameInterval);
+}
+
 void AndroidEventBeat::request() const {
   bool alreadyRequested = isEventBeatRequested_;
   EventBeat::request();
@@ -25,6 +25,8 @@ class AndroidEventBeat final : public EventBeat, public EventBeatManagerObserver
 
   void tick() const override;
 
+  void onFrame(HighResTimeStamp frameDeadline, HighResDuration frameInterval) const override;
+
   void request() const override;
 
  private:
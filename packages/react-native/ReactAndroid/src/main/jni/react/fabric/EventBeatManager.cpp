@@ -35,10 +35,28 @@ void EventBeatManager::tick() {
   }
 }
 
+void EventBeatManager::frame(jlong frameTimeNanos, jlong frameIntervalNanos) {
+  // `System.nanoTime` and `std::chrono::steady_clock` both use the monotonic
+  // clock on Android. The frame must be produced before the next vsync.
+  auto frameInterval = HighResDuration::fromNanoseconds(frameIntervalNanos);
+  auto frameTime = std::chrono::steady_clock::time_point(
+      std::chrono::nanoseconds(frameTimeNanos));
+  auto frameDeadline =
+      HighResTimeStamp::fromChronoSteadyClockTimePoint(frameTime) +
+      frameInterval;
+
+  std::scoped_lock lock(mutex_);
+
+  for (auto observer : observers_) {
+    observer->onFrame(frameDeadline, frameInterval);
+  }
+}
+
 void EventBeatManager::registerNatives() {
   registerHybrid({
       makeNativeMethod("initHybrid", EventBeatManager::initHybrid),
       makeNativeMethod("tick", EventBeatManager::tick),
+      makeNativeMethod("frame", EventBeatManager::frame),
   });
 }
 
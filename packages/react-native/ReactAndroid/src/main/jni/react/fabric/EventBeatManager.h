@@ -11,6 +11,7 @@
 #include <unordered_set>
 
 #include <fbjni/fbjni.h>
+#include <react/timing/primitives.h>
 
 namespace facebook::react {
 
@@ -22,6 +23,13 @@ class EventBeatManagerObserver {
    */
   virtual void tick() const = 0;
 
+  /*
+   * Called by `EventBeatManager` on the main thread for every frame produced
+   * by the Choreographer, with the deadline of the frame and the interval
+   * between frames.
+   */
+  virtual void onFrame(HighResTimeStamp /*frameDeadline*/, HighResDuration /*frameInterval*/) const {}
+
   virtual ~EventBeatManagerObserver() noexcept = default;
 };
 
@@ -45,6 +53,13 @@ class EventBeatManager : public jni::HybridClass<EventBeatManager> {
    */
   void tick();
 
+  /*
+   * Called by Java counterpart for every Choreographer frame, with the vsync
+   * time of the frame (on the `System.nanoTime` clock) and the interval
+   * between frames.
+   */
+  void frame(jlong frameTimeNanos, jlong frameIntervalNanos);
+
   mutable std::unordered_set<const EventBeatManagerObserver *> observers_{}; // Protected by `mutex_`
 
   mutable std::mutex mutex_;
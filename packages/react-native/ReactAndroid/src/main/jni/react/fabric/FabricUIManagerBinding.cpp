@@ -28,9 +28,11 @@
 #include <react/renderer/scheduler/Scheduler.h>
 #include <react/renderer/scheduler/SchedulerDelegate.h>
 #include <react/renderer/scheduler/SchedulerToolbox.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/uimanager/primitives.h>
 #include <react/utils/ContextContainer.h>
 #include <string_view>
+#include <thread>
 
 namespace facebook::react {
 
@@ -50,6 +52,13 @@ void FabricUIManagerBinding::setPixelDensity(float pointScaleFactor) {
   pointScaleFactor_ = pointScaleFactor;
 }
 
+void FabricUIManagerBinding::setFontScale(jfloat fontScale) {
+  std::shared_lock lock(installMutex_);
+  if (persistentTextMeasureCache_) {
+    persistentTextMeasureCache_->setFontScale(fontScale);
+  }
+}
+
 void FabricUIManagerBinding::driveCxxAnimations() {
   getScheduler()->animationTick();
 }
@@ -515,7 +524,10 @@ void FabricUIManagerBinding::installFabricUIManager(
     jni::alias_ref<JRuntimeScheduler::javaobject> runtimeSchedulerHolder,
     jni::alias_ref<JFabricUIManager::javaobject> javaUIManager,
     EventBeatManager* eventBeatManager,
-    ComponentFactory* componentsRegistry) {
+    ComponentFactory* componentsRegistry,
+    jni::alias_ref<jstring> textMeasureCacheFilePath,
+    jlong fontConfigurationFingerprint,
+    jfloat fontScale) {
   TraceSection s("FabricUIManagerBinding::installFabricUIManager");
 
   enableFabricLogs_ = ReactNativeFeatureFlags::enableFabricLogs();
@@ -561,6 +573,20 @@ void FabricUIManagerBinding::installFabricUIManager(
 
   contextContainer->insert("FabricUIManager", globalJavaUiManager);
 
+  // The path is only passed if the cache is enabled.
+  if (textMeasureCacheFilePath) {
+    persistentTextMeasureCache_ = std::make_shared<PersistentTextMeasureCache>(
+        textMeasureCacheFilePath->toStdString(),
+        static_cast<uint64_t>(fontConfigurationFingerprint),
+        fontScale,
+        [](std::function<void()>&& task) {
+          std::thread(std::move(task)).detach();
+        });
+    contextContainer->insert(
+        PersistentTextMeasureCache::ContextContainerKey,
+        persistentTextMeasureCache_);
+  }
+
   auto toolbox = SchedulerToolbox{};
   toolbox.contextContainer = contextContainer;
   toolbox.componentRegistryFactory = componentsRegistry->buildRegistryFunction;
@@ -589,6 +615,7 @@ void FabricUIManagerBinding::uninstallFabricUIManager() {
   animationDriver_ = nullptr;
   scheduler_ = nullptr;
   mountingManager_ = nullptr;
+  persistentTextMeasureCache_ = nullptr;
 }
 
 std::shared_ptr<FabricMountingManager>
@@ -795,6 +822,7 @@ void FabricUIManagerBinding::registerNatives() {
           "setConstraints", FabricUIManagerBinding::setConstraints),
       makeNativeMethod(
           "setPixelDensity", FabricUIManagerBinding::setPixelDensity),
+      makeNativeMethod("setFontScale", FabricUIManagerBinding::setFontScale),
       makeNativeMethod(
           "driveCxxAnimations", FabricUIManagerBinding::driveCxxAnimations),
       makeNativeMethod(
@@ -31,6 +31,7 @@ class EventBeatManager;
 class FabricMountingManager;
 class Instance;
 class LayoutAnimationDriver;
+class PersistentTextMeasureCache;
 class Scheduler;
 
 class FabricUIManagerBinding : public jni::HybridClass<FabricUIManagerBinding>,
@@ -65,7 +66,10 @@ class FabricUIManagerBinding : public jni::HybridClass<FabricUIManagerBinding>,
       jni::alias_ref<JRuntimeScheduler::javaobject> runtimeSchedulerHolder,
       jni::alias_ref<JFabricUIManager::javaobject> javaUIManager,
       EventBeatManager *eventBeatManager,
-      ComponentFactory *componentsRegistry);
+      ComponentFactory *componentsRegistry,
+      jni::alias_ref<jstring> textMeasureCacheFilePath,
+      jlong fontConfigurationFingerprint,
+      jfloat fontScale);
 
   void startSurface(jint surfaceId, jni::alias_ref<jstring> moduleName, NativeMap *initialProps);
 
@@ -114,6 +118,8 @@ class FabricUIManagerBinding : public jni::HybridClass<FabricUIManagerBinding>,
 
   void setPixelDensity(float pointScaleFactor);
 
+  void setFontScale(jfloat fontScale);
+
   void driveCxxAnimations();
 
   void drainPreallocateViewsQueue();
@@ -130,6 +136,7 @@ class FabricUIManagerBinding : public jni::HybridClass<FabricUIManagerBinding>,
   std::shared_mutex installMutex_;
   std::shared_ptr<FabricMountingManager> mountingManager_;
   std::shared_ptr<Scheduler> scheduler_;
+  std::shared_ptr<PersistentTextMeasureCache> persistentTextMeasureCache_;
 
   std::shared_ptr<FabricMountingManager> getMountingManager(const char *locationHint);
 
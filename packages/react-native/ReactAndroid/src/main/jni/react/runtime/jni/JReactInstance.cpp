@@ -14,6 +14,7 @@
 #include <jni.h>
 #include <jsi/jsi.h>
 #include <react/jni/JRuntimeExecutor.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/jni/JSLogging.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
 #include <react/runtime/BridgelessNativeMethodCallInvoker.h>
@@ -43,7 +44,9 @@ JReactInstance::JReactInstance(
   // Create the timer manager (for JS timers)
   auto timerRegistry =
       std::make_unique<JavaTimerRegistry>(jni::make_global(javaTimerManager));
-  auto timerManager = std::make_shared<TimerManager>(std::move(timerRegistry));
+  auto timerManager = std::make_shared<TimerManager>(
+      std::move(timerRegistry),
+      ReactNativeFeatureFlags::enableCoalescedTimers());
   jsTimerExecutor->cthis()->setTimerManager(timerManager);
 
   jReactExceptionManager_ = jni::make_global(jReactExceptionManager);
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<08d50062a88a227aa8800e549b6dfe57>>
+ * @generated SignedSource<<f86bab2f8c1df43ed24f2a9c84f0db9b>>
  */
 
 /**
@@ -86,10 +86,22 @@ bool ReactNativeFeatureFlags::enableAndroidTextMeasurementOptimizations() {
   return getAccessor().enableAndroidTextMeasurementOptimizations();
 }
 
+bool ReactNativeFeatureFlags::enableBackgroundCommits() {
+  return getAccessor().enableBackgroundCommits();
+}
+
+bool ReactNativeFeatureFlags::enableBackgroundDiffing() {
+  return getAccessor().enableBackgroundDiffing();
+}
+
 bool ReactNativeFeatureFlags::enableBridgelessArchitecture() {
   return getAccessor().enableBridgelessArchitecture();
 }
 
+bool ReactNativeFeatureFlags::enableCoalescedTimers() {
+  return getAccessor().enableCoalescedTimers();
+}
+
 bool ReactNativeFeatureFlags::enableCppPropsIteratorSetter() {
   return getAccessor().enableCppPropsIteratorSetter();
 }
@@ -130,6 +142,10 @@ bool ReactNativeFeatureFlags::enableFontScaleChangesUpdatingLayout() {
   return getAccessor().enableFontScaleChangesUpdatingLayout();
 }
 
+bool ReactNativeFeatureFlags::enableFrameDeadlineScheduling() {
+  return getAccessor().enableFrameDeadlineScheduling();
+}
+
 bool ReactNativeFeatureFlags::enableIOSTextBaselineOffsetPerLine() {
   return getAccessor().enableIOSTextBaselineOffsetPerLine();
 }
@@ -194,6 +210,10 @@ bool ReactNativeFeatureFlags::enableNetworkEventReporting() {
   return getAccessor().enableNetworkEventReporting();
 }
 
+bool ReactNativeFeatureFlags::enablePersistentTextMeasureCache() {
+  return getAccessor().enablePersistentTextMeasureCache();
+}
+
 bool ReactNativeFeatureFlags::enablePreparedTextLayout() {
   return getAccessor().enablePreparedTextLayout();
 }
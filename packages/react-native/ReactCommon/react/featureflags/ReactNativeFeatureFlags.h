@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<4f6913d92515fd817a167ef2a505c777>>
+ * @generated SignedSource<<c4036771ad4f9dd6c8be40d76c021a3f>>
  */
 
 /**
@@ -114,11 +114,26 @@ class ReactNativeFeatureFlags {
    */
   RN_EXPORT static bool enableAndroidTextMeasurementOptimizations();
 
+  /**
+   * Commits the trees completed by React (with layout, commit hooks and mounting) on the background executor of the host, instead of on the JavaScript thread.
+   */
+  RN_EXPORT static bool enableBackgroundCommits();
+
+  /**
+   * Calculates the mutations of committed trees on the background executor of the host ahead of mounting, instead of on the mounting thread.
+   */
+  RN_EXPORT static bool enableBackgroundDiffing();
+
   /**
    * Feature flag to enable the new bridgeless architecture. Note: Enabling this will force enable the following flags: `useTurboModules` & `enableFabricRenderer`.
    */
   RN_EXPORT static bool enableBridgelessArchitecture();
 
+  /**
+   * Keeps JS timers in a timer wheel and wakes them up with a single platform timer, instead of scheduling a platform timer for each JS timer.
+   */
+  RN_EXPORT static bool enableCoalescedTimers();
+
   /**
    * Enable prop iterator setter-style construction of Props in C++ (this flag is not used in Java).
    */
@@ -169,6 +184,11 @@ class ReactNativeFeatureFlags {
    */
   RN_EXPORT static bool enableFontScaleChangesUpdatingLayout();
 
+  /**
+   * Reports the frame timing of the host platform to the RuntimeScheduler, which then asks JavaScript tasks to yield at frame deadlines and reports tasks which miss a frame as long tasks.
+   */
+  RN_EXPORT static bool enableFrameDeadlineScheduling();
+
   /**
    * Applies base offset for each line of text separately on iOS.
    */
@@ -249,6 +269,11 @@ class ReactNativeFeatureFlags {
    */
   RN_EXPORT static bool enableNetworkEventReporting();
 
+  /**
+   * Persists text measurements in a file across app launches, as a second-level cache of the TextLayoutManager.
+   */
+  RN_EXPORT static bool enablePersistentTextMeasureCache();
+
   /**
    * Enables caching text layout artifacts for later reuse
    */
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<5586a2963cb339f4d5241c790da60d62>>
+ * @generated SignedSource<<7debefefe70bc7ade56a6eed81eabbcd>>
  */
 
 /**
@@ -87,10 +87,22 @@ class ReactNativeFeatureFlagsDefaults : public ReactNativeFeatureFlagsProvider {
     return false;
   }
 
+  bool enableBackgroundCommits() override {
+    return false;
+  }
+
+  bool enableBackgroundDiffing() override {
+    return false;
+  }
+
   bool enableBridgelessArchitecture() override {
     return false;
   }
 
+  bool enableCoalescedTimers() override {
+    return false;
+  }
+
   bool enableCppPropsIteratorSetter() override {
     return false;
   }
@@ -131,6 +143,10 @@ class ReactNativeFeatureFlagsDefaults : public ReactNativeFeatureFlagsProvider {
     return true;
   }
 
+  bool enableFrameDeadlineScheduling() override {
+    return false;
+  }
+
   bool enableIOSTextBaselineOffsetPerLine() override {
     return false;
   }
@@ -195,6 +211,10 @@ class ReactNativeFeatureFlagsDefaults : public ReactNativeFeatureFlagsProvider {
     return false;
   }
 
+  bool enablePersistentTextMeasureCache() override {
+    return false;
+  }
+
   bool enablePreparedTextLayout() override {
     return false;
   }
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<543338d7b54991244389bca238b2078d>>
+ * @generated SignedSource<<f2449c5f7775251b55a363a7d25cfa1f>>
  */
 
 /**
@@ -180,6 +180,24 @@ class ReactNativeFeatureFlagsDynamicProvider : public ReactNativeFeatureFlagsDef
     return ReactNativeFeatureFlagsDefaults::enableAndroidTextMeasurementOptimizations();
   }
 
+  bool enableBackgroundCommits() override {
+    auto value = values_["enableBackgroundCommits"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enableBackgroundCommits();
+  }
+
+  bool enableBackgroundDiffing() override {
+    auto value = values_["enableBackgroundDiffing"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enableBackgroundDiffing();
+  }
+
   bool enableBridgelessArchitecture() override {
     auto value = values_["enableBridgelessArchitecture"];
     if (!value.isNull()) {
@@ -189,6 +207,15 @@ class ReactNativeFeatureFlagsDynamicProvider : public ReactNativeFeatureFlagsDef
     return ReactNativeFeatureFlagsDefaults::enableBridgelessArchitecture();
   }
 
+  bool enableCoalescedTimers() override {
+    auto value = values_["enableCoalescedTimers"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enableCoalescedTimers();
+  }
+
   bool enableCppPropsIteratorSetter() override {
     auto value = values_["enableCppPropsIteratorSetter"];
     if (!value.isNull()) {
@@ -279,6 +306,15 @@ class ReactNativeFeatureFlagsDynamicProvider : public ReactNativeFeatureFlagsDef
     return ReactNativeFeatureFlagsDefaults::enableFontScaleChangesUpdatingLayout();
   }
 
+  bool enableFrameDeadlineScheduling() override {
+    auto value = values_["enableFrameDeadlineScheduling"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enableFrameDeadlineScheduling();
+  }
+
   bool enableIOSTextBaselineOffsetPerLine() override {
     auto value = values_["enableIOSTextBaselineOffsetPerLine"];
     if (!value.isNull()) {
@@ -423,6 +459,15 @@ class ReactNativeFeatureFlagsDynamicProvider : public ReactNativeFeatureFlagsDef
     return ReactNativeFeatureFlagsDefaults::enableNetworkEventReporting();
   }
 
+  bool enablePersistentTextMeasureCache() override {
+    auto value = values_["enablePersistentTextMeasureCache"];
+    if (!value.isNull()) {
+      return value.getBool();
+    }
+
+    return ReactNativeFeatureFlagsDefaults::enablePersistentTextMeasureCache();
+  }
+
   bool enablePreparedTextLayout() override {
     auto value = values_["enablePreparedTextLayout"];
     if (!value.isNull()) {
@@ -6,8 +6,13 @@
  */
 
 #include "TurboModule.h"
+#include <react/bridging/LongLivedObject.h>
 #include <react/debug/react_native_assert.h>
 
+#include <array>
+#include <cstring>
+#include <optional>
+
 namespace facebook::react {
 
 TurboModuleMethodValueKind getTurboModuleMethodValueKind(
@@ -39,6 +44,159 @@ TurboModule::TurboModule(
     std::shared_ptr<CallInvoker> jsInvoker)
     : name_(std::move(name)), jsInvoker_(std::move(jsInvoker)) {}
 
+/*
+ * The host functions created for the methods of a module in a runtime.
+ */
+class TurboModule::PropertyCache : public LongLivedObject {
+ public:
+  PropertyCache(jsi::Runtime& runtime, bool asciiPropNameData)
+      : LongLivedObject(runtime), hasAsciiPropNameData(asciiPropNameData) {}
+
+  bool belongsTo(const jsi::Runtime& runtime) const {
+    return &runtime_ == &runtime;
+  }
+
+  // Whether the runtime hands over the contents of ASCII property names
+  // without converting them.
+  const bool hasAsciiPropNameData;
+
+  PropertyNameMap<jsi::Function> methods;
+};
+
+TurboModule::~TurboModule() {
+  // The cache holds JS values, so it must be released on the JS thread.
+  if (propertyCache_.expired()) {
+    return;
+  }
+  if (jsInvoker_) {
+    jsInvoker_->invokeAsync(
+        [propertyCache = std::move(propertyCache_)](jsi::Runtime& /*rt*/) {
+          if (auto cache = propertyCache.lock()) {
+            cache->allowRelease();
+          }
+        });
+  } else if (auto cache = propertyCache_.lock()) {
+    cache->allowRelease();
+  }
+}
+
+namespace {
+
+/*
+ * Longest property name which is matched without converting it to UTF-8.
+ */
+constexpr size_t kMaxInlinePropertyNameLength = 64;
+
+/*
+ * Whether the runtime implements `getPropNameIdData` natively. The default
+ * implementation of `jsi::Runtime` converts the name to UTF-8 and then to
+ * UTF-16, which is slower than `PropNameID::utf8`; it never reports ASCII
+ * data, which is what the probe checks.
+ */
+bool providesAsciiPropNameData(jsi::Runtime& runtime) {
+  auto probe = jsi::PropNameID::forAscii(runtime, "probe");
+  bool isAscii = false;
+  auto callback = [&](bool ascii, const void* /*data*/, size_t /*count*/) {
+    isAscii = ascii;
+  };
+  probe.getPropNameIdData(runtime, callback);
+  return isAscii;
+}
+
+/*
+ * Copies the ASCII contents of the given name into `buffer` and returns it,
+ * or returns `std::nullopt` if the name is too long or not ASCII-only.
+ */
+std::optional<std::string_view> asciiPropertyName(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName,
+    std::array<char, kMaxInlinePropertyNameLength>& buffer) {
+  size_t length = 0;
+  bool isAscii = true;
+  auto callback = [&](bool ascii, const void* data, size_t count) {
+    if (!isAscii || length + count > buffer.size()) {
+      isAscii = false;
+      return;
+    }
+    if (ascii) {
+      std::memcpy(buffer.data() + length, data, count);
+    } else {
+      const auto* characters = static_cast<const char16_t*>(data);
+      for (size_t index = 0; index < count; index++) {
+        if (characters[index] >= 0x80) {
+          isAscii = false;
+          return;
+        }
+        buffer[length + index] = static_cast<char>(characters[index]);
+      }
+    }
+    length += count;
+  };
+  propName.getPropNameIdData(runtime, callback);
+
+  if (!isAscii) {
+    return std::nullopt;
+  }
+  return std::string_view{buffer.data(), length};
+}
+
+} // namespace
+
+std::shared_ptr<TurboModule::PropertyCache> TurboModule::getPropertyCache(
+    jsi::Runtime& runtime) {
+  auto propertyCache = propertyCache_.lock();
+  if (!propertyCache || !propertyCache->belongsTo(runtime)) {
+    propertyCache = std::make_shared<PropertyCache>(
+        runtime, providesAsciiPropNameData(runtime));
+    LongLivedObjectCollection::get(runtime).add(propertyCache);
+    propertyCache_ = propertyCache;
+  }
+  return propertyCache;
+}
+
+jsi::Value TurboModule::createFromMaps(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName) {
+  auto propertyCache = getPropertyCache(runtime);
+
+  auto buffer = std::array<char, kMaxInlinePropertyNameLength>{};
+  auto asciiName = propertyCache->hasAsciiPropNameData
+      ? asciiPropertyName(runtime, propName, buffer)
+      : std::nullopt;
+  auto utf8Name = std::string{};
+  if (!asciiName) {
+    utf8Name = propName.utf8(runtime);
+  }
+  auto name = asciiName ? *asciiName : std::string_view{utf8Name};
+
+  if (auto methodIter = methodMap_.find(name); methodIter != methodMap_.end()) {
+    auto& methods = propertyCache->methods;
+    if (auto cachedIter = methods.find(name); cachedIter != methods.end()) {
+      return {runtime, cachedIter->second};
+    }
+
+    const MethodMetadata& meta = methodIter->second;
+    auto method = jsi::Function::createFromHostFunction(
+        runtime,
+        propName,
+        static_cast<unsigned int>(meta.argCount),
+        [this, invoker = meta.invoker](
+            jsi::Runtime& rt,
+            [[maybe_unused]] const jsi::Value& thisVal,
+            const jsi::Value* args,
+            size_t count) { return invoker(rt, *this, args, count); });
+    auto result = jsi::Value{runtime, method};
+    methods.emplace(methodIter->first, std::move(method));
+    return result;
+  } else if (auto eventEmitterIter = eventEmitterMap_.find(name);
+             eventEmitterIter != eventEmitterMap_.end()) {
+    return eventEmitterIter->second->get(runtime, jsInvoker_);
+  } else {
+    // Neither Method nor EventEmitter were found, let JS decide what to do
+    return jsi::Value::undefined();
+  }
+}
+
 void TurboModule::emitDeviceEvent(
     const std::string& eventName,
     ArgFactory&& argFactory) {
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <jsi/jsi.h>
@@ -46,6 +47,7 @@ class TurboModuleBinding;
 class JSI_EXPORT TurboModule : public jsi::HostObject {
  public:
   TurboModule(std::string name, std::shared_ptr<CallInvoker> jsInvoker);
+  ~TurboModule() override;
 
   // DO NOT OVERRIDE - it will become final in a future release.
   // This method provides automatic caching of properties on the TurboModule's
@@ -82,10 +84,27 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
     size_t argCount;
     jsi::Value (*invoker)(jsi::Runtime &rt, TurboModule &turboModule, const jsi::Value *args, size_t count);
   };
-  std::unordered_map<std::string, MethodMetadata> methodMap_;
+
+  /**
+   * Hash of property names which allows looking names up by
+   * `std::string_view`, without materializing an `std::string`.
+   */
+  struct PropertyNameHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view name) const
+    {
+      return std::hash<std::string_view>{}(name);
+    }
+  };
+
+  template <typename T>
+  using PropertyNameMap = std::unordered_map<std::string, T, PropertyNameHash, std::equal_to<>>;
+
+  PropertyNameMap<MethodMetadata> methodMap_;
 
   friend class TurboModuleTestFixtureInternal;
-  std::unordered_map<std::string, std::shared_ptr<IAsyncEventEmitter>> eventEmitterMap_;
+  PropertyNameMap<std::shared_ptr<IAsyncEventEmitter>> eventEmitterMap_;
 
   using ArgFactory = std::function<void(jsi::Runtime &runtime, std::vector<jsi::Value> &args)>;
 
@@ -115,29 +134,27 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
 
   virtual jsi::Value create(jsi::Runtime &runtime, const jsi::PropNameID &propName)
   {
-    std::string propNameUtf8 = propName.utf8(runtime);
-    if (auto methodIter = methodMap_.find(propNameUtf8); methodIter != methodMap_.end()) {
-      const MethodMetadata &meta = methodIter->second;
-      return jsi::Function::createFromHostFunction(
-          runtime,
-          propName,
-          static_cast<unsigned int>(meta.argCount),
-          [this, meta](
-              jsi::Runtime &rt, [[maybe_unused]] const jsi::Value &thisVal, const jsi::Value *args, size_t count) {
-            return meta.invoker(rt, *this, args, count);
-          });
-    } else if (auto eventEmitterIter = eventEmitterMap_.find(propNameUtf8);
-               eventEmitterIter != eventEmitterMap_.end()) {
-      return eventEmitterIter->second->get(runtime, jsInvoker_);
-    } else {
-      // Neither Method nor EventEmitter were found, let JS decide what to do
-      return jsi::Value::undefined();
-    }
+    return createFromMaps(runtime, propName);
   }
 
+  /**
+   * Returns the host function for a method from `methodMap_` or an event
+   * emitter from `eventEmitterMap_`. Host functions are created once per
+   * module and runtime. The name is matched without converting it to UTF-8
+   * when the runtime natively exposes its ASCII contents.
+   */
+  jsi::Value createFromMaps(jsi::Runtime &runtime, const jsi::PropNameID &propName);
+
  private:
   friend class TurboModuleBinding;
   std::unique_ptr<jsi::WeakObject> jsRepresentation_;
+
+  class PropertyCache;
+  // Owned by the runtime's `LongLivedObjectCollection`, which releases it
+  // before the runtime is destroyed.
+  std::weak_ptr<PropertyCache> propertyCache_;
+
+  std::shared_ptr<PropertyCache> getPropertyCache(jsi::Runtime &runtime);
 };
 
 /**
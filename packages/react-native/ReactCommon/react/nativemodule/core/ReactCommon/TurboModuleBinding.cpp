@@ -174,10 +174,7 @@ jsi::Value TurboModuleBinding::getModule(
 
     // Status: No jsRepresentation found on TurboModule
     // Create a brand new jsRepresentation, and attach it to TurboModule
-    jsi::Object jsRepresentation(runtime);
-    weakJsRepresentation =
-        std::make_unique<jsi::WeakObject>(runtime, jsRepresentation);
-
+    //
     // Lazily populate the jsRepresentation, on property access.
     //
     // How does this work?
@@ -187,9 +184,15 @@ jsi::Value TurboModuleBinding::getModule(
     //   3. TurboModule::get(runtime, propKey) executes. This creates the
     //   property, caches it on jsRepresentation, then returns it to
     //   JavaScript.
+    //
+    // The object is created with the prototype at once, which avoids setting
+    // `__proto__` by name afterwards.
     auto hostObject =
         jsi::Object::createFromHostObject(runtime, std::move(module));
-    jsRepresentation.setProperty(runtime, "__proto__", std::move(hostObject));
+    auto jsRepresentation =
+        jsi::Object::create(runtime, jsi::Value(std::move(hostObject)));
+    weakJsRepresentation =
+        std::make_unique<jsi::WeakObject>(runtime, jsRepresentation);
 
     return jsRepresentation;
   } else {
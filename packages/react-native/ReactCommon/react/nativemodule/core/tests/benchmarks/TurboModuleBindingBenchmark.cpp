@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kMethodCount = 200;
+
+static jsi::Value methodInvoker(
+    jsi::Runtime& /*rt*/,
+    TurboModule& /*turboModule*/,
+    const jsi::Value* /*args*/,
+    size_t count) {
+  return {static_cast<int>(count)};
+}
+
+static std::vector<std::string> createMethodNames() {
+  auto methodNames = std::vector<std::string>{};
+  methodNames.reserve(kMethodCount);
+  for (int i = 0; i < kMethodCount; i++) {
+    methodNames.push_back(
+        "trackAnalyticsEventWithIdentifier" + std::to_string(i));
+  }
+  return methodNames;
+}
+
+auto methodNames = createMethodNames();
+
+/*
+ * A module with many methods, like the analytics and storage modules.
+ */
+class ManyMethodsTurboModule : public TurboModule {
+ public:
+  ManyMethodsTurboModule() : TurboModule("ManyMethods", nullptr) {
+    methodMap_.reserve(methodNames.size());
+    for (const auto& methodName : methodNames) {
+      methodMap_[methodName] = MethodMetadata{1, methodInvoker};
+    }
+  }
+};
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+
+static jsi::Function evaluateFunction(const std::string& source) {
+  return runtime
+      ->evaluateJavaScript(std::make_shared<jsi::StringBuffer>(source), "")
+      .asObject(*runtime)
+      .asFunction(*runtime);
+}
+
+static void installBinding() {
+  static bool installed = false;
+  if (installed) {
+    return;
+  }
+  installed = true;
+
+  // Every lookup returns a new instance, as it happens on every launch.
+  TurboModuleBinding::install(*runtime, [](const std::string& name) {
+    return name == "ManyMethods" ? std::make_shared<ManyMethodsTurboModule>()
+                                 : nullptr;
+  });
+
+  auto names = jsi::Array(*runtime, methodNames.size());
+  for (size_t i = 0; i < methodNames.size(); i++) {
+    names.setValueAtIndex(
+        *runtime, i, jsi::String::createFromUtf8(*runtime, methodNames[i]));
+  }
+  runtime->global().setProperty(*runtime, "methodNames", names);
+}
+
+static void getModule(benchmark::State& state) {
+  installBinding();
+  auto getModuleFunction = evaluateFunction(
+      "(function() { return __turboModuleProxy('ManyMethods'); })");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getModuleFunction.call(*runtime));
+  }
+}
+BENCHMARK(getModule);
+
+static void getModuleAndCallEveryMethodOnce(benchmark::State& state) {
+  installBinding();
+  auto startupFunction = evaluateFunction(
+      "(function() { var module = __turboModuleProxy('ManyMethods');"
+      " var result = 0; for (var i = 0; i < methodNames.length; i++) {"
+      " result += module[methodNames[i]](i); } return result; })");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(startupFunction.call(*runtime));
+  }
+  state.SetItemsProcessed(state.iterations() * kMethodCount);
+}
+BENCHMARK(getModuleAndCallEveryMethodOnce);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
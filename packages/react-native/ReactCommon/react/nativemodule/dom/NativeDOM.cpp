@@ -181,7 +181,26 @@ jsi::Value NativeDOM::getElementById(
     return jsi::Value::undefined();
   }
 
-  auto elementById = dom::getElementById(currentRevision, id);
+  auto elementById = std::shared_ptr<const ShadowNode>{};
+  auto isIndexed = false;
+  if (currentRevision->getProps()->nativeId != id) {
+    // The shadow tree indexes its current revision, which is usually the one
+    // visible to JavaScript.
+    getUIManagerFromRuntime(rt).getShadowTreeRegistry().visit(
+        surfaceId, [&](const ShadowTree& shadowTree) {
+          auto indexedElementById =
+              shadowTree.findNodeByNativeId(*currentRevision, id);
+          if (indexedElementById) {
+            elementById = std::move(*indexedElementById);
+            isIndexed = true;
+          }
+        });
+  }
+
+  if (!isIndexed) {
+    elementById = dom::getElementById(currentRevision, id);
+  }
+
   if (elementById == nullptr) {
     return jsi::Value::undefined();
   }
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<f22bdf728cccaf9d95e62256f630ee1b>>
+ * @generated SignedSource<<835f500a7adfa48afae0c16ca4a1c399>>
  */
 
 /**
@@ -119,11 +119,26 @@ bool NativeReactNativeFeatureFlags::enableAndroidTextMeasurementOptimizations(
   return ReactNativeFeatureFlags::enableAndroidTextMeasurementOptimizations();
 }
 
+bool NativeReactNativeFeatureFlags::enableBackgroundCommits(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enableBackgroundCommits();
+}
+
+bool NativeReactNativeFeatureFlags::enableBackgroundDiffing(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enableBackgroundDiffing();
+}
+
 bool NativeReactNativeFeatureFlags::enableBridgelessArchitecture(
     jsi::Runtime& /*runtime*/) {
   return ReactNativeFeatureFlags::enableBridgelessArchitecture();
 }
 
+bool NativeReactNativeFeatureFlags::enableCoalescedTimers(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enableCoalescedTimers();
+}
+
 bool NativeReactNativeFeatureFlags::enableCppPropsIteratorSetter(
     jsi::Runtime& /*runtime*/) {
   return ReactNativeFeatureFlags::enableCppPropsIteratorSetter();
@@ -174,6 +189,11 @@ bool NativeReactNativeFeatureFlags::enableFontScaleChangesUpdatingLayout(
   return ReactNativeFeatureFlags::enableFontScaleChangesUpdatingLayout();
 }
 
+bool NativeReactNativeFeatureFlags::enableFrameDeadlineScheduling(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enableFrameDeadlineScheduling();
+}
+
 bool NativeReactNativeFeatureFlags::enableIOSTextBaselineOffsetPerLine(
     jsi::Runtime& /*runtime*/) {
   return ReactNativeFeatureFlags::enableIOSTextBaselineOffsetPerLine();
@@ -254,6 +274,11 @@ bool NativeReactNativeFeatureFlags::enableNetworkEventReporting(
   return ReactNativeFeatureFlags::enableNetworkEventReporting();
 }
 
+bool NativeReactNativeFeatureFlags::enablePersistentTextMeasureCache(
+    jsi::Runtime& /*runtime*/) {
+  return ReactNativeFeatureFlags::enablePersistentTextMeasureCache();
+}
+
 bool NativeReactNativeFeatureFlags::enablePreparedTextLayout(
     jsi::Runtime& /*runtime*/) {
   return ReactNativeFeatureFlags::enablePreparedTextLayout();
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<3caa7ab068af35b4b198bce5925dea1d>>
+ * @generated SignedSource<<4e56d225f4688f2a124045c11f3ba269>>
  */
 
 /**
@@ -66,8 +66,14 @@ class NativeReactNativeFeatureFlags
 
   bool enableAndroidTextMeasurementOptimizations(jsi::Runtime& runtime);
 
+  bool enableBackgroundCommits(jsi::Runtime& runtime);
+
+  bool enableBackgroundDiffing(jsi::Runtime& runtime);
+
   bool enableBridgelessArchitecture(jsi::Runtime& runtime);
 
+  bool enableCoalescedTimers(jsi::Runtime& runtime);
+
   bool enableCppPropsIteratorSetter(jsi::Runtime& runtime);
 
   bool enableCustomFocusSearchOnClippedElementsAndroid(jsi::Runtime& runtime);
@@ -88,6 +94,8 @@ class NativeReactNativeFeatureFlags
 
   bool enableFontScaleChangesUpdatingLayout(jsi::Runtime& runtime);
 
+  bool enableFrameDeadlineScheduling(jsi::Runtime& runtime);
+
   bool enableIOSTextBaselineOffsetPerLine(jsi::Runtime& runtime);
 
   bool enableIOSViewClipToPaddingBox(jsi::Runtime& runtime);
@@ -120,6 +128,8 @@ class NativeReactNativeFeatureFlags
 
   bool enableNetworkEventReporting(jsi::Runtime& runtime);
 
+  bool enablePersistentTextMeasureCache(jsi::Runtime& runtime);
+
   bool enablePreparedTextLayout(jsi::Runtime& runtime);
 
   bool enablePropsUpdateReconciliationAndroid(jsi::Runtime& runtime);
@@ -8,11 +8,13 @@
 #include "NativeAnimatedNodesManager.h"
 
 #include <cxxreact/TraceSection.h>
+#include <algorithm>
 #include <folly/json.h>
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/animated/drivers/AnimationDriver.h>
+#include <react/renderer/animated/drivers/AnimationDriverBatches.h>
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/drivers/DecayAnimationDriver.h>
 #include <react/renderer/animated/drivers/FrameAnimationDriver.h>
@@ -50,11 +52,6 @@ void g_setNativeAnimatedNowTimestampFunction(TimePointFunction nowFunction) {
 
 namespace {
 
-struct NodesQueueItem {
-  AnimatedNode* node;
-  bool connectedToFinishedAnimation;
-};
-
 void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
   react_native_assert(objectToMerge.isObject());
   if (out.isObject() && !out.empty()) {
@@ -66,6 +63,26 @@ void mergeObjects(folly::dynamic& out, const folly::dynamic& objectToMerge) {
   }
 }
 
+/*
+ * Merges the typed `props` into `out`: props of `out` which `props` sets again
+ * are replaced. Untyped props are merged as `folly::dynamic` before they are
+ * turned into `RawProps`, see `collectAnimationMutations`.
+ */
+void mergeAnimatedProps(AnimatedProps& out, AnimatedProps&& props) {
+  react_native_assert(props.rawProps == nullptr);
+  for (auto& prop : props.props) {
+    auto it = std::find_if(
+        out.props.begin(), out.props.end(), [&](const auto& existingProp) {
+          return existingProp->propName == prop->propName;
+        });
+    if (it != out.props.end()) {
+      *it = std::move(prop);
+    } else {
+      out.props.push_back(std::move(prop));
+    }
+  }
+}
+
 } // namespace
 
 thread_local bool NativeAnimatedNodesManager::isOnRenderThread_{false};
@@ -196,6 +213,7 @@ void NativeAnimatedNodesManager::createAnimatedNode(
     std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
     animatedNodes_.emplace(tag, std::move(node));
     updatedNodeTags_.insert(tag);
+    invalidateEvaluationPlan();
   }
 }
 
@@ -211,6 +229,7 @@ void NativeAnimatedNodesManager::connectAnimatedNodes(
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->addChild(childTag);
     updatedNodeTags_.insert(childTag);
+    invalidateEvaluationPlan();
   } else {
     LOG(WARNING) << "Cannot ConnectAnimatedNodes, parentTag = " << parentTag
                  << ", childTag = " << childTag
@@ -289,6 +308,7 @@ void NativeAnimatedNodesManager::disconnectAnimatedNodes(
 
   if ((parentNode != nullptr) && (childNode != nullptr)) {
     parentNode->removeChild(childTag);
+    invalidateEvaluationPlan();
   } else {
     LOG(WARNING) << "Cannot DisconnectAnimatedNodes, parentTag = " << parentTag
                  << ", childTag = " << childTag
@@ -305,6 +325,7 @@ void NativeAnimatedNodesManager::restoreDefaultValues(Tag tag) noexcept {
 void NativeAnimatedNodesManager::dropAnimatedNode(Tag tag) noexcept {
   std::lock_guard<std::mutex> lock(connectedAnimatedNodesMutex_);
   animatedNodes_.erase(tag);
+  invalidateEvaluationPlan();
 }
 
 #pragma mark - Mutations
@@ -601,186 +622,184 @@ bool NativeAnimatedNodesManager::isAnimationUpdateNeeded() const noexcept {
       isEventAnimationInProgress_;
 }
 
-void NativeAnimatedNodesManager::updateNodes(
-    const std::set<int>& finishedAnimationValueNodes) noexcept {
-  auto nodesQueue = std::deque<NodesQueueItem>{};
-
-  const auto is_node_connected_to_finished_animation =
-      [&finishedAnimationValueNodes](
-          AnimatedNode* node,
-          int nodeTag,
-          bool parentFinishedAnimation) -> bool {
-    return parentFinishedAnimation ||
-        (node->type() == AnimatedNodeType::Value &&
-         finishedAnimationValueNodes.contains(nodeTag));
-  };
-
-#ifdef REACT_NATIVE_DEBUG
-  int activeNodesCount = 0;
-  int updatedNodesCount = 0;
-#endif
-
-  // STEP 1.
-  // BFS over graph of nodes. Update `mIncomingNodes` attribute for each node
-  // during that BFS. Store number of visited nodes in `activeNodesCount`. We
-  // "execute" active animations as a part of this step.
+void NativeAnimatedNodesManager::invalidateEvaluationPlan() noexcept {
+  isEvaluationPlanValid_ = false;
+}
 
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
+void NativeAnimatedNodesManager::compileEvaluationPlan() {
+  TraceSection s(
+      "NativeAnimatedNodesManager::compileEvaluationPlan",
+      "numNodes",
+      animatedNodes_.size());
+
+  // Kahn's algorithm over the whole graph. Nodes which are part of a cycle
+  // (or are only reachable through one) never get sorted.
+  auto nodes = std::vector<AnimatedNode*>{};
+  nodes.reserve(animatedNodes_.size());
+  auto indices = std::unordered_map<Tag, uint32_t>{};
+  indices.reserve(animatedNodes_.size());
+  for (const auto& [tag, node] : animatedNodes_) {
+    indices.emplace(tag, static_cast<uint32_t>(nodes.size()));
+    nodes.push_back(node.get());
+  }
+
+  auto incomingEdges = std::vector<uint32_t>(nodes.size());
+  for (const auto* node : nodes) {
+    for (auto childTag : node->getChildren()) {
+      if (auto it = indices.find(childTag); it != indices.end()) {
+        incomingEdges[it->second]++;
+      }
+    }
   }
 
-  for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        activeNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+  auto order = std::vector<uint32_t>{};
+  order.reserve(nodes.size());
+  for (uint32_t index = 0; index < nodes.size(); index++) {
+    if (incomingEdges[index] == 0) {
+      order.push_back(index);
+    }
+  }
+  for (size_t i = 0; i < order.size(); i++) {
+    for (auto childTag : nodes[order[i]]->getChildren()) {
+      if (auto it = indices.find(childTag); it != indices.end()) {
+        if (--incomingEdges[it->second] == 0) {
+          order.push_back(it->second);
+        }
       }
     }
   }
 
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    // in Animated, value nodes like RGBA are parents and Color node is child
-    // (the opposite of tree structure)
-    for (const auto childTag : nextNode.node->getChildren()) {
-      auto child = getAnimatedNode<AnimatedNode>(childTag);
-      child->activeIncomingNodes++;
-      if (child->bfsColor != animatedGraphBFSColor_) {
-        child->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        activeNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(
-                child, childTag, nextNode.connectedToFinishedAnimation);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = child,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+  auto& plan = evaluationPlan_;
+  plan.nodes.clear();
+  plan.childrenOffsets.clear();
+  plan.children.clear();
+  plan.positions.clear();
+  plan.positions.reserve(order.size());
+  for (auto index : order) {
+    plan.positions.emplace(
+        nodes[index]->tag(), static_cast<uint32_t>(plan.nodes.size()));
+    plan.nodes.push_back(nodes[index]);
+  }
+  for (const auto* node : plan.nodes) {
+    plan.childrenOffsets.push_back(static_cast<uint32_t>(plan.children.size()));
+    for (auto childTag : node->getChildren()) {
+      if (auto it = plan.positions.find(childTag);
+          it != plan.positions.end()) {
+        plan.children.push_back(it->second);
       }
     }
   }
+  plan.childrenOffsets.push_back(static_cast<uint32_t>(plan.children.size()));
+  plan.numberOfSkippedNodes = nodes.size() - order.size();
 
-  // STEP 2
-  // BFS over the graph of active nodes in topological order -> visit node only
-  // when all its "predecessors" in the graph have already been visited. It is
-  // important to visit nodes in that order as they may often use values of
-  // their predecessors in order to calculate "next state" of their own. We
-  // start by determining the starting set of nodes by looking for nodes with
-  // `activeIncomingNodes = 0` (those can only be the ones that we start BFS in
-  // the previous step). We store number of visited nodes in this step in
-  // `updatedNodesCount`
+  nodeUpdateFlags_.assign(plan.nodes.size(), 0);
+  isEvaluationPlanValid_ = true;
+
+#ifdef REACT_NATIVE_DEBUG
+  // In Fabric there can be race conditions between the JS thread setting up
+  // or tearing down animated nodes, and Fabric executing them on the UI
+  // thread, leading to temporary inconsistent states.
+  if (plan.numberOfSkippedNodes > 0) {
+    if (!warnedAboutGraphTraversal_) {
+      warnedAboutGraphTraversal_ = true;
+      LOG(ERROR) << "Detected animation cycle. Looks like animated nodes "
+                 << "graph has cycles, " << plan.numberOfSkippedNodes
+                 << " of " << nodes.size() << " nodes can't be updated";
+    }
+  } else {
+    warnedAboutGraphTraversal_ = false;
+  }
+#endif
+}
 
-  animatedGraphBFSColor_++;
-  if (animatedGraphBFSColor_ == AnimatedNode::INITIAL_BFS_COLOR) {
-    animatedGraphBFSColor_++;
+void NativeAnimatedNodesManager::updateNodes(
+    const std::set<int>& finishedAnimationValueNodes) noexcept {
+  if (!isEvaluationPlanValid_) {
+    compileEvaluationPlan();
   }
+  const auto& plan = evaluationPlan_;
+
+  constexpr uint8_t kNeedsUpdate = 1 << 0;
+  constexpr uint8_t kConnectedToFinishedAnimation = 1 << 1;
 
+  const auto is_node_connected_to_finished_animation =
+      [&finishedAnimationValueNodes](const AnimatedNode* node) -> bool {
+    return node->type() == AnimatedNodeType::Value &&
+        finishedAnimationValueNodes.contains(node->tag());
+  };
+
+  // STEP 1.
+  // Mark the nodes which were updated directly. Only the nodes after the
+  // first of them in the topological order may need an update.
+  auto firstPosition = plan.nodes.size();
   for (const auto& nodeTag : updatedNodeTags_) {
-    if (auto node = getAnimatedNode<AnimatedNode>(nodeTag)) {
-      if (node->activeIncomingNodes == 0 &&
-          node->bfsColor != animatedGraphBFSColor_) {
-        node->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        updatedNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(node, nodeTag, false);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = node,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
+    if (auto it = plan.positions.find(nodeTag); it != plan.positions.end()) {
+      auto position = it->second;
+      nodeUpdateFlags_[position] |= kNeedsUpdate;
+      if (is_node_connected_to_finished_animation(plan.nodes[position])) {
+        nodeUpdateFlags_[position] |= kConnectedToFinishedAnimation;
       }
+      firstPosition = std::min<size_t>(firstPosition, position);
     }
   }
 
-// Run main "update" loop
-#ifdef REACT_NATIVE_DEBUG
-  int cyclesDetected = 0;
-#endif
-  while (!nodesQueue.empty()) {
-    auto nextNode = nodesQueue.front();
-    nodesQueue.pop_front();
-    if (nextNode.connectedToFinishedAnimation &&
-        nextNode.node->type() == AnimatedNodeType::Props) {
-      if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(nextNode.node)) {
+  // STEP 2
+  // Visit the nodes in topological order, so that every node is updated
+  // after all of its "predecessors" in the graph, as nodes often use values
+  // of their predecessors in order to calculate "next state" of their own.
+  // Updating a node marks its children as needing an update too. The flags
+  // are all reset by the end of the pass.
+  for (auto position = firstPosition; position < plan.nodes.size();
+       position++) {
+    auto flags = nodeUpdateFlags_[position];
+    if (flags == 0) {
+      continue;
+    }
+    nodeUpdateFlags_[position] = 0;
+
+    auto node = plan.nodes[position];
+    auto connectedToFinishedAnimation =
+        (flags & kConnectedToFinishedAnimation) != 0;
+    if (connectedToFinishedAnimation &&
+        node->type() == AnimatedNodeType::Props) {
+      if (auto propsNode = dynamic_cast<PropsAnimatedNode*>(node)) {
         propsNode->update(/*forceFabricCommit*/ true);
       };
     } else {
-      nextNode.node->update();
+      node->update();
     }
 
-    for (auto childTag : nextNode.node->getChildren()) {
-      auto child = getAnimatedNode<AnimatedNode>(childTag);
-      child->activeIncomingNodes--;
-      if (child->activeIncomingNodes == 0 &&
-          child->bfsColor != animatedGraphBFSColor_) {
-        child->bfsColor = animatedGraphBFSColor_;
-#ifdef REACT_NATIVE_DEBUG
-        updatedNodesCount++;
-#endif
-        const auto connectedToFinishedAnimation =
-            is_node_connected_to_finished_animation(
-                child, childTag, nextNode.connectedToFinishedAnimation);
-        nodesQueue.emplace_back(
-            NodesQueueItem{
-                .node = child,
-                .connectedToFinishedAnimation = connectedToFinishedAnimation});
-      }
-#ifdef REACT_NATIVE_DEBUG
-      else if (child->bfsColor == animatedGraphBFSColor_) {
-        cyclesDetected++;
+    for (auto i = plan.childrenOffsets[position];
+         i < plan.childrenOffsets[position + 1];
+         i++) {
+      auto childPosition = plan.children[i];
+      auto childFlags = kNeedsUpdate;
+      if (connectedToFinishedAnimation ||
+          (!finishedAnimationValueNodes.empty() &&
+           is_node_connected_to_finished_animation(
+               plan.nodes[childPosition]))) {
+        childFlags |= kConnectedToFinishedAnimation;
       }
-#endif
-    }
-  }
-
-#ifdef REACT_NATIVE_DEBUG
-  // Verify that we've visited *all* active nodes. Throw otherwise as this could
-  // mean there is a cycle in animated node graph, or that the graph is only
-  // partially set up. We also take advantage of the fact that all active nodes
-  // are visited in the step above so that all the nodes properties
-  // `activeIncomingNodes` are set to zero. In Fabric there can be race
-  // conditions between the JS thread setting up or tearing down animated nodes,
-  // and Fabric executing them on the UI thread, leading to temporary
-  // inconsistent states.
-  if (activeNodesCount != updatedNodesCount) {
-    if (warnedAboutGraphTraversal_) {
-      return;
+      nodeUpdateFlags_[childPosition] |= childFlags;
     }
-    warnedAboutGraphTraversal_ = true;
-    auto reason = cyclesDetected > 0
-        ? ("cycles (" + std::to_string(cyclesDetected) + ")")
-        : "disconnected regions";
-    LOG(ERROR) << "Detected animation cycle or disconnected graph. "
-               << "Looks like animated nodes graph has " << reason
-               << ", there are " << activeNodesCount
-               << " but toposort visited only " << updatedNodesCount;
-  } else {
-    warnedAboutGraphTraversal_ = false;
   }
-#endif
 
   updatedNodeTags_.clear();
 }
 
+void NativeAnimatedNodesManager::runAnimationSteps(double timestamp) {
+  if (!animationDriverBatches_) {
+    animationDriverBatches_ = std::make_unique<AnimationDriverBatches>();
+  }
+  animationDriverBatches_->runAnimationSteps(activeAnimations_, timestamp);
+}
+
 bool NativeAnimatedNodesManager::onAnimationFrame(double timestamp) {
   // Run all active animations
   auto hasFinishedAnimations = false;
   std::set<int> finishedAnimationValueNodes;
+  runAnimationSteps(timestamp);
   for (const auto& [_id, driver] : activeAnimations_) {
-    driver->runAnimationStep(timestamp);
-
     if (driver->getIsComplete()) {
       hasFinishedAnimations = true;
       finishedAnimationValueNodes.insert(driver->getAnimatedValueTag());
@@ -935,7 +954,74 @@ void NativeAnimatedNodesManager::schedulePropsCommit(
   }
 }
 
+void NativeAnimatedNodesManager::scheduleAnimatedPropsCommit(
+    Tag viewTag,
+    AnimatedProps&& props,
+    folly::dynamic&& untypedProps,
+    bool layoutStyleUpdated) noexcept {
+  auto& animatedProps = layoutStyleUpdated
+      ? updateViewAnimatedProps_[viewTag]
+      : updateViewAnimatedPropsDirect_[viewTag];
+  mergeAnimatedProps(animatedProps, std::move(props));
+
+  if (untypedProps.isObject()) {
+    auto& dynamicProps = layoutStyleUpdated ? updateViewProps_[viewTag]
+                                            : updateViewPropsDirect_[viewTag];
+    mergeObjects(dynamicProps, untypedProps);
+  }
+}
+
 #ifdef RN_USE_ANIMATION_BACKEND
+bool NativeAnimatedNodesManager::collectAnimationMutations(
+    AnimationMutations& mutations) {
+  auto containsChange = false;
+
+  // Each view's dynamic props were merged while they were scheduled, so they
+  // are converted to `RawProps` once per frame.
+  for (auto& [tag, props] : updateViewPropsDirect_) {
+    updateViewAnimatedPropsDirect_[tag].rawProps =
+        std::make_unique<RawProps>(std::move(props));
+  }
+  for (auto& [tag, props] : updateViewProps_) {
+    updateViewAnimatedProps_[tag].rawProps =
+        std::make_unique<RawProps>(std::move(props));
+  }
+  updateViewPropsDirect_.clear();
+  updateViewProps_.clear();
+
+  for (auto& [tag, props] : updateViewAnimatedPropsDirect_) {
+    mutations.push_back(
+        AnimationMutation{
+            .tag = tag,
+            .family = nullptr,
+            .props = std::move(props),
+        });
+    containsChange = true;
+  }
+  {
+    std::lock_guard<std::mutex> lock(tagToShadowNodeFamilyMutex_);
+    for (auto& [tag, props] : updateViewAnimatedProps_) {
+      auto familyIt = tagToShadowNodeFamily_.find(tag);
+      if (familyIt == tagToShadowNodeFamily_.end()) {
+        continue;
+      }
+      if (auto family = familyIt->second.lock()) {
+        mutations.push_back(
+            AnimationMutation{
+                .tag = tag,
+                .family = family,
+                .props = std::move(props),
+            });
+      }
+      containsChange = true;
+    }
+  }
+  updateViewAnimatedPropsDirect_.clear();
+  updateViewAnimatedProps_.clear();
+
+  return containsChange;
+}
+
 AnimationMutations NativeAnimatedNodesManager::pullAnimationMutations() {
   if (!ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
     return {};
@@ -968,15 +1054,13 @@ AnimationMutations NativeAnimatedNodesManager::pullAnimationMutations() {
 
     auto timestamp = static_cast<double>(microseconds) / 1000.0;
     bool containsChange = false;
-    AnimatedPropsBuilder propsBuilder;
     {
       // copied from onAnimationFrame
       // Run all active animations
       auto hasFinishedAnimations = false;
       std::set<int> finishedAnimationValueNodes;
+      runAnimationSteps(timestamp);
       for (const auto& [_id, driver] : activeAnimations_) {
-        driver->runAnimationStep(timestamp);
-
         if (driver->getIsComplete()) {
           hasFinishedAnimations = true;
           finishedAnimationValueNodes.insert(driver->getAnimatedValueTag());
@@ -1003,48 +1087,7 @@ AnimationMutations NativeAnimatedNodesManager::pullAnimationMutations() {
         }
       }
 
-      for (auto& [tag, props] : updateViewPropsDirect_) {
-        propsBuilder.storeDynamic(props);
-        mutations.push_back(
-            AnimationMutation{tag, nullptr, propsBuilder.get()});
-        containsChange = true;
-      }
-      {
-        std::lock_guard<std::mutex> lock(tagToShadowNodeFamilyMutex_);
-        for (auto& [tag, props] : updateViewProps_) {
-          auto familyIt = tagToShadowNodeFamily_.find(tag);
-          if (familyIt == tagToShadowNodeFamily_.end()) {
-            continue;
-          }
-          if (auto family = familyIt->second.lock()) {
-            // C++ Animated produces props in the form of a folly::dynamic, so
-            // it wouldn't make sense to unpack it here. However, for the
-            // purposes of testing, we want to be able to use the statically
-            // typed AnimationMutation. At a later stage we will instead just
-            // pass the dynamic directly to propsBuilder and the new API could
-            // be used by 3rd party libraries or in the fututre by Animated.
-            if (props.find("width") != props.items().end()) {
-              propsBuilder.setWidth(
-                  yoga::Style::SizeLength::points(props["width"].asDouble()));
-            }
-            if (props.find("height") != props.items().end()) {
-              propsBuilder.setHeight(
-                  yoga::Style::SizeLength::points(props["height"].asDouble()));
-            }
-            mutations.push_back(
-                AnimationMutation{
-                    .tag = tag,
-                    .family = family,
-                    .props = propsBuilder.get(),
-                });
-          }
-          containsChange = true;
-        }
-      }
-      if (containsChange) {
-        updateViewPropsDirect_.clear();
-        updateViewProps_.clear();
-      }
+      containsChange = collectAnimationMutations(mutations);
     }
 
     if (!containsChange) {
@@ -1070,33 +1113,7 @@ AnimationMutations NativeAnimatedNodesManager::pullAnimationMutations() {
 
       isEventAnimationInProgress_ = false;
 
-      for (auto& [tag, props] : updateViewPropsDirect_) {
-        propsBuilder.storeDynamic(props);
-        mutations.push_back(
-            AnimationMutation{
-                .tag = tag,
-                .family = nullptr,
-                .props = propsBuilder.get(),
-            });
-      }
-      {
-        std::lock_guard<std::mutex> lock(tagToShadowNodeFamilyMutex_);
-        for (auto& [tag, props] : updateViewProps_) {
-          auto familyIt = tagToShadowNodeFamily_.find(tag);
-          if (familyIt == tagToShadowNodeFamily_.end()) {
-            continue;
-          }
-          if (auto family = familyIt->second.lock()) {
-            propsBuilder.storeDynamic(props);
-            mutations.push_back(
-                AnimationMutation{
-                    .tag = tag,
-                    .family = family,
-                    .props = propsBuilder.get(),
-                });
-          }
-        }
-      }
+      collectAnimationMutations(mutations);
     }
   } else {
     // There is no active animation. Stop the render callback.
@@ -1136,6 +1153,7 @@ void NativeAnimatedNodesManager::onRender() {
         animatedNodes_.insert({tag, std::move(node)});
         updatedNodeTags_.insert(tag);
       }
+      invalidateEvaluationPlan();
     }
   }
 
@@ -17,6 +17,7 @@
 #include <react/debug/flags.h>
 #include <react/renderer/animated/EventEmitterListener.h>
 #include <react/renderer/animated/event_drivers/EventAnimationDriver.h>
+#include <react/renderer/animationbackend/AnimatedProps.h>
 #ifdef RN_USE_ANIMATION_BACKEND
 #include <react/renderer/animationbackend/AnimationBackend.h>
 #endif
@@ -40,6 +41,7 @@ void g_setNativeAnimatedNowTimestampFunction(TimePointFunction nowFunction);
 
 class AnimatedNode;
 class AnimationDriver;
+class AnimationDriverBatches;
 class Scheduler;
 
 using ValueListenerCallback = std::function<void(double)>;
@@ -155,6 +157,19 @@ class NativeAnimatedNodesManager {
       bool layoutStyleUpdated,
       bool forceFabricCommit) noexcept;
 
+  /*
+   * Typed counterpart of `schedulePropsCommit`, used with the shared
+   * animation backend. The typed props are passed on to the backend as they
+   * are, without a round trip through `folly::dynamic`. `untypedProps` (an
+   * object, or `nullptr`) are merged with the other pending dynamic props of
+   * the view and only become `RawProps` once the mutations are collected.
+   */
+  void scheduleAnimatedPropsCommit(
+      Tag viewTag,
+      AnimatedProps &&props,
+      folly::dynamic &&untypedProps,
+      bool layoutStyleUpdated) noexcept;
+
   /**
    * Commits all pending animated property updates to their respective views.
    *
@@ -201,6 +216,14 @@ class NativeAnimatedNodesManager {
  private:
   void stopRenderCallbackIfNeeded(bool isAsync) noexcept;
 
+#ifdef RN_USE_ANIMATION_BACKEND
+  /*
+   * Moves the props scheduled for commit into `mutations`. Returns whether
+   * there were any.
+   */
+  bool collectAnimationMutations(AnimationMutations &mutations);
+#endif
+
   bool onAnimationFrame(double timestamp);
 
   bool isAnimationUpdateNeeded() const noexcept;
@@ -211,6 +234,15 @@ class NativeAnimatedNodesManager {
 
   void handleAnimatedEvent(Tag tag, const std::string &eventName, const EventPayload &payload) noexcept;
 
+  void compileEvaluationPlan();
+
+  void invalidateEvaluationPlan() noexcept;
+
+  /*
+   * Runs a step of all active animations, batching the drivers by type.
+   */
+  void runAnimationSteps(double timestamp);
+
   std::weak_ptr<UIManagerAnimationBackend> animationBackend_;
 
   std::unique_ptr<AnimatedNode> animatedNode(Tag tag, const folly::dynamic &config) noexcept;
@@ -222,6 +254,7 @@ class NativeAnimatedNodesManager {
   std::unordered_map<Tag, std::unique_ptr<AnimatedNode>> animatedNodes_;
   std::unordered_map<Tag, Tag> connectedAnimatedNodes_;
   std::unordered_map<int, std::unique_ptr<AnimationDriver>> activeAnimations_;
+  std::unique_ptr<AnimationDriverBatches> animationDriverBatches_;
   std::unordered_map<
       EventAnimationDriverKey,
       std::vector<std::unique_ptr<EventAnimationDriver>>,
@@ -261,6 +294,9 @@ class NativeAnimatedNodesManager {
   std::unordered_map<Tag, folly::dynamic> updateViewProps_{};
   std::unordered_map<Tag, folly::dynamic> updateViewPropsDirect_{};
 
+  std::unordered_map<Tag, AnimatedProps> updateViewAnimatedProps_{};
+  std::unordered_map<Tag, AnimatedProps> updateViewAnimatedPropsDirect_{};
+
   mutable std::mutex tagToShadowNodeFamilyMutex_;
   std::unordered_map<Tag, std::weak_ptr<const ShadowNodeFamily>> tagToShadowNodeFamily_{};
 
@@ -274,7 +310,30 @@ class NativeAnimatedNodesManager {
   mutable std::mutex unsyncedDirectViewPropsMutex_;
   std::unordered_map<Tag, folly::dynamic> unsyncedDirectViewProps_{};
 
-  int animatedGraphBFSColor_ = 0;
+  /*
+   * The graph of animated nodes compiled into a flat topological order, so
+   * that `updateNodes` propagates values in a single pass over contiguous
+   * arrays instead of traversing the graph with tag lookups every frame.
+   * Compiled lazily, after the graph was changed.
+   */
+  struct EvaluationPlan {
+    // The nodes in topological order.
+    std::vector<AnimatedNode *> nodes;
+    // The positions (in `nodes`) of the children of `nodes[i]` are
+    // `children[childrenOffsets[i]]` to `children[childrenOffsets[i + 1] - 1]`.
+    std::vector<uint32_t> childrenOffsets;
+    std::vector<uint32_t> children;
+    std::unordered_map<Tag, uint32_t> positions;
+    // The number of nodes which are part of a cycle, or only reachable
+    // through one, and therefore are never updated.
+    size_t numberOfSkippedNodes{0};
+  };
+
+  EvaluationPlan evaluationPlan_;
+  bool isEvaluationPlanValid_{false};
+  // Whether the node at each position of the plan needs an update (and is
+  // connected to a finished animation) during `updateNodes`.
+  std::vector<uint8_t> nodeUpdateFlags_;
 #ifdef REACT_NATIVE_DEBUG
   bool warnedAboutGraphTraversal_ = false;
 #endif
@@ -36,12 +36,14 @@ AnimationDriver::AnimationDriver(
     Tag animatedValueTag,
     std::optional<AnimationEndCallback> endCallback,
     folly::dynamic config,
-    NativeAnimatedNodesManager* manager)
+    NativeAnimatedNodesManager* manager,
+    AnimationDriverType type)
     : endCallback_(std::move(endCallback)),
       id_(id),
       animatedValueTag_(animatedValueTag),
       manager_(manager),
-      config_(std::move(config)) {
+      config_(std::move(config)),
+      type_(type) {
   onConfigChanged();
 }
 
@@ -62,20 +64,30 @@ void AnimationDriver::stopAnimation(bool /*ignoreCompletedHandlers*/) {
 }
 
 void AnimationDriver::runAnimationStep(double renderingTime) {
+  auto restarting = false;
+  if (auto timeDeltaMs = beginAnimationStep(renderingTime, restarting)) {
+    endAnimationStep(update(*timeDeltaMs, restarting));
+  }
+}
+
+std::optional<double> AnimationDriver::beginAnimationStep(
+    double renderingTime,
+    bool& restarting) {
   if (!isStarted_ || isComplete_) {
-    return;
+    return std::nullopt;
   }
 
   const auto frameTimeMs = renderingTime;
-  auto restarting = false;
+  restarting = false;
   if (startFrameTimeMs_ < 0) {
     startFrameTimeMs_ = frameTimeMs;
     restarting = true;
   }
 
-  const auto timeDeltaMs = frameTimeMs - startFrameTimeMs_;
-  const auto isComplete = update(timeDeltaMs, restarting);
+  return frameTimeMs - startFrameTimeMs_;
+}
 
+void AnimationDriver::endAnimationStep(bool isComplete) {
   if (isComplete) {
     if (iterations_ == -1 || ++currentIteration_ < iterations_) {
       startFrameTimeMs_ = -1;
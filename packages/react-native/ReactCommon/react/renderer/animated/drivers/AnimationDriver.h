@@ -29,7 +29,8 @@ class AnimationDriver {
       Tag animatedValueTag,
       std::optional<AnimationEndCallback> endCallback,
       folly::dynamic config,
-      NativeAnimatedNodesManager *manager);
+      NativeAnimatedNodesManager *manager,
+      AnimationDriverType type);
   virtual ~AnimationDriver() = default;
   void startAnimation();
   void stopAnimation(bool ignoreCompletedHandlers = false);
@@ -49,6 +50,11 @@ class AnimationDriver {
     return isComplete_;
   }
 
+  AnimationDriverType getType() const noexcept
+  {
+    return type_;
+  }
+
   void runAnimationStep(double renderingTime);
 
   virtual void updateConfig(folly::dynamic config);
@@ -68,6 +74,14 @@ class AnimationDriver {
     return true;
   }
 
+  /*
+   * The halves of `runAnimationStep` around `update`, for drivers which are
+   * stepped in batches. Returns the time since the start of the current
+   * iteration, or `std::nullopt` if the animation isn't running.
+   */
+  std::optional<double> beginAnimationStep(double renderingTime, bool &restarting);
+  void endAnimationStep(bool isComplete);
+
   void markNodeUpdated(Tag tag)
   {
     manager_->updatedNodeTags_.insert(tag);
@@ -90,6 +104,8 @@ class AnimationDriver {
 
  private:
   void onConfigChanged();
+
+  AnimationDriverType type_;
 };
 
 } // namespace facebook::react
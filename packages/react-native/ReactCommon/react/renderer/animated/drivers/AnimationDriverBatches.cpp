@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationDriverBatches.h"
+
+namespace facebook::react {
+
+void AnimationDriverBatches::runAnimationSteps(
+    const std::unordered_map<int, std::unique_ptr<AnimationDriver>>& drivers,
+    double renderingTime) {
+  springDrivers_.clear();
+  decayDrivers_.clear();
+
+  for (const auto& [_id, driver] : drivers) {
+    switch (driver->getType()) {
+      case AnimationDriverType::Spring:
+        springDrivers_.push_back(
+            static_cast<SpringAnimationDriver*>(driver.get()));
+        break;
+      case AnimationDriverType::Decay:
+        decayDrivers_.push_back(
+            static_cast<DecayAnimationDriver*>(driver.get()));
+        break;
+      case AnimationDriverType::Frames:
+        // Frame animations look up their own keyframes, so there is little
+        // to share between them.
+        driver->runAnimationStep(renderingTime);
+        break;
+    }
+  }
+
+  springBatch_.runAnimationSteps(springDrivers_, renderingTime);
+  decayBatch_.runAnimationSteps(decayDrivers_, renderingTime);
+}
+
+} // namespace facebook::react
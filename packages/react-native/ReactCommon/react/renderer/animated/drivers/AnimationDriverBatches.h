@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/animated/drivers/DecayAnimationDriver.h>
+#include <react/renderer/animated/drivers/SpringAnimationDriver.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Runs the steps of active animations grouped by the type of their drivers,
+ * so that all spring and all decay animations are each stepped in a single
+ * batch instead of one virtual call at a time.
+ */
+class AnimationDriverBatches {
+ public:
+  void runAnimationSteps(
+      const std::unordered_map<int, std::unique_ptr<AnimationDriver>> &drivers,
+      double renderingTime);
+
+ private:
+  std::vector<SpringAnimationDriver *> springDrivers_;
+  std::vector<DecayAnimationDriver *> decayDrivers_;
+  SpringAnimationDriver::Batch springBatch_;
+  DecayAnimationDriver::Batch decayBatch_;
+};
+
+} // namespace facebook::react
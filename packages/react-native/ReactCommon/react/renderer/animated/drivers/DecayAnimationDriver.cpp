@@ -12,6 +12,7 @@
 #include "DecayAnimationDriver.h"
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
+#include <cmath>
 
 namespace facebook::react {
 DecayAnimationDriver::DecayAnimationDriver(
@@ -25,57 +26,123 @@ DecayAnimationDriver::DecayAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           std::move(config),
-          manager),
+          manager,
+          AnimationDriverType::Decay),
       velocity_(config_["velocity"].asDouble()),
       deceleration_(config_["deceleration"].asDouble()) {
   react_native_assert(deceleration_ > 0);
 }
 
-std::tuple<float, double> DecayAnimationDriver::getValueAndVelocityForTime(
-    double time) const {
-  const auto value = fromValue_.value() +
-      velocity_ / (1 - deceleration_) *
-          (1 - std::exp(-(1 - deceleration_) * (1000 * time)));
-  return std::make_tuple(
-      static_cast<float>(value),
-      42.0f); // we don't need the velocity, so set it to a dummy value
+namespace {
+
+// The value of a decay curve at `time` (in seconds).
+inline float getDecayValue(
+    double time,
+    double fromValue,
+    double velocity,
+    double deceleration) {
+  const auto value = fromValue +
+      velocity / (1 - deceleration) *
+          (1 - std::exp(-(1 - deceleration) * (1000 * time)));
+  return static_cast<float>(value);
 }
 
-bool DecayAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      const auto value = node->getRawValue();
-      if (!fromValue_.has_value()) {
-        // First iteration, assign fromValue based on AnimatedValue
-        fromValue_ = value;
-      } else {
-        // Not the first iteration, reset AnimatedValue based on
-        // originalValue
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+} // namespace
+
+void DecayAnimationDriver::Batch::runAnimationSteps(
+    const std::vector<DecayAnimationDriver*>& drivers,
+    double renderingTime) {
+  drivers_.clear();
+  nodes_.clear();
+  restarting_.clear();
+  times_.clear();
+  fromValues_.clear();
+  velocities_.clear();
+  decelerations_.clear();
 
-      lastValue_ = value;
+  for (auto* driver : drivers) {
+    auto restarting = false;
+    auto timeDeltaMs = driver->beginAnimationStep(renderingTime, restarting);
+    if (!timeDeltaMs) {
+      continue;
     }
+    auto* node = driver->beginUpdate(restarting);
+    if (node == nullptr) {
+      driver->endAnimationStep(true);
+      continue;
+    }
+    drivers_.push_back(driver);
+    nodes_.push_back(node);
+    restarting_.push_back(restarting);
+    times_.push_back(*timeDeltaMs / 1000.0);
+    fromValues_.push_back(driver->fromValue_.value());
+    velocities_.push_back(driver->velocity_);
+    decelerations_.push_back(driver->deceleration_);
+  }
 
-    const auto [value, velocity] =
-        getValueAndVelocityForTime(timeDeltaMs / 1000.0);
-    auto isComplete =
-        lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
-    if (!restarting && isComplete) {
-      return true;
+  const auto size = drivers_.size();
+  values_.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    values_[i] = getDecayValue(
+        times_[i], fromValues_[i], velocities_[i], decelerations_[i]);
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    drivers_[i]->endAnimationStep(drivers_[i]->endUpdate(
+        *nodes_[i], values_[i], restarting_[i] != 0));
+  }
+}
+
+bool DecayAnimationDriver::update(double timeDeltaMs, bool restarting) {
+  if (auto* node = beginUpdate(restarting)) {
+    const auto value = getDecayValue(
+        timeDeltaMs / 1000.0, fromValue_.value(), velocity_, deceleration_);
+    return endUpdate(*node, value, restarting);
+  }
+
+  return true;
+}
+
+ValueAnimatedNode* DecayAnimationDriver::beginUpdate(bool restarting) {
+  auto node = manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (node == nullptr) {
+    return nullptr;
+  }
+
+  if (restarting) {
+    const auto value = node->getRawValue();
+    if (!fromValue_.has_value()) {
+      // First iteration, assign fromValue based on AnimatedValue
+      fromValue_ = value;
     } else {
-      lastValue_ = value;
-      if (node->setRawValue(value)) {
+      // Not the first iteration, reset AnimatedValue based on
+      // originalValue
+      if (node->setRawValue(fromValue_.value())) {
         markNodeUpdated(node->tag());
       }
-      return false;
     }
+
+    lastValue_ = value;
   }
 
-  return true;
+  return node;
+}
+
+bool DecayAnimationDriver::endUpdate(
+    ValueAnimatedNode& node,
+    float value,
+    bool restarting) {
+  auto isComplete =
+      lastValue_.has_value() && std::abs(value - lastValue_.value()) < 0.1;
+  if (!restarting && isComplete) {
+    return true;
+  } else {
+    lastValue_ = value;
+    if (node.setRawValue(value)) {
+      markNodeUpdated(node.tag());
+    }
+    return false;
+  }
 }
 
 } // namespace facebook::react
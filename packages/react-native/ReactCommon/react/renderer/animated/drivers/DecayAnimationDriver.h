@@ -13,8 +13,13 @@
 
 #include "AnimationDriver.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace facebook::react {
 
+class ValueAnimatedNode;
+
 class DecayAnimationDriver : public AnimationDriver {
  public:
   DecayAnimationDriver(
@@ -24,11 +29,37 @@ class DecayAnimationDriver : public AnimationDriver {
       folly::dynamic config,
       NativeAnimatedNodesManager *manager);
 
+  /*
+   * Runs a step of a number of decay animations at once, with the same
+   * results as `runAnimationStep` for each of them, evaluating their curves
+   * in a single loop over structure of arrays (see
+   * `SpringAnimationDriver::Batch`).
+   */
+  class Batch {
+   public:
+    void runAnimationSteps(const std::vector<DecayAnimationDriver *> &drivers, double renderingTime);
+
+   private:
+    std::vector<DecayAnimationDriver *> drivers_;
+    std::vector<ValueAnimatedNode *> nodes_;
+    std::vector<uint8_t> restarting_;
+    std::vector<double> times_;
+    std::vector<double> fromValues_;
+    std::vector<double> velocities_;
+    std::vector<double> decelerations_;
+    std::vector<float> values_;
+  };
+
  protected:
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
-  std::tuple<float, double> getValueAndVelocityForTime(double time) const;
+  /*
+   * The parts of `update` before and after evaluating the curve. Returns the
+   * animated node, or `nullptr` if it's gone.
+   */
+  ValueAnimatedNode *beginUpdate(bool restarting);
+  bool endUpdate(ValueAnimatedNode &node, float value, bool restarting);
 
  private:
   double velocity_{0};
@@ -31,7 +31,8 @@ FrameAnimationDriver::FrameAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           std::move(config),
-          manager) {
+          manager,
+          AnimationDriverType::Frames) {
   onConfigChanged();
 }
 
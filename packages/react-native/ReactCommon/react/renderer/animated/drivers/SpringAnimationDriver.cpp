@@ -12,6 +12,7 @@
 #include "SpringAnimationDriver.h"
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
+#include <cmath>
 
 namespace facebook::react {
 
@@ -28,7 +29,8 @@ SpringAnimationDriver::SpringAnimationDriver(
           animatedValueTag,
           std::move(endCallback),
           std::move(config),
-          manager),
+          manager,
+          AnimationDriverType::Spring),
       springStiffness_(config_["stiffness"].asDouble()),
       springDamping_(config_["damping"].asDouble()),
       springMass_(config_["mass"].asDouble()),
@@ -39,94 +41,201 @@ SpringAnimationDriver::SpringAnimationDriver(
           config_["restDisplacementThreshold"].asDouble()),
       overshootClampingEnabled_(config_["overshootClamping"].asBool()) {}
 
-std::tuple<float, double> SpringAnimationDriver::getValueAndVelocityForTime(
-    double time) const {
-  const auto startValue = fromValue_.value();
-  const auto toValue = endValue_;
-  const auto c = springDamping_;
-  const auto m = springMass_;
-  const auto k = springStiffness_;
-  const auto v0 = -initialVelocity_;
-
-  const auto zeta = c / (2 * std::sqrt(k * m));
-  const auto omega0 = std::sqrt(k / m);
-  const auto omega1 = omega0 * std::sqrt(1.0 - (zeta * zeta));
-  const auto x0 = toValue - startValue;
+namespace {
 
+/*
+ * Evaluates a spring curve at `time` (in seconds). Used by both
+ * `SpringAnimationDriver::update` and `SpringAnimationDriver::Batch`, which
+ * keeps their results identical.
+ */
+inline void getSpringValueAndVelocity(
+    double time,
+    double toValue,
+    double x0,
+    double v0,
+    double zeta,
+    double omega0,
+    double omega1,
+    float& value,
+    double& velocity) {
   if (zeta < 1) {
     const auto envelope = std::exp(-zeta * omega0 * time);
-    const auto value = static_cast<float>(
+    value = static_cast<float>(
         toValue -
         envelope *
             ((v0 + zeta * omega0 * x0) / omega1 * std::sin(omega1 * time) +
              x0 * std::cos(omega1 * time)));
-    const auto velocity = zeta * omega0 * envelope *
+    velocity = zeta * omega0 * envelope *
             (std::sin(omega1 * time) * (v0 + zeta * omega0 * x0) / omega1 +
              x0 * std::cos(omega1 * time)) -
         envelope *
             (std::cos(omega1 * time) * (v0 + zeta * omega0 * x0) -
              omega1 * x0 * std::sin(omega1 * time));
-    return std::make_tuple(value, velocity);
   } else {
     const auto envelope = std::exp(-omega0 * time);
-    const auto value = static_cast<float>(
-        endValue_ - envelope * (x0 + (v0 + omega0 * x0) * time));
-    const auto velocity =
+    value = static_cast<float>(
+        toValue - envelope * (x0 + (v0 + omega0 * x0) * time));
+    velocity =
         envelope * (v0 * (time * omega0 - 1) + time * x0 * (omega0 * omega0));
-    return std::make_tuple(value, velocity);
   }
 }
 
-bool SpringAnimationDriver::update(double timeDeltaMs, bool restarting) {
-  if (const auto node =
-          manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_)) {
-    if (restarting) {
-      if (!fromValue_.has_value()) {
-        fromValue_ = node->getRawValue();
-      } else {
-        if (node->setRawValue(fromValue_.value())) {
-          markNodeUpdated(node->tag());
-        }
-      }
+} // namespace
 
-      // Spring animations run a frame behind JS driven animations if we do
-      // not start the first frame at 16ms.
-      lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
-      timeAccumulator_ = 0.0;
-    }
+void SpringAnimationDriver::Batch::runAnimationSteps(
+    const std::vector<SpringAnimationDriver*>& drivers,
+    double renderingTime) {
+  drivers_.clear();
+  nodes_.clear();
+  times_.clear();
+  toValues_.clear();
+  displacements_.clear();
+  initialVelocities_.clear();
+  dampingRatios_.clear();
+  naturalFrequencies_.clear();
+  dampedFrequencies_.clear();
 
-    // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
-    // We should be able to catch up in a subsequent advance if necessary.
-    auto adjustedDeltaTime = timeDeltaMs - lastTime_;
-    if (adjustedDeltaTime > MaxDeltaTimeMs) {
-      adjustedDeltaTime = MaxDeltaTimeMs;
+  // Advance the clocks of the springs, gathering the curves to evaluate.
+  for (auto* driver : drivers) {
+    auto restarting = false;
+    auto timeDeltaMs = driver->beginAnimationStep(renderingTime, restarting);
+    if (!timeDeltaMs) {
+      continue;
     }
-    timeAccumulator_ += adjustedDeltaTime;
-    lastTime_ = timeDeltaMs;
-
-    auto [value, velocity] =
-        getValueAndVelocityForTime(timeAccumulator_ / 1000.0);
-
-    auto isComplete = false;
-    if (isAtRest(velocity, value, endValue_) ||
-        (overshootClampingEnabled_ && isOvershooting(value))) {
-      if (springStiffness_ > 0) {
-        value = static_cast<float>(endValue_);
-      } else {
-        endValue_ = value;
-      }
+    auto* node = driver->beginUpdate(*timeDeltaMs, restarting);
+    if (node == nullptr) {
+      driver->endAnimationStep(true);
+      continue;
+    }
+    const auto& curve = driver->curve_;
+    drivers_.push_back(driver);
+    nodes_.push_back(node);
+    times_.push_back(driver->timeAccumulator_ / 1000.0);
+    toValues_.push_back(curve.toValue);
+    displacements_.push_back(curve.displacement);
+    initialVelocities_.push_back(curve.initialVelocity);
+    dampingRatios_.push_back(curve.dampingRatio);
+    naturalFrequencies_.push_back(curve.naturalFrequency);
+    dampedFrequencies_.push_back(curve.dampedFrequency);
+  }
+
+  // Evaluate all the curves.
+  const auto size = drivers_.size();
+  values_.resize(size);
+  velocities_.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    getSpringValueAndVelocity(
+        times_[i],
+        toValues_[i],
+        displacements_[i],
+        initialVelocities_[i],
+        dampingRatios_[i],
+        naturalFrequencies_[i],
+        dampedFrequencies_[i],
+        values_[i],
+        velocities_[i]);
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    drivers_[i]->endAnimationStep(
+        drivers_[i]->endUpdate(*nodes_[i], values_[i], velocities_[i]));
+  }
+}
 
-      isComplete = true;
+SpringAnimationDriver::Curve SpringAnimationDriver::getCurve() const {
+  const auto startValue = fromValue_.value();
+  const auto c = springDamping_;
+  const auto m = springMass_;
+  const auto k = springStiffness_;
+
+  const auto zeta = c / (2 * std::sqrt(k * m));
+  const auto omega0 = std::sqrt(k / m);
+  return Curve{
+      .toValue = endValue_,
+      .displacement = endValue_ - startValue,
+      .initialVelocity = -initialVelocity_,
+      .dampingRatio = zeta,
+      .naturalFrequency = omega0,
+      .dampedFrequency = omega0 * std::sqrt(1.0 - (zeta * zeta))};
+}
+
+bool SpringAnimationDriver::update(double timeDeltaMs, bool restarting) {
+  if (auto* node = beginUpdate(timeDeltaMs, restarting)) {
+    float value = 0;
+    double velocity = 0;
+    getSpringValueAndVelocity(
+        timeAccumulator_ / 1000.0,
+        curve_.toValue,
+        curve_.displacement,
+        curve_.initialVelocity,
+        curve_.dampingRatio,
+        curve_.naturalFrequency,
+        curve_.dampedFrequency,
+        value,
+        velocity);
+    return endUpdate(*node, value, velocity);
+  }
+
+  return true;
+}
+
+ValueAnimatedNode* SpringAnimationDriver::beginUpdate(
+    double timeDeltaMs,
+    bool restarting) {
+  auto node = manager_->getAnimatedNode<ValueAnimatedNode>(animatedValueTag_);
+  if (node == nullptr) {
+    return nullptr;
+  }
+
+  if (restarting) {
+    if (!fromValue_.has_value()) {
+      fromValue_ = node->getRawValue();
+    } else {
+      if (node->setRawValue(fromValue_.value())) {
+        markNodeUpdated(node->tag());
+      }
     }
+    curve_ = getCurve();
+
+    // Spring animations run a frame behind JS driven animations if we do
+    // not start the first frame at 16ms.
+    lastTime_ = timeDeltaMs - SingleFrameIntervalMs;
+    timeAccumulator_ = 0.0;
+  }
+
+  // clamp the amount of timeDeltaMs to avoid stuttering in the UI.
+  // We should be able to catch up in a subsequent advance if necessary.
+  auto adjustedDeltaTime = timeDeltaMs - lastTime_;
+  if (adjustedDeltaTime > MaxDeltaTimeMs) {
+    adjustedDeltaTime = MaxDeltaTimeMs;
+  }
+  timeAccumulator_ += adjustedDeltaTime;
+  lastTime_ = timeDeltaMs;
 
-    if (node->setRawValue(value)) {
-      markNodeUpdated(node->tag());
+  return node;
+}
+
+bool SpringAnimationDriver::endUpdate(
+    ValueAnimatedNode& node,
+    float value,
+    double velocity) {
+  auto isComplete = false;
+  if (isAtRest(velocity, value, endValue_) ||
+      (overshootClampingEnabled_ && isOvershooting(value))) {
+    if (springStiffness_ > 0) {
+      value = static_cast<float>(endValue_);
+    } else {
+      endValue_ = value;
     }
 
-    return isComplete;
+    isComplete = true;
   }
 
-  return true;
+  if (node.setRawValue(value)) {
+    markNodeUpdated(node.tag());
+  }
+
+  return isComplete;
 }
 
 bool SpringAnimationDriver::isAtRest(
@@ -13,8 +13,12 @@
 
 #include "AnimationDriver.h"
 
+#include <vector>
+
 namespace facebook::react {
 
+class ValueAnimatedNode;
+
 class SpringAnimationDriver : public AnimationDriver {
  public:
   SpringAnimationDriver(
@@ -24,11 +28,56 @@ class SpringAnimationDriver : public AnimationDriver {
       folly::dynamic config,
       NativeAnimatedNodesManager *manager);
 
+  /*
+   * Runs a step of a number of spring animations at once, with the same
+   * results as `runAnimationStep` for each of them. The springs are evaluated
+   * in a single loop over their curves stored as structure of arrays, without
+   * virtual calls or node lookups, which compilers can vectorize.
+   * The arrays are kept between steps to not allocate them every frame.
+   */
+  class Batch {
+   public:
+    void runAnimationSteps(const std::vector<SpringAnimationDriver *> &drivers, double renderingTime);
+
+   private:
+    std::vector<SpringAnimationDriver *> drivers_;
+    std::vector<ValueAnimatedNode *> nodes_;
+    std::vector<double> times_;
+    std::vector<double> toValues_;
+    std::vector<double> displacements_;
+    std::vector<double> initialVelocities_;
+    std::vector<double> dampingRatios_;
+    std::vector<double> naturalFrequencies_;
+    std::vector<double> dampedFrequencies_;
+    std::vector<float> values_;
+    std::vector<double> velocities_;
+  };
+
  protected:
   bool update(double timeDeltaMs, bool restarting) override;
 
  private:
-  std::tuple<float, double> getValueAndVelocityForTime(double time) const;
+  /*
+   * The coefficients of the closed-form solution of the spring equation,
+   * which only change when an iteration of the animation starts.
+   */
+  struct Curve {
+    double toValue{0};
+    double displacement{0};
+    double initialVelocity{0};
+    double dampingRatio{0};
+    double naturalFrequency{0};
+    double dampedFrequency{0};
+  };
+
+  /*
+   * The parts of `update` before and after evaluating the spring. Returns the
+   * animated node, or `nullptr` if it's gone.
+   */
+  ValueAnimatedNode *beginUpdate(double timeDeltaMs, bool restarting);
+  bool endUpdate(ValueAnimatedNode &node, float value, double velocity);
+
+  Curve getCurve() const;
   bool isAtRest(double currentVelocity, double currentValue, double endValue) const;
   bool isOvershooting(double currentValue) const;
 
@@ -44,6 +93,8 @@ class SpringAnimationDriver : public AnimationDriver {
 
   double lastTime_{0};
   double timeAccumulator_{0};
+
+  Curve curve_{};
 };
 
 } // namespace facebook::react
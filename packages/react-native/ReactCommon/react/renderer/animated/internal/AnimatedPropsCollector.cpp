@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimatedPropsCollector.h"
+
+#include <utility>
+
+namespace facebook::react {
+
+void AnimatedPropsCollector::setValue(
+    const std::string& propName,
+    double value,
+    bool isColor) {
+  if (isColor) {
+    // `backgroundColor` is the only color the animation backend can clone
+    // into `BaseViewProps`; the others (e.g. `borderColor`, `shadowColor`)
+    // stay untyped until it supports them.
+    if (propName == "backgroundColor") {
+      builder_.setBackgroundColor(
+          SharedColor{static_cast<Color>(static_cast<int32_t>(value))});
+      return;
+    }
+    getUntypedProps().insert(propName, static_cast<int32_t>(value));
+    return;
+  }
+
+  if (propName == "opacity") {
+    builder_.setOpacity(static_cast<Float>(value));
+  } else if (propName == "width") {
+    builder_.setWidth(yoga::Style::SizeLength::points(value));
+  } else if (propName == "height") {
+    builder_.setHeight(yoga::Style::SizeLength::points(value));
+  } else {
+    getUntypedProps().insert(propName, value);
+  }
+}
+
+void AnimatedPropsCollector::setTransform(Transform&& transform) {
+  builder_.setTransform(transform);
+}
+
+folly::dynamic& AnimatedPropsCollector::getUntypedProps() {
+  if (untypedProps_.isNull()) {
+    untypedProps_ = folly::dynamic::object();
+  }
+  return untypedProps_;
+}
+
+AnimatedProps AnimatedPropsCollector::get() {
+  return builder_.get();
+}
+
+folly::dynamic AnimatedPropsCollector::takeUntypedProps() {
+  return std::exchange(untypedProps_, nullptr);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/animationbackend/AnimatedProps.h>
+#include <react/renderer/animationbackend/AnimatedPropsBuilder.h>
+#include <react/renderer/graphics/Transform.h>
+#include <string>
+
+namespace facebook::react {
+
+/*
+ * Collects the props that animated nodes compute for a view as typed
+ * `AnimatedProps`. The props which have no typed representation are collected
+ * into a `folly::dynamic` object, which is only created if there are any, and
+ * stay in that form until they are handed to the animation backend.
+ */
+class AnimatedPropsCollector {
+ public:
+  /*
+   * Sets a prop computed by a value (or color) node.
+   */
+  void setValue(const std::string &propName, double value, bool isColor);
+
+  void setTransform(Transform &&transform);
+
+  /*
+   * The props without a typed representation, e.g. the ones computed by
+   * `ObjectAnimatedNode`.
+   */
+  folly::dynamic &getUntypedProps();
+
+  /*
+   * Moves the typed props out of the collector.
+   */
+  AnimatedProps get();
+
+  /*
+   * Moves the untyped props out of the collector; `nullptr` if there are
+   * none.
+   */
+  folly::dynamic takeUntypedProps();
+
+ private:
+  AnimatedPropsBuilder builder_;
+  folly::dynamic untypedProps_{nullptr};
+};
+
+} // namespace facebook::react
@@ -12,7 +12,7 @@
 
 namespace facebook::react {
 
-inline static std::unordered_set<std::string> getDirectManipulationAllowlist()
+inline static const std::unordered_set<std::string> &getDirectManipulationAllowlist()
 {
   /**
    * Direct manipulation eligible styles allowed by the NativeAnimated JS
@@ -93,11 +93,6 @@ class AnimatedNode {
 
   static std::optional<AnimatedNodeType> getNodeTypeByName(const std::string &nodeTypeName);
 
-  int activeIncomingNodes = 0;
-  int bfsColor = 0;
-
-  static constexpr int INITIAL_BFS_COLOR = 0;
-
  protected:
   AnimatedNode *getChildNode(Tag tag);
   Tag tag_{0};
@@ -12,7 +12,9 @@
 #include "PropsAnimatedNode.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/internal/AnimatedPropsCollector.h>
 #include <react/renderer/animated/nodes/ColorAnimatedNode.h>
 #include <react/renderer/animated/nodes/ObjectAnimatedNode.h>
 #include <react/renderer/animated/nodes/StyleAnimatedNode.h>
@@ -88,6 +90,12 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
     return;
   }
 
+#ifdef RN_USE_ANIMATION_BACKEND
+  if (ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
+    return updateAnimatedProps();
+  }
+#endif
+
   // TODO: T190192206 consolidate shared update logic between
   // Props/StyleAnimatedNode
   std::lock_guard<std::mutex> lock(propsMutex_);
@@ -151,4 +159,66 @@ void PropsAnimatedNode::update(bool forceFabricCommit) {
       connectedViewTag_, props_, layoutStyleUpdated_, forceFabricCommit);
 }
 
+void PropsAnimatedNode::updateAnimatedProps() {
+  auto props = AnimatedPropsCollector{};
+  const auto& configProps = getConfig()["props"];
+  for (const auto& entry : configProps.items()) {
+    auto propName = entry.first.asString();
+    auto nodeTag = static_cast<Tag>(entry.second.asInt());
+    if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
+      switch (node->type()) {
+        case AnimatedNodeType::Value:
+        case AnimatedNodeType::Interpolation:
+        case AnimatedNodeType::Modulus:
+        case AnimatedNodeType::Round:
+        case AnimatedNodeType::Diffclamp:
+        // Operators
+        case AnimatedNodeType::Addition:
+        case AnimatedNodeType::Subtraction:
+        case AnimatedNodeType::Multiplication:
+        case AnimatedNodeType::Division: {
+          if (const auto& valueNode =
+                  manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
+            props.setValue(
+                propName, valueNode->getValue(), valueNode->getIsColorValue());
+          }
+        } break;
+        case AnimatedNodeType::Color: {
+          if (const auto& colorNode =
+                  manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
+            props.setValue(
+                propName,
+                static_cast<int32_t>(colorNode->getColor()),
+                /* isColor */ true);
+          }
+        } break;
+        case AnimatedNodeType::Style: {
+          if (const auto& styleNode =
+                  manager_->getAnimatedNode<StyleAnimatedNode>(nodeTag)) {
+            styleNode->collectViewUpdates(props);
+          }
+        } break;
+        case AnimatedNodeType::Object: {
+          if (const auto objectNode =
+                  manager_->getAnimatedNode<ObjectAnimatedNode>(nodeTag)) {
+            objectNode->collectViewUpdates(propName, props.getUntypedProps());
+          }
+        } break;
+        case AnimatedNodeType::Props:
+        case AnimatedNodeType::Tracking:
+        case AnimatedNodeType::Transform:
+          break;
+      }
+    }
+  }
+
+  layoutStyleUpdated_ = isLayoutStyleUpdated(configProps, *manager_);
+
+  manager_->scheduleAnimatedPropsCommit(
+      connectedViewTag_,
+      props.get(),
+      props.takeUntypedProps(),
+      layoutStyleUpdated_);
+}
+
 } // namespace facebook::react
@@ -46,6 +46,12 @@ class PropsAnimatedNode final : public AnimatedNode {
   void update(bool forceFabricCommit);
 
  private:
+  /*
+   * Computes the props as typed `AnimatedProps`, for the shared animation
+   * backend, instead of merging them into `props_`.
+   */
+  void updateAnimatedProps();
+
   std::mutex propsMutex_;
   folly::dynamic props_;
   bool layoutStyleUpdated_{false};
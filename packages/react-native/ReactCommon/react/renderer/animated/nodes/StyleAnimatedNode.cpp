@@ -12,6 +12,7 @@
 #include "StyleAnimatedNode.h"
 
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/internal/AnimatedPropsCollector.h>
 #include <react/renderer/animated/internal/NativeAnimatedAllowlist.h>
 #include <react/renderer/animated/nodes/ColorAnimatedNode.h>
 #include <react/renderer/animated/nodes/ObjectAnimatedNode.h>
@@ -100,4 +101,66 @@ void StyleAnimatedNode::collectViewUpdates(folly::dynamic& props) {
   layoutStyleUpdated_ = isLayoutPropsUpdated(props);
 }
 
+void StyleAnimatedNode::collectViewUpdates(AnimatedPropsCollector& props) {
+  layoutStyleUpdated_ = false;
+  const auto& style = getConfig()["style"];
+  for (const auto& styleProp : style.items()) {
+    auto propName = styleProp.first.asString();
+    const auto nodeTag = static_cast<Tag>(styleProp.second.asInt());
+    if (auto node = manager_->getAnimatedNode<AnimatedNode>(nodeTag)) {
+      switch (node->type()) {
+        case AnimatedNodeType::Transform: {
+          propName = "transform";
+          if (const auto transformNode =
+                  manager_->getAnimatedNode<TransformAnimatedNode>(nodeTag)) {
+            if (auto transform = transformNode->getTransform()) {
+              props.setTransform(std::move(*transform));
+            } else {
+              transformNode->collectViewUpdates(props.getUntypedProps());
+            }
+          }
+        } break;
+        case AnimatedNodeType::Value:
+        case AnimatedNodeType::Interpolation:
+        case AnimatedNodeType::Modulus:
+        case AnimatedNodeType::Round:
+        case AnimatedNodeType::Diffclamp:
+        // Operators
+        case AnimatedNodeType::Addition:
+        case AnimatedNodeType::Subtraction:
+        case AnimatedNodeType::Multiplication:
+        case AnimatedNodeType::Division: {
+          if (const auto valueNode =
+                  manager_->getAnimatedNode<ValueAnimatedNode>(nodeTag)) {
+            props.setValue(
+                propName, valueNode->getValue(), valueNode->getIsColorValue());
+          }
+        } break;
+        case AnimatedNodeType::Color: {
+          if (const auto colorAnimNode =
+                  manager_->getAnimatedNode<ColorAnimatedNode>(nodeTag)) {
+            props.setValue(
+                propName,
+                static_cast<int32_t>(colorAnimNode->getColor()),
+                /* isColor */ true);
+          }
+        } break;
+        case AnimatedNodeType::Object: {
+          if (const auto objectNode =
+                  manager_->getAnimatedNode<ObjectAnimatedNode>(nodeTag)) {
+            objectNode->collectViewUpdates(propName, props.getUntypedProps());
+          }
+        } break;
+        case AnimatedNodeType::Tracking:
+        case AnimatedNodeType::Style:
+        case AnimatedNodeType::Props:
+          continue;
+      }
+      if (getDirectManipulationAllowlist().count(propName) == 0u) {
+        layoutStyleUpdated_ = true;
+      }
+    }
+  }
+}
+
 } // namespace facebook::react
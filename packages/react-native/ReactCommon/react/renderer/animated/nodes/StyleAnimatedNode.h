@@ -16,10 +16,14 @@
 #include <folly/dynamic.h>
 
 namespace facebook::react {
+
+class AnimatedPropsCollector;
+
 class StyleAnimatedNode final : public AnimatedNode {
  public:
   StyleAnimatedNode(Tag tag, const folly::dynamic &config, NativeAnimatedNodesManager &manager);
   void collectViewUpdates(folly::dynamic &props);
+  void collectViewUpdates(AnimatedPropsCollector &props);
 
   bool isLayoutStyleUpdated() const noexcept
   {
@@ -14,6 +14,7 @@
 #include <react/debug/react_native_assert.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
 #include <react/renderer/animated/nodes/ValueAnimatedNode.h>
+#include <optional>
 #include <utility>
 
 namespace facebook::react {
@@ -26,6 +27,86 @@ static constexpr std::string_view sNodeTagName{"nodeTag"};
 static constexpr std::string_view sValueName{"value"};
 static constexpr std::string_view sTransformPropName{"transform"};
 
+namespace {
+
+/*
+ * The operation a transform with the given property and value stands for,
+ * as the props parser would create it, or `std::nullopt` if the property has
+ * no typed representation.
+ */
+std::optional<TransformOperation> transformOperation(
+    const std::string& property,
+    double value) {
+  auto zero = ValueUnit(0, UnitType::Point);
+  auto one = ValueUnit(1, UnitType::Point);
+  auto number = ValueUnit(static_cast<Float>(value), UnitType::Point);
+
+  if (property == "translateX") {
+    return TransformOperation{
+        .type = TransformOperationType::Translate,
+        .x = number,
+        .y = zero,
+        .z = zero};
+  } else if (property == "translateY") {
+    return TransformOperation{
+        .type = TransformOperationType::Translate,
+        .x = zero,
+        .y = number,
+        .z = zero};
+  } else if (property == "scale") {
+    return TransformOperation{
+        .type = TransformOperationType::Scale,
+        .x = number,
+        .y = number,
+        .z = number};
+  } else if (property == "scaleX") {
+    return TransformOperation{
+        .type = TransformOperationType::Scale, .x = number, .y = one, .z = one};
+  } else if (property == "scaleY") {
+    return TransformOperation{
+        .type = TransformOperationType::Scale, .x = one, .y = number, .z = one};
+  } else if (property == "rotate" || property == "rotateZ") {
+    return TransformOperation{
+        .type = TransformOperationType::Rotate,
+        .x = zero,
+        .y = zero,
+        .z = number};
+  } else if (property == "rotateX") {
+    return TransformOperation{
+        .type = TransformOperationType::Rotate,
+        .x = number,
+        .y = zero,
+        .z = zero};
+  } else if (property == "rotateY") {
+    return TransformOperation{
+        .type = TransformOperationType::Rotate,
+        .x = zero,
+        .y = number,
+        .z = zero};
+  } else if (property == "perspective") {
+    return TransformOperation{
+        .type = TransformOperationType::Perspective,
+        .x = number,
+        .y = zero,
+        .z = zero};
+  } else if (property == "skewX") {
+    return TransformOperation{
+        .type = TransformOperationType::Skew,
+        .x = number,
+        .y = zero,
+        .z = zero};
+  } else if (property == "skewY") {
+    return TransformOperation{
+        .type = TransformOperationType::Skew,
+        .x = zero,
+        .y = number,
+        .z = zero};
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
 TransformAnimatedNode::TransformAnimatedNode(
     Tag tag,
     const folly::dynamic& config,
@@ -34,20 +115,10 @@ TransformAnimatedNode::TransformAnimatedNode(
 
 void TransformAnimatedNode::collectViewUpdates(folly::dynamic& props) {
   folly::dynamic transforms = folly::dynamic::array();
-  auto transformsArray = getConfig()[sTransformsName];
+  const auto& transformsArray = getConfig()[sTransformsName];
   react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
   for (const auto& transform : transformsArray) {
-    std::optional<double> value;
-    if (transform[sTypeName].asString() == sAnimatedName) {
-      const auto inputTag = static_cast<Tag>(transform[sNodeTagName].asInt());
-      if (const auto node =
-              manager_->getAnimatedNode<ValueAnimatedNode>(inputTag)) {
-        value = node->getValue();
-      }
-    } else {
-      value = transform[sValueName].asDouble();
-    }
-    if (value) {
+    if (auto value = getTransformValue(transform)) {
       const auto property = transform[sPropertyName].asString();
       transforms.push_back(folly::dynamic::object(property, value.value()));
     }
@@ -55,4 +126,40 @@ void TransformAnimatedNode::collectViewUpdates(folly::dynamic& props) {
   props[sTransformPropName] = std::move(transforms);
 }
 
+std::optional<Transform> TransformAnimatedNode::getTransform() {
+  auto result = Transform{};
+  // All operations are in points, so the matrix doesn't depend on the size of
+  // the view.
+  auto matrix = Transform{};
+  const auto& transformsArray = getConfig()[sTransformsName];
+  react_native_assert(transformsArray.type() == folly::dynamic::ARRAY);
+  for (const auto& transform : transformsArray) {
+    if (auto value = getTransformValue(transform)) {
+      auto operation =
+          transformOperation(transform[sPropertyName].asString(), *value);
+      if (!operation) {
+        return std::nullopt;
+      }
+      result.operations.push_back(*operation);
+      matrix = matrix *
+          Transform::FromTransformOperation(*operation, Size{}, matrix);
+    }
+  }
+  result.matrix = matrix.matrix;
+  return result;
+}
+
+std::optional<double> TransformAnimatedNode::getTransformValue(
+    const folly::dynamic& transform) const {
+  if (transform[sTypeName].asString() == sAnimatedName) {
+    const auto inputTag = static_cast<Tag>(transform[sNodeTagName].asInt());
+    if (const auto node =
+            manager_->getAnimatedNode<ValueAnimatedNode>(inputTag)) {
+      return node->getValue();
+    }
+    return std::nullopt;
+  }
+  return transform[sValueName].asDouble();
+}
+
 } // namespace facebook::react
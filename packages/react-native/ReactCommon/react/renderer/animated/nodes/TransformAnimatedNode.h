@@ -13,6 +13,9 @@
 
 #include "AnimatedNode.h"
 
+#include <react/renderer/graphics/Transform.h>
+#include <optional>
+
 namespace facebook::react {
 
 struct TransformConfig {
@@ -27,5 +30,15 @@ class TransformAnimatedNode final : public AnimatedNode {
   TransformAnimatedNode(Tag tag, const folly::dynamic &config, NativeAnimatedNodesManager &manager);
 
   void collectViewUpdates(folly::dynamic &props);
+
+  /*
+   * The transform as `BaseViewProps::transform` would hold it, with the
+   * matrix the operations resolve to, or `std::nullopt` if some of its
+   * operations have no typed representation.
+   */
+  std::optional<Transform> getTransform();
+
+ private:
+  std::optional<double> getTransformValue(const folly::dynamic &transform) const;
 };
 } // namespace facebook::react
@@ -7,14 +7,62 @@
 
 #include "AnimationTestsBase.h"
 
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/animated/internal/AnimatedPropsCollector.h>
 #include <react/renderer/animated/nodes/ColorAnimatedNode.h>
 #include <react/renderer/animated/nodes/ObjectAnimatedNode.h>
+#include <react/renderer/animated/nodes/StyleAnimatedNode.h>
+#include <react/renderer/animationbackend/AnimatedPropsSerializer.h>
 #include <react/renderer/core/ReactRootViewTagGenerator.h>
 #include <react/renderer/graphics/Color.h>
 
 namespace facebook::react {
 
-class AnimatedNodeTests : public AnimationTestsBase {};
+class AnimatedNodeTests : public AnimationTestsBase {
+ protected:
+  /*
+   * Creates a style node animating opacity, a transform with an animated and a
+   * static operation, and elevation (which has no typed representation).
+   * Returns the tag of the style node.
+   */
+  Tag createStyleNode(Tag& rootTag) {
+    auto opacityNodeTag = ++rootTag;
+    auto translateNodeTag = ++rootTag;
+    auto elevationNodeTag = ++rootTag;
+    auto transformNodeTag = ++rootTag;
+    auto styleNodeTag = ++rootTag;
+    nodesManager_->createAnimatedNode(
+        opacityNodeTag,
+        folly::dynamic::object("type", "value")("value", 0.5)("offset", 0));
+    nodesManager_->createAnimatedNode(
+        translateNodeTag,
+        folly::dynamic::object("type", "value")("value", 10)("offset", 0));
+    nodesManager_->createAnimatedNode(
+        elevationNodeTag,
+        folly::dynamic::object("type", "value")("value", 2)("offset", 0));
+    nodesManager_->createAnimatedNode(
+        transformNodeTag,
+        folly::dynamic::object("type", "transform")(
+            "transforms",
+            folly::dynamic::array(
+                folly::dynamic::object("type", "animated")(
+                    "property", "translateX")("nodeTag", translateNodeTag),
+                folly::dynamic::object("type", "static")("property", "scale")(
+                    "value", 2))));
+    nodesManager_->createAnimatedNode(
+        styleNodeTag,
+        folly::dynamic::object("type", "style")(
+            "style",
+            folly::dynamic::object("opacity", opacityNodeTag)(
+                "transform", transformNodeTag)("elevation", elevationNodeTag)));
+    nodesManager_->connectAnimatedNodes(translateNodeTag, transformNodeTag);
+    nodesManager_->connectAnimatedNodes(opacityNodeTag, styleNodeTag);
+    nodesManager_->connectAnimatedNodes(transformNodeTag, styleNodeTag);
+    nodesManager_->connectAnimatedNodes(elevationNodeTag, styleNodeTag);
+    return styleNodeTag;
+  }
+};
 
 TEST_F(AnimatedNodeTests, setAnimatedNodeValue) {
   initNodesManager();
@@ -332,4 +380,151 @@ TEST_F(AnimatedNodeTests, ObjectAnimatedNode) {
   EXPECT_EQ(collectedProps["test"][2]["scale3d"], 4);
 }
 
+TEST_F(AnimatedNodeTests, updatesNodesAfterAllTheirParents) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto valueTag = ++rootTag;
+  auto firstAdditionTag = ++rootTag;
+  auto secondAdditionTag = ++rootTag;
+
+  // The second addition depends on the value both directly and through the
+  // first addition, so it must be updated after the first one.
+  nodesManager_->createAnimatedNode(
+      valueTag,
+      folly::dynamic::object("type", "value")("value", 1)("offset", 0));
+  nodesManager_->createAnimatedNode(
+      secondAdditionTag,
+      folly::dynamic::object("type", "addition")(
+          "input", folly::dynamic::array(firstAdditionTag, valueTag)));
+  nodesManager_->createAnimatedNode(
+      firstAdditionTag,
+      folly::dynamic::object("type", "addition")(
+          "input", folly::dynamic::array(valueTag, valueTag)));
+  nodesManager_->connectAnimatedNodes(valueTag, secondAdditionTag);
+  nodesManager_->connectAnimatedNodes(firstAdditionTag, secondAdditionTag);
+  nodesManager_->connectAnimatedNodes(valueTag, firstAdditionTag);
+
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(secondAdditionTag), 3);
+
+  nodesManager_->setAnimatedNodeValue(valueTag, 2);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(firstAdditionTag), 4);
+  EXPECT_EQ(nodesManager_->getValue(secondAdditionTag), 6);
+
+  // Nodes connected after the graph was evaluated are updated too.
+  auto thirdAdditionTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      thirdAdditionTag,
+      folly::dynamic::object("type", "addition")(
+          "input", folly::dynamic::array(secondAdditionTag, valueTag)));
+  nodesManager_->connectAnimatedNodes(secondAdditionTag, thirdAdditionTag);
+  nodesManager_->connectAnimatedNodes(valueTag, thirdAdditionTag);
+
+  nodesManager_->setAnimatedNodeValue(valueTag, 3);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(secondAdditionTag), 9);
+  EXPECT_EQ(nodesManager_->getValue(thirdAdditionTag), 12);
+
+  // And disconnected ones aren't.
+  nodesManager_->disconnectAnimatedNodes(secondAdditionTag, thirdAdditionTag);
+  nodesManager_->disconnectAnimatedNodes(valueTag, thirdAdditionTag);
+
+  nodesManager_->setAnimatedNodeValue(valueTag, 4);
+  runAnimationFrame(0);
+  EXPECT_EQ(nodesManager_->getValue(secondAdditionTag), 12);
+  EXPECT_EQ(nodesManager_->getValue(thirdAdditionTag), 12);
+}
+
+TEST_F(AnimatedNodeTests, StyleAnimatedNodeCollectsTypedProps) {
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+
+  auto styleNodeTag = createStyleNode(rootTag);
+
+  runAnimationFrame(0);
+
+  auto styleNode =
+      nodesManager_->getAnimatedNode<StyleAnimatedNode>(styleNodeTag);
+  ASSERT_NE(styleNode, nullptr);
+
+  AnimatedPropsCollector collector;
+  styleNode->collectViewUpdates(collector);
+  auto props = collector.get();
+
+  ASSERT_EQ(props.props.size(), 2);
+  for (const auto& prop : props.props) {
+    if (prop->propName == OPACITY) {
+      EXPECT_EQ(get<Float>(prop), 0.5);
+    } else {
+      ASSERT_EQ(prop->propName, TRANSFORM);
+      auto transform = get<Transform>(prop);
+      ASSERT_EQ(transform.operations.size(), 2);
+      EXPECT_EQ(
+          transform.operations[0].type, TransformOperationType::Translate);
+      EXPECT_EQ(transform.operations[0].x.value, 10);
+      EXPECT_EQ(transform.operations[1].type, TransformOperationType::Scale);
+      EXPECT_EQ(transform.operations[1].y.value, 2);
+      EXPECT_EQ(
+          transform.matrix,
+          (Transform::Translate(10, 0, 0) * Transform::Scale(2, 2, 2)).matrix);
+    }
+  }
+
+  // Props without a typed representation are passed through untyped.
+  EXPECT_EQ(props.rawProps, nullptr);
+  EXPECT_EQ(collector.takeUntypedProps()["elevation"], 2);
+}
+
+#ifdef RN_USE_ANIMATION_BACKEND
+namespace {
+
+class SharedAnimatedBackendFeatureFlags
+    : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool useSharedAnimatedBackend() override {
+    return true;
+  }
+};
+
+} // namespace
+
+TEST_F(AnimatedNodeTests, pullAnimationMutationsEmitsPackableProps) {
+  ReactNativeFeatureFlags::dangerouslyForceOverride(
+      std::make_unique<SharedAnimatedBackendFeatureFlags>());
+  initNodesManager();
+
+  auto rootTag = getNextRootViewTag();
+  auto styleNodeTag = createStyleNode(rootTag);
+  auto propsNodeTag = ++rootTag;
+  auto viewTag = ++rootTag;
+  nodesManager_->createAnimatedNode(
+      propsNodeTag,
+      folly::dynamic::object("type", "props")(
+          "props", folly::dynamic::object("style", styleNodeTag)));
+  nodesManager_->connectAnimatedNodes(styleNodeTag, propsNodeTag);
+  nodesManager_->connectAnimatedNodeToView(propsNodeTag, viewTag);
+
+  auto mutations = nodesManager_->pullAnimationMutations();
+  ReactNativeFeatureFlags::dangerouslyReset();
+
+  ASSERT_EQ(mutations.size(), 1);
+  EXPECT_EQ(mutations[0].tag, viewTag);
+
+  auto matrix = folly::dynamic::array();
+  for (auto value :
+       (Transform::Translate(10, 0, 0) * Transform::Scale(2, 2, 2)).matrix) {
+    matrix.push_back(value);
+  }
+  EXPECT_EQ(
+      animationbackend::packAnimatedProps(mutations[0].props),
+      folly::dynamic::object("opacity", 0.5)("elevation", 2)(
+          "transform",
+          folly::dynamic::array(folly::dynamic::object("matrix", matrix))));
+}
+#endif
+
 } // namespace facebook::react
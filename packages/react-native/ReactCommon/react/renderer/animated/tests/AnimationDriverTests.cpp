@@ -7,6 +7,9 @@
 
 #include "AnimationTestsBase.h"
 
+#include <array>
+#include <vector>
+
 #include <react/renderer/animated/drivers/AnimationDriverUtils.h>
 #include <react/renderer/core/ReactRootViewTagGenerator.h>
 
@@ -117,4 +120,124 @@ TEST_F(AnimationDriverTests, framesAnimationReconfigurationClearsFrames) {
   EXPECT_EQ(round(nodesManager_->getValue(valueNodeTag).value()), toValue2);
 }
 
+TEST_F(AnimationDriverTests, batchedAnimationsMatchSingleSteps) {
+  constexpr int kNumberOfAnimations = 30;
+  constexpr int kNumberOfFrames = 120;
+  const double startTimeInTick = 12345;
+
+  auto startAnimations = [&]() {
+    initNodesManager();
+    auto rootTag = getNextRootViewTag();
+    auto valueNodeTags = std::vector<Tag>{};
+    for (int i = 0; i < kNumberOfAnimations; i++) {
+      auto valueNodeTag = ++rootTag;
+      nodesManager_->createAnimatedNode(
+          valueNodeTag,
+          folly::dynamic::object("type", "value")("value", i)("offset", 0));
+
+      // Under- and overdamped springs, with and without overshoot clamping,
+      // and decays, some of them repeated.
+      auto config = (i % 3 == 2)
+          ? folly::dynamic::object("type", "decay")("velocity", 0.5 + i)(
+                "deceleration", 0.997)
+          : folly::dynamic::object("type", "spring")("stiffness", 100)(
+                "damping", 2 + i)("mass", 1)("initialVelocity", i % 4)(
+                "toValue", 100)("restSpeedThreshold", 0.001)(
+                "restDisplacementThreshold", 0.001)(
+                "overshootClamping", i % 5 == 0);
+      config["iterations"] = 1 + i % 2;
+      nodesManager_->startAnimatingNode(
+          i + 1, valueNodeTag, config, std::nullopt);
+      valueNodeTags.push_back(valueNodeTag);
+    }
+    return valueNodeTags;
+  };
+
+  auto valueNodeTags = startAnimations();
+  auto batchedValues = std::vector<double>{};
+  for (int frame = 0; frame < kNumberOfFrames; frame++) {
+    runAnimationFrame(startTimeInTick + SingleFrameIntervalMs * frame);
+    for (auto tag : valueNodeTags) {
+      batchedValues.push_back(nodesManager_->getValue(tag).value());
+    }
+  }
+
+  valueNodeTags = startAnimations();
+  auto values = std::vector<double>{};
+  for (int frame = 0; frame < kNumberOfFrames; frame++) {
+    runAnimationStepsOneByOne(startTimeInTick + SingleFrameIntervalMs * frame);
+    for (auto tag : valueNodeTags) {
+      values.push_back(nodesManager_->getValue(tag).value());
+    }
+  }
+
+  EXPECT_EQ(batchedValues, values);
+}
+
+TEST_F(AnimationDriverTests, springAnimationsMatchGoldenValues) {
+  struct SpringAnimation {
+    double stiffness;
+    double damping;
+    double mass;
+    double initialVelocity;
+    bool overshootClamping;
+    std::array<float, 7> values;
+  };
+
+  // Values of the spring driver before animations were stepped in batches,
+  // at the frames in `kFrames`.
+  constexpr auto kFrames = std::array<int, 7>{1, 2, 5, 10, 20, 40, 80};
+  // clang-format off
+  const auto springAnimations = std::vector<SpringAnimation>{
+      // Underdamped
+      {100, 10, 1, 0, false,
+       {4.9415107f, 10.440547f, 34.029984f, 77.59436f, 116.16499f, 97.61147f,
+        99.97684f}},
+      // Critically damped
+      {100, 20, 1, 0, false,
+       {4.462492f, 9.020401f, 26.424112f, 54.700737f, 86.41118f, 99.15614f,
+        99.99801f}},
+      // Overdamped
+      {180, 60, 2, 4, false,
+       {4.1582108f, 8.376973f, 24.692026f, 52.013393f, 84.43727f, 98.85954f,
+        99.99623f}},
+      // Overshoot clamping
+      {100, 5, 1, 2, true,
+       {5.2716613f, 11.371171f, 39.42705f, 96.97091f, 100, 100, 100}},
+  };
+  // clang-format on
+  const double startTimeInTick = 12345;
+
+  for (const auto& springAnimation : springAnimations) {
+    initNodesManager();
+    auto valueNodeTag = getNextRootViewTag() + 1;
+    nodesManager_->createAnimatedNode(
+        valueNodeTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+    nodesManager_->startAnimatingNode(
+        1,
+        valueNodeTag,
+        folly::dynamic::object("type", "spring")(
+            "stiffness", springAnimation.stiffness)(
+            "damping", springAnimation.damping)("mass", springAnimation.mass)(
+            "initialVelocity", springAnimation.initialVelocity)("toValue", 100)(
+            "restSpeedThreshold", 0.001)("restDisplacementThreshold", 0.001)(
+            "overshootClamping", springAnimation.overshootClamping)(
+            "iterations", 1),
+        std::nullopt);
+
+    auto valueIndex = size_t{0};
+    for (int frame = 0; frame <= kFrames.back(); frame++) {
+      runAnimationFrame(startTimeInTick + SingleFrameIntervalMs * frame);
+      if (frame == kFrames[valueIndex]) {
+        EXPECT_FLOAT_EQ(
+            nodesManager_->getValue(valueNodeTag).value(),
+            springAnimation.values[valueIndex])
+            << "damping " << springAnimation.damping << ", frame " << frame;
+        valueIndex++;
+      }
+    }
+  }
+}
+
 } // namespace facebook::react
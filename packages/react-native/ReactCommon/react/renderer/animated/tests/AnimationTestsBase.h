@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 #include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/drivers/AnimationDriver.h>
 
 namespace facebook::react {
 
@@ -50,6 +51,17 @@ class AnimationTestsBase : public testing::Test {
     nodesManager_->onAnimationFrame(timestamp);
   }
 
+  /*
+   * Runs a step of each active animation on its own, the way the drivers
+   * were stepped before being batched by type.
+   */
+  void runAnimationStepsOneByOne(double timestamp)
+  {
+    for (const auto &[_id, driver] : nodesManager_->activeAnimations_) {
+      driver->runAnimationStep(timestamp);
+    }
+  }
+
   std::shared_ptr<NativeAnimatedNodesManager> nodesManager_;
   folly::dynamic lastCommittedProps{folly::dynamic::object()};
   Tag lastUpdatedNodeTag{};
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <react/renderer/animated/internal/AnimatedPropsCollector.h>
+#include <react/renderer/animated/nodes/StyleAnimatedNode.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+static std::atomic<size_t> numberOfAllocations{0};
+
+void* operator new(size_t size) {
+  numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto pointer = std::malloc(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+  std::free(pointer);
+}
+
+namespace facebook::react {
+
+constexpr Tag kValueTag = 1;
+constexpr int kNumberOfViews = 100;
+
+/*
+ * A value driving, for each of `kNumberOfViews` views, a style with an
+ * interpolated opacity, an interpolated translation and a background color,
+ * as in a typical list item entrance animation.
+ */
+static std::unique_ptr<NativeAnimatedNodesManager> createNodesManager(
+    std::vector<Tag>& styleNodeTags) {
+  auto nodesManager = std::make_unique<NativeAnimatedNodesManager>(
+      [](Tag /*viewTag*/, const folly::dynamic& /*props*/) {},
+      [](std::unordered_map<Tag, folly::dynamic>& /*props*/) {},
+      nullptr);
+
+  // Nodes can only be created asynchronously off the render thread.
+  std::thread{[&]() {
+    auto connect = [&](Tag parentTag, Tag childTag) {
+      nodesManager->scheduleOnUI(
+          [nodesManager = nodesManager.get(), parentTag, childTag]() {
+            nodesManager->connectAnimatedNodes(parentTag, childTag);
+          });
+    };
+
+    nodesManager->createAnimatedNodeAsync(
+        kValueTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+
+    auto tag = kValueTag;
+    for (int i = 0; i < kNumberOfViews; i++) {
+      auto opacityTag = ++tag;
+      auto translateTag = ++tag;
+      auto colorComponentTag = ++tag;
+      auto colorTag = ++tag;
+      auto transformTag = ++tag;
+      auto styleTag = ++tag;
+
+      nodesManager->createAnimatedNodeAsync(
+          opacityTag,
+          folly::dynamic::object("type", "interpolation")(
+              "inputRange", folly::dynamic::array(0, 100))(
+              "outputRange", folly::dynamic::array(0, 1))(
+              "outputType", "number")("extrapolateLeft", "clamp")(
+              "extrapolateRight", "clamp"));
+      nodesManager->createAnimatedNodeAsync(
+          translateTag,
+          folly::dynamic::object("type", "interpolation")(
+              "inputRange", folly::dynamic::array(0, 100))(
+              "outputRange", folly::dynamic::array(i, 0))(
+              "outputType", "number")("extrapolateLeft", "clamp")(
+              "extrapolateRight", "clamp"));
+      nodesManager->createAnimatedNodeAsync(
+          colorComponentTag,
+          folly::dynamic::object("type", "value")("value", 255)("offset", 0));
+      nodesManager->createAnimatedNodeAsync(
+          colorTag,
+          folly::dynamic::object("type", "color")("r", colorComponentTag)(
+              "g", colorComponentTag)("b", colorComponentTag)("a", opacityTag));
+      nodesManager->createAnimatedNodeAsync(
+          transformTag,
+          folly::dynamic::object("type", "transform")(
+              "transforms",
+              folly::dynamic::array(
+                  folly::dynamic::object("type", "animated")(
+                      "property", "translateY")("nodeTag", translateTag))));
+      nodesManager->createAnimatedNodeAsync(
+          styleTag,
+          folly::dynamic::object("type", "style")(
+              "style",
+              folly::dynamic::object("opacity", opacityTag)(
+                  "transform", transformTag)("backgroundColor", colorTag)));
+
+      connect(kValueTag, opacityTag);
+      connect(kValueTag, translateTag);
+      connect(opacityTag, colorTag);
+      connect(colorComponentTag, colorTag);
+      connect(translateTag, transformTag);
+      connect(opacityTag, styleTag);
+      connect(transformTag, styleTag);
+      connect(colorTag, styleTag);
+      styleNodeTags.push_back(styleTag);
+    }
+  }}.join();
+
+  nodesManager->onRender();
+  return nodesManager;
+}
+
+template <typename CollectT>
+static void runFrames(benchmark::State& state, CollectT&& collect) {
+  auto styleNodeTags = std::vector<Tag>{};
+  auto nodesManager = createNodesManager(styleNodeTags);
+  auto styleNodes = std::vector<StyleAnimatedNode*>{};
+  for (auto tag : styleNodeTags) {
+    styleNodes.push_back(
+        nodesManager->getAnimatedNode<StyleAnimatedNode>(tag));
+  }
+
+  auto value = 0.0;
+  auto allocations = size_t{0};
+  for (auto _ : state) {
+    nodesManager->setAnimatedNodeValue(kValueTag, value);
+    nodesManager->updateNodes();
+    value = value < 100 ? value + 1 : 0;
+
+    auto allocationsBefore = numberOfAllocations.load();
+    for (auto* styleNode : styleNodes) {
+      collect(*styleNode);
+    }
+    allocations += numberOfAllocations.load() - allocationsBefore;
+  }
+
+  state.SetItemsProcessed(state.iterations() * kNumberOfViews);
+  state.counters["allocationsPerView"] = benchmark::Counter(
+      static_cast<double>(allocations) /
+      static_cast<double>(state.iterations() * kNumberOfViews));
+}
+
+static void collectDynamicProps(benchmark::State& state) {
+  runFrames(state, [](StyleAnimatedNode& styleNode) {
+    auto props = folly::dynamic::object();
+    styleNode.collectViewUpdates(props);
+    benchmark::DoNotOptimize(props);
+  });
+}
+BENCHMARK(collectDynamicProps);
+
+static void collectTypedProps(benchmark::State& state) {
+  runFrames(state, [](StyleAnimatedNode& styleNode) {
+    AnimatedPropsCollector collector;
+    styleNode.collectViewUpdates(collector);
+    auto props = collector.get();
+    benchmark::DoNotOptimize(props);
+  });
+}
+BENCHMARK(collectTypedProps);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <memory>
+#include <thread>
+
+namespace facebook::react {
+
+/*
+ * `numberOfAnimations` value nodes, each one animated by an animation
+ * with the given config, as on screens driven by many gestures at once.
+ * The animations loop so that they keep running for as long as the benchmark
+ * does.
+ */
+static std::unique_ptr<NativeAnimatedNodesManager> createNodesManager(
+    int numberOfAnimations,
+    const folly::dynamic& config) {
+  auto nodesManager = std::make_unique<NativeAnimatedNodesManager>(
+      [](Tag /*viewTag*/, const folly::dynamic& /*props*/) {},
+      [](std::unordered_map<Tag, folly::dynamic>& /*props*/) {},
+      nullptr);
+
+  // Nodes can only be created asynchronously off the render thread.
+  std::thread{[&]() {
+    for (int i = 0; i < numberOfAnimations; i++) {
+      auto valueTag = Tag{i + 1};
+      nodesManager->createAnimatedNodeAsync(
+          valueTag,
+          folly::dynamic::object("type", "value")("value", i)("offset", 0));
+      nodesManager->scheduleOnUI([nodesManager = nodesManager.get(),
+                                  animationId = i,
+                                  valueTag,
+                                  config]() {
+        nodesManager->startAnimatingNode(
+            animationId, valueTag, config, std::nullopt);
+      });
+    }
+  }}.join();
+
+  nodesManager->onRender();
+  return nodesManager;
+}
+
+static void runAnimationFrames(
+    benchmark::State& state,
+    const folly::dynamic& config) {
+  auto numberOfAnimations = static_cast<int>(state.range(0));
+  auto nodesManager = createNodesManager(numberOfAnimations, config);
+  for (auto _ : state) {
+    nodesManager->onRender();
+  }
+  benchmark::DoNotOptimize(nodesManager->getValue(1));
+  state.SetItemsProcessed(state.iterations() * numberOfAnimations);
+}
+
+static void runSpringAnimationFrames(benchmark::State& state) {
+  runAnimationFrames(
+      state,
+      folly::dynamic::object("type", "spring")("stiffness", 100)(
+          "damping", 10)("mass", 1)("initialVelocity", 0)("toValue", 1000)(
+          "restSpeedThreshold", 0.001)("restDisplacementThreshold", 0.001)(
+          "overshootClamping", false)("iterations", -1));
+}
+BENCHMARK(runSpringAnimationFrames)->Arg(500);
+
+static void runDecayAnimationFrames(benchmark::State& state) {
+  runAnimationFrames(
+      state,
+      folly::dynamic::object("type", "decay")("velocity", 2)(
+          "deceleration", 0.998)("iterations", -1));
+}
+BENCHMARK(runDecayAnimationFrames)->Arg(500);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/animated/NativeAnimatedNodesManager.h>
+#include <memory>
+#include <thread>
+
+namespace facebook::react {
+
+constexpr Tag kScrollValueTag = 1;
+
+/*
+ * A scroll value driving `numberOfInterpolations` interpolations, each one
+ * followed by `chainLength - 1` more, as in parallax and sticky header
+ * effects.
+ * The nodes are created the way AnimatedModule creates them: asynchronously
+ * from the JS thread, with the connections scheduled on the UI thread, which
+ * `onRender` (called here on the benchmark thread) flushes.
+ */
+static std::unique_ptr<NativeAnimatedNodesManager> createNodesManager(
+    int numberOfInterpolations,
+    int chainLength) {
+  auto nodesManager = std::make_unique<NativeAnimatedNodesManager>(
+      [](Tag /*viewTag*/, const folly::dynamic& /*props*/) {},
+      [](std::unordered_map<Tag, folly::dynamic>& /*props*/) {},
+      nullptr);
+
+  std::thread{[&]() {
+    nodesManager->createAnimatedNodeAsync(
+        kScrollValueTag,
+        folly::dynamic::object("type", "value")("value", 0)("offset", 0));
+
+    auto tag = kScrollValueTag;
+    for (int i = 0; i < numberOfInterpolations; i++) {
+      auto parentTag = kScrollValueTag;
+      for (int j = 0; j < chainLength; j++) {
+        auto interpolationTag = ++tag;
+        nodesManager->createAnimatedNodeAsync(
+            interpolationTag,
+            folly::dynamic::object("type", "interpolation")(
+                "inputRange", folly::dynamic::array(0, 100, 200))(
+                "outputRange", folly::dynamic::array(0, i, 2 * i))(
+                "outputType", "number")("extrapolateLeft", "clamp")(
+                "extrapolateRight", "extend"));
+        nodesManager->scheduleOnUI(
+            [nodesManager = nodesManager.get(), parentTag, interpolationTag]() {
+              nodesManager->connectAnimatedNodes(parentTag, interpolationTag);
+            });
+        parentTag = interpolationTag;
+      }
+    }
+  }}.join();
+
+  nodesManager->onRender();
+  return nodesManager;
+}
+
+static void updateInterpolationNodes(benchmark::State& state) {
+  auto numberOfInterpolations = static_cast<int>(state.range(0));
+  auto nodesManager = createNodesManager(numberOfInterpolations, 1);
+  auto value = 0.0;
+  for (auto _ : state) {
+    nodesManager->setAnimatedNodeValue(kScrollValueTag, value);
+    nodesManager->updateNodes();
+    value = value < 300 ? value + 1 : 0;
+  }
+  benchmark::DoNotOptimize(nodesManager->getValue(numberOfInterpolations));
+  state.SetItemsProcessed(state.iterations() * numberOfInterpolations);
+}
+BENCHMARK(updateInterpolationNodes)->Arg(100)->Arg(1000);
+
+static void updateInterpolationChains(benchmark::State& state) {
+  constexpr int kChainLength = 4;
+  auto numberOfChains = static_cast<int>(state.range(0)) / kChainLength;
+  auto nodesManager = createNodesManager(numberOfChains, kChainLength);
+  auto value = 0.0;
+  for (auto _ : state) {
+    nodesManager->setAnimatedNodeValue(kScrollValueTag, value);
+    nodesManager->updateNodes();
+    value = value < 300 ? value + 1 : 0;
+  }
+  state.SetItemsProcessed(state.iterations() * numberOfChains * kChainLength);
+}
+BENCHMARK(updateInterpolationChains)->Arg(1000);
+
+/*
+ * Every frame follows a change of the graph, so the evaluation order has to
+ * be recomputed every time.
+ */
+static void updateInterpolationNodesAfterGraphChange(benchmark::State& state) {
+  constexpr int kNumberOfInterpolations = 1000;
+  auto nodesManager = createNodesManager(kNumberOfInterpolations, 1);
+  auto value = 0.0;
+  for (auto _ : state) {
+    nodesManager->disconnectAnimatedNodes(kScrollValueTag, 2);
+    nodesManager->connectAnimatedNodes(kScrollValueTag, 2);
+    nodesManager->setAnimatedNodeValue(kScrollValueTag, value);
+    nodesManager->updateNodes();
+    value = value < 300 ? value + 1 : 0;
+  }
+  state.SetItemsProcessed(state.iterations() * kNumberOfInterpolations);
+}
+BENCHMARK(updateInterpolationNodesAfterGraphChange);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
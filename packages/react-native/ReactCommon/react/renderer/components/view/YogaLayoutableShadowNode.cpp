@@ -21,6 +21,7 @@
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
 #include <react/utils/FloatComparison.h>
 #include <yoga/Yoga.h>
+#include <yoga/algorithm/CalculateLayout.h>
 #include <algorithm>
 #include <limits>
 #include <memory>
@@ -658,7 +659,31 @@ void YogaLayoutableShadowNode::layoutTree(
 
   {
     TraceSection s3("YogaLayoutableShadowNode::YGNodeCalculateLayout");
-    YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    if (auto layoutThreadPool = layoutContext.layoutThreadPool) {
+      // Measure functions read the layout context from a thread-local
+      // variable, so it has to be propagated to the pool's threads.
+      auto taskExecutor = [&](std::vector<yoga::LayoutTask>& tasks) {
+        auto threadPoolTasks = std::vector<WorkStealingThreadPool::Task>{};
+        threadPoolTasks.reserve(tasks.size());
+        for (auto& task : tasks) {
+          threadPoolTasks.emplace_back([&]() {
+            auto previousLayoutContext = threadLocalLayoutContext;
+            threadLocalLayoutContext = layoutContext;
+            task();
+            threadLocalLayoutContext = previousLayoutContext;
+          });
+        }
+        layoutThreadPool->run(threadPoolTasks);
+      };
+      yoga::calculateLayout(
+          &yogaNode_,
+          ownerWidth,
+          ownerHeight,
+          yoga::scopedEnum(direction),
+          taskExecutor);
+    } else {
+      YGNodeCalculateLayout(&yogaNode_, ownerWidth, ownerHeight, direction);
+    }
   }
 
   // Update layout metrics for root node. Updated for children in
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/utils/WorkStealingThreadPool.h>
+#include <yoga/Yoga.h>
+#include <yoga/algorithm/CalculateLayout.h>
+
+#include <cmath>
+#include <random>
+
+namespace facebook::react {
+
+namespace {
+
+// Builds a random tree mixing the styles which make a subtree depend on its
+// ancestors (percentages, flexing, baseline alignment, static positioning)
+// with ones which don't. The same seed always produces the same tree.
+class RandomTreeBuilder {
+ public:
+  explicit RandomTreeBuilder(uint32_t seed) : random_(seed) {}
+
+  YGNodeRef build(int depth) {
+    auto node = YGNodeNew();
+
+    if (chance(2)) {
+      YGNodeStyleSetWidth(node, 10 + pick(100));
+    } else if (chance(3)) {
+      YGNodeStyleSetWidthPercent(node, 10 + pick(80));
+    }
+    if (chance(2)) {
+      YGNodeStyleSetHeight(node, 10 + pick(100));
+    } else if (chance(3)) {
+      YGNodeStyleSetHeightPercent(node, 10 + pick(80));
+    }
+
+    if (chance(4)) {
+      YGNodeStyleSetPositionType(node, YGPositionTypeAbsolute);
+    } else if (chance(4)) {
+      YGNodeStyleSetPositionType(node, YGPositionTypeStatic);
+    }
+    if (chance(4)) {
+      YGNodeStyleSetFlexGrow(node, 1);
+    }
+    if (chance(4)) {
+      YGNodeStyleSetFlexShrink(node, 1);
+    }
+    if (chance(3)) {
+      YGNodeStyleSetFlexDirection(node, YGFlexDirectionRow);
+    }
+    if (chance(4)) {
+      YGNodeStyleSetAlignItems(node, static_cast<YGAlign>(pick(6)));
+    }
+    if (chance(6)) {
+      YGNodeStyleSetAlignSelf(node, static_cast<YGAlign>(pick(6)));
+    }
+    if (chance(4)) {
+      YGNodeStyleSetJustifyContent(node, static_cast<YGJustify>(pick(6)));
+    }
+    if (chance(4)) {
+      YGNodeStyleSetPadding(node, YGEdgeAll, pick(10));
+    }
+    if (chance(4)) {
+      YGNodeStyleSetMargin(node, static_cast<YGEdge>(pick(9)), pick(10));
+    }
+    if (chance(5)) {
+      YGNodeStyleSetPosition(node, static_cast<YGEdge>(pick(4)), pick(20));
+    }
+    if (chance(6)) {
+      YGNodeStyleSetPositionPercent(
+          node, static_cast<YGEdge>(pick(4)), pick(50));
+    }
+    if (chance(6)) {
+      YGNodeStyleSetFlexWrap(node, YGWrapWrap);
+    }
+    if (chance(8)) {
+      YGNodeStyleSetMinWidth(node, pick(50));
+    }
+    if (chance(8)) {
+      YGNodeStyleSetBoxSizing(node, YGBoxSizingContentBox);
+    }
+
+    if (depth > 0) {
+      auto childCount = pick(5);
+      for (size_t i = 0; i < childCount; i++) {
+        YGNodeInsertChild(node, build(depth - 1), i);
+      }
+    }
+    return node;
+  }
+
+ private:
+  uint32_t pick(uint32_t bound) {
+    return random_() % bound;
+  }
+
+  bool chance(uint32_t oneIn) {
+    return pick(oneIn) == 0;
+  }
+
+  std::mt19937 random_;
+};
+
+void expectSameFloat(float expected, float actual, uint32_t seed) {
+  if (std::isnan(expected)) {
+    EXPECT_TRUE(std::isnan(actual)) << "seed " << seed;
+  } else {
+    EXPECT_EQ(expected, actual) << "seed " << seed;
+  }
+}
+
+void expectSameLayout(YGNodeRef expected, YGNodeRef actual, uint32_t seed) {
+  expectSameFloat(
+      YGNodeLayoutGetLeft(expected), YGNodeLayoutGetLeft(actual), seed);
+  expectSameFloat(YGNodeLayoutGetTop(expected), YGNodeLayoutGetTop(actual), seed);
+  expectSameFloat(
+      YGNodeLayoutGetWidth(expected), YGNodeLayoutGetWidth(actual), seed);
+  expectSameFloat(
+      YGNodeLayoutGetHeight(expected), YGNodeLayoutGetHeight(actual), seed);
+
+  ASSERT_EQ(YGNodeGetChildCount(expected), YGNodeGetChildCount(actual));
+  for (size_t i = 0; i < YGNodeGetChildCount(expected); i++) {
+    expectSameLayout(
+        YGNodeGetChild(expected, i), YGNodeGetChild(actual, i), seed);
+  }
+}
+
+void expectParallelLayoutMatchesSerialLayout(
+    const yoga::LayoutTaskExecutor& executor) {
+  for (uint32_t seed = 0; seed < 3000; seed++) {
+    auto serialRoot = RandomTreeBuilder{seed}.build(5);
+    auto parallelRoot = RandomTreeBuilder{seed}.build(5);
+
+    YGNodeCalculateLayout(serialRoot, 375, 800, YGDirectionLTR);
+    yoga::calculateLayout(
+        yoga::resolveRef(parallelRoot), 375, 800, yoga::Direction::LTR, executor);
+
+    expectSameLayout(serialRoot, parallelRoot, seed);
+
+    YGNodeFreeRecursive(serialRoot);
+    YGNodeFreeRecursive(parallelRoot);
+
+    if (testing::Test::HasFailure()) {
+      return;
+    }
+  }
+}
+
+} // namespace
+
+TEST(ParallelLayoutTest, SequentialExecutorMatchesSerialLayout) {
+  auto executedTaskCount = size_t{0};
+  expectParallelLayoutMatchesSerialLayout(
+      [&](std::vector<yoga::LayoutTask>& tasks) {
+        for (auto& task : tasks) {
+          task();
+        }
+        executedTaskCount += tasks.size();
+      });
+
+  // Makes sure the generated trees actually exercise the parallel path.
+  EXPECT_GT(executedTaskCount, 0);
+}
+
+TEST(ParallelLayoutTest, ThreadPoolMatchesSerialLayout) {
+  WorkStealingThreadPool threadPool{3};
+  expectParallelLayoutMatchesSerialLayout(
+      [&](std::vector<yoga::LayoutTask>& tasks) { threadPool.run(tasks); });
+}
+
+TEST(ParallelLayoutTest, BaselineAlignedChildrenAreLaidOutSerially) {
+  auto root = YGNodeNew();
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(root, YGAlignBaseline);
+  for (size_t i = 0; i < 3; i++) {
+    auto child = YGNodeNew();
+    YGNodeStyleSetWidth(child, 50);
+    YGNodeStyleSetHeight(child, 20 + 10 * i);
+    YGNodeInsertChild(root, child, i);
+  }
+
+  auto executedTaskCount = size_t{0};
+  yoga::calculateLayout(
+      yoga::resolveRef(root),
+      375,
+      800,
+      yoga::Direction::LTR,
+      [&](std::vector<yoga::LayoutTask>& tasks) {
+        executedTaskCount += tasks.size();
+        for (auto& task : tasks) {
+          task();
+        }
+      });
+
+  EXPECT_EQ(executedTaskCount, 0);
+  EXPECT_EQ(YGNodeLayoutGetTop(YGNodeGetChild(root, 0)), 20);
+  EXPECT_EQ(YGNodeLayoutGetTop(YGNodeGetChild(root, 1)), 10);
+  EXPECT_EQ(YGNodeLayoutGetTop(YGNodeGetChild(root, 2)), 0);
+
+  YGNodeFreeRecursive(root);
+}
+
+} // namespace facebook::react
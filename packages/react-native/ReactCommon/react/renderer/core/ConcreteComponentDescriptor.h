@@ -18,6 +18,7 @@
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
 #include <react/renderer/core/State.h>
 #include <react/renderer/graphics/Float.h>
 
@@ -70,7 +71,8 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       const ShadowNodeFragment &fragment,
       const ShadowNodeFamily::Shared &family) const override
   {
-    auto shadowNode = std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+    auto shadowNode =
+        std::allocate_shared<ShadowNodeT>(ShadowNodeAllocator<ShadowNodeT>{}, fragment, family, getTraits());
 
     adopt(*shadowNode);
 
@@ -80,7 +82,8 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   std::shared_ptr<ShadowNode> cloneShadowNode(const ShadowNode &sourceShadowNode, const ShadowNodeFragment &fragment)
       const override
   {
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode =
+        std::allocate_shared<ShadowNodeT>(ShadowNodeAllocator<ShadowNodeT>{}, sourceShadowNode, fragment);
     shadowNode->completeClone(sourceShadowNode, fragment);
     sourceShadowNode.transferRuntimeShadowNodeReference(shadowNode, fragment);
 
@@ -14,6 +14,7 @@
 #include <react/renderer/core/RawProps.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
 #include <react/renderer/core/StateData.h>
 
 namespace facebook::react {
@@ -74,7 +75,8 @@ class ConcreteShadowNode : public BaseShadowNodeT {
   static UnsharedConcreteProps
   Props(const PropsParserContext &context, const RawProps &rawProps, const Props::Shared &baseProps = nullptr)
   {
-    return std::make_shared<PropsT>(
+    return std::allocate_shared<PropsT>(
+        ShadowNodeAllocator<PropsT>{},
         context, baseProps ? static_cast<const PropsT &>(*baseProps) : *defaultSharedProps(), rawProps);
   }
 
@@ -79,4 +79,10 @@ void EventBeat::induce() const {
   }
 }
 
+void EventBeat::setFrameDeadline(
+    HighResTimeStamp frameDeadline,
+    HighResDuration frameInterval) const {
+  runtimeScheduler_.setFrameDeadline(frameDeadline, frameInterval);
+}
+
 } // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <react/timing/primitives.h>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -134,6 +135,16 @@ class EventBeat {
    */
   void induce() const;
 
+  /*
+   * Reports the deadline of the frame being produced by the host platform and
+   * the interval between frames to `RuntimeScheduler`, which uses them to ask
+   * JavaScript work to yield before the frame is missed. Implementations which
+   * know the vsync timing should call this for every frame, or at least for
+   * the frames in which a beat is requested, since frames in between are
+   * extrapolated from the interval; a zero interval disables the frame budget.
+   */
+  void setFrameDeadline(HighResTimeStamp frameDeadline, HighResDuration frameInterval) const;
+
   BeatCallback beatCallback_;
   std::function<void()> induceCallback_;
   std::shared_ptr<OwnerBox> ownerBox_;
@@ -23,35 +23,7 @@ EventQueue::EventQueue(
 }
 
 void EventQueue::enqueueEvent(RawEvent&& rawEvent) const {
-  {
-    std::scoped_lock lock(queueMutex_);
-
-    if (rawEvent.isUnique) {
-      auto repeatedEvent = eventQueue_.rend();
-
-      for (auto it = eventQueue_.rbegin(); it != eventQueue_.rend(); ++it) {
-        if (it->eventTarget == rawEvent.eventTarget) {
-          // It is necessary to maintain order of different event types
-          // for the same target. If the same target has event types A1, B1
-          // in the event queue and event A2 occurs. A1 has to stay in the
-          // queue.
-          if (it->isUnique && it->type == rawEvent.type) {
-            repeatedEvent = it;
-          }
-
-          break;
-        }
-      }
-
-      if (repeatedEvent == eventQueue_.rend()) {
-        eventQueue_.push_back(std::move(rawEvent));
-      } else {
-        *repeatedEvent = std::move(rawEvent);
-      }
-    } else {
-      eventQueue_.push_back(std::move(rawEvent));
-    }
-  }
+  eventQueue_.push(std::move(rawEvent));
 
   onEnqueue();
 }
@@ -96,17 +68,10 @@ void EventQueue::onBeat(jsi::Runtime& runtime) const {
 }
 
 void EventQueue::flushEvents(jsi::Runtime& runtime) const {
-  std::vector<RawEvent> queue;
-
-  {
-    std::scoped_lock lock(queueMutex_);
-
-    if (eventQueue_.empty()) {
-      return;
-    }
+  auto queue = eventQueue_.drain();
 
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+  if (queue.empty()) {
+    return;
   }
 
   eventProcessor_.flushEvents(runtime, std::move(queue));
@@ -15,6 +15,7 @@
 #include <react/renderer/core/EventBeat.h>
 #include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/RawEvent.h>
+#include <react/renderer/core/RawEventBuffer.h>
 #include <react/renderer/core/StateUpdate.h>
 
 namespace facebook::react {
@@ -78,8 +79,10 @@ class EventQueue {
   EventQueueProcessor eventProcessor_;
 
   const std::unique_ptr<EventBeat> eventBeat_;
+  // Lock-free for producers; drained (and coalesced) on the JavaScript
+  // thread.
+  mutable RawEventBuffer eventQueue_;
   // Thread-safe, protected by `queueMutex_`.
-  mutable std::vector<RawEvent> eventQueue_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
   mutable std::mutex queueMutex_;
 };
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "HitTestIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <optional>
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/renderer/graphics/RectangleEdges.h>
+
+namespace facebook::react {
+
+namespace {
+
+// Leaves cover this many children at most.
+constexpr uint32_t kLeafSize = 4;
+
+struct Bounds {
+  Float minX;
+  Float minY;
+  Float maxX;
+  Float maxY;
+};
+
+/*
+ * The bounds of the points `Rect::containsPoint` accepts, or `std::nullopt`
+ * if it accepts none.
+ */
+std::optional<Bounds> boundsOf(const Rect& rect) {
+  auto bounds = Bounds{
+      .minX = rect.origin.x,
+      .minY = rect.origin.y,
+      .maxX = rect.origin.x + rect.size.width,
+      .maxY = rect.origin.y + rect.size.height};
+  if (!(bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY)) {
+    return std::nullopt;
+  }
+  return bounds;
+}
+
+std::optional<Bounds> unionOf(
+    const std::optional<Bounds>& lhs,
+    const std::optional<Bounds>& rhs) {
+  if (!lhs || !rhs) {
+    return lhs ? lhs : rhs;
+  }
+  return Bounds{
+      .minX = std::min(lhs->minX, rhs->minX),
+      .minY = std::min(lhs->minY, rhs->minY),
+      .maxX = std::max(lhs->maxX, rhs->maxX),
+      .maxY = std::max(lhs->maxY, rhs->maxY)};
+}
+
+template <typename ChildT>
+std::optional<Bounds> boundsOfChild(const ChildT& child) {
+  return unionOf(boundsOf(child.frame), boundsOf(child.overflowFrame));
+}
+
+bool containsPoint(Rect rect, Point point) {
+  return rect.containsPoint(point);
+}
+
+} // namespace
+
+std::vector<size_t> HitTestIndex::findChildrenAtPoint(
+    const ShadowNode& shadowNode,
+    Point point) {
+  auto it = hierarchies_.find(&shadowNode);
+  if (it == hierarchies_.end()) {
+    it = hierarchies_.emplace(&shadowNode, buildHierarchy(shadowNode)).first;
+  }
+  const auto& hierarchy = it->second;
+
+  auto candidates = std::vector<const Child*>{};
+  if (!hierarchy.volumes.empty()) {
+    // The hierarchy is balanced, so its depth is far below the stack size.
+    auto stack = std::array<uint32_t, 64>{};
+    auto stackSize = size_t{1};
+    while (stackSize > 0) {
+      auto volumeIndex = stack[--stackSize];
+      const auto& volume = hierarchy.volumes[volumeIndex];
+      if (!(point.x >= volume.minX && point.x <= volume.maxX &&
+            point.y >= volume.minY && point.y <= volume.maxY)) {
+        continue;
+      }
+
+      if (volume.right == 0) {
+        for (auto i = volume.begin; i < volume.end; i++) {
+          const auto& child = hierarchy.children[i];
+          if (containsPoint(child.frame, point) ||
+              containsPoint(child.overflowFrame, point)) {
+            candidates.push_back(&child);
+          }
+        }
+      } else {
+        stack[stackSize++] = volume.right;
+        stack[stackSize++] = volumeIndex + 1;
+      }
+    }
+  }
+
+  std::sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const auto& lhs, const auto& rhs) {
+        return lhs->zIndex > rhs->zIndex;
+      });
+
+  auto childIndices = std::vector<size_t>{};
+  childIndices.reserve(candidates.size());
+  for (const auto* candidate : candidates) {
+    childIndices.push_back(candidate->index);
+  }
+  return childIndices;
+}
+
+void HitTestIndex::clear() {
+  hierarchies_.clear();
+}
+
+HitTestIndex::Hierarchy HitTestIndex::buildHierarchy(
+    const ShadowNode& shadowNode) {
+  const auto& children = shadowNode.getChildren();
+
+  // The z-order `findNodeAtPoint` visits the children in (backwards).
+  auto zOrder = std::vector<uint32_t>(children.size());
+  std::iota(zOrder.begin(), zOrder.end(), 0);
+  std::stable_sort(
+      zOrder.begin(), zOrder.end(), [&](uint32_t lhs, uint32_t rhs) {
+        return children[lhs]->getOrderIndex() <
+            children[rhs]->getOrderIndex();
+      });
+
+  auto hierarchy = Hierarchy{};
+  hierarchy.children.reserve(children.size());
+  for (uint32_t zIndex = 0; zIndex < zOrder.size(); zIndex++) {
+    auto index = zOrder[zIndex];
+    auto layoutableShadowNode =
+        dynamic_cast<const LayoutableShadowNode*>(children[index].get());
+    if (layoutableShadowNode == nullptr ||
+        (!layoutableShadowNode->canBeTouchTarget() &&
+         !layoutableShadowNode->canChildrenBeTouchTarget())) {
+      continue;
+    }
+
+    auto layoutMetrics = layoutableShadowNode->getLayoutMetrics();
+    auto transform = layoutableShadowNode->getTransform();
+    auto child = Child{
+        .frame = layoutMetrics.frame * transform,
+        .overflowFrame =
+            insetBy(layoutMetrics.frame, layoutMetrics.overflowInset) *
+            transform,
+        .index = index,
+        .zIndex = zIndex};
+    if (boundsOfChild(child)) {
+      hierarchy.children.push_back(child);
+    }
+  }
+
+  if (!hierarchy.children.empty()) {
+    buildVolumes(
+        hierarchy, 0, static_cast<uint32_t>(hierarchy.children.size()));
+  }
+  return hierarchy;
+}
+
+void HitTestIndex::buildVolumes(
+    Hierarchy& hierarchy,
+    uint32_t begin,
+    uint32_t end) {
+  auto bounds = std::optional<Bounds>{};
+  for (auto i = begin; i < end; i++) {
+    bounds = unionOf(bounds, boundsOfChild(hierarchy.children[i]));
+  }
+
+  auto volumeIndex = hierarchy.volumes.size();
+  hierarchy.volumes.push_back(
+      BoundingVolume{
+          .minX = bounds->minX,
+          .minY = bounds->minY,
+          .maxX = bounds->maxX,
+          .maxY = bounds->maxY,
+          .begin = begin,
+          .end = end,
+          .right = 0});
+
+  if (end - begin <= kLeafSize) {
+    return;
+  }
+
+  // Splitting the children in halves by their centers along the longer side
+  // of the volume.
+  auto splitsHorizontally =
+      bounds->maxX - bounds->minX >= bounds->maxY - bounds->minY;
+  auto center = [&](const Child& child) {
+    auto childBounds = *boundsOfChild(child);
+    auto center = splitsHorizontally ? childBounds.minX + childBounds.maxX
+                                     : childBounds.minY + childBounds.maxY;
+    // Infinite bounds must not break the ordering.
+    return std::isnan(center) ? Float{0} : center;
+  };
+  auto middle = begin + (end - begin) / 2;
+  std::nth_element(
+      hierarchy.children.begin() + begin,
+      hierarchy.children.begin() + middle,
+      hierarchy.children.begin() + end,
+      [&](const Child& lhs, const Child& rhs) {
+        return center(lhs) < center(rhs);
+      });
+
+  buildVolumes(hierarchy, begin, middle);
+  auto right = static_cast<uint32_t>(hierarchy.volumes.size());
+  buildVolumes(hierarchy, middle, end);
+  hierarchy.volumes[volumeIndex].right = right;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Point.h>
+#include <react/renderer/graphics/Rect.h>
+
+namespace facebook::react {
+
+/*
+ * Spatial index of the hit areas (transformed frames and overflow areas) of
+ * the children of shadow nodes, which lets
+ * `LayoutableShadowNode::findNodeAtPoint` skip the children that can't contain
+ * a point instead of visiting all of them.
+ * The children of a node are indexed by a bounding volume hierarchy, built
+ * the first time a point is looked up among them.
+ * The index relies on the nodes being immutable: it must only be used with
+ * the nodes of a single revision of a tree and be cleared once that revision
+ * may be gone.
+ * Not thread-safe.
+ */
+class HitTestIndex final {
+ public:
+  /*
+   * Returns the indices of the children of `shadowNode` whose hit areas
+   * contain the given point (in the coordinate space of the children), from
+   * the topmost one to the bottommost one. Children which aren't layoutable
+   * or can't be touch targets (and neither can their children) are skipped.
+   */
+  std::vector<size_t> findChildrenAtPoint(const ShadowNode &shadowNode, Point point);
+
+  void clear();
+
+ private:
+  struct Child {
+    Rect frame;
+    Rect overflowFrame;
+    uint32_t index;
+    // Position of the child in the z-order.
+    uint32_t zIndex;
+  };
+
+  /*
+   * A node of the hierarchy, covering the children `[begin, end)`. The left
+   * subtree, if any, is the next volume; `right` is zero for leaves.
+   */
+  struct BoundingVolume {
+    Float minX;
+    Float minY;
+    Float maxX;
+    Float maxY;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t right;
+  };
+
+  struct Hierarchy {
+    std::vector<Child> children;
+    std::vector<BoundingVolume> volumes;
+  };
+
+  static Hierarchy buildHierarchy(const ShadowNode &shadowNode);
+  static void buildVolumes(Hierarchy &hierarchy, uint32_t begin, uint32_t end);
+
+  std::unordered_map<const ShadowNode *, Hierarchy> hierarchies_;
+};
+
+} // namespace facebook::react
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include <react/renderer/core/LayoutableShadowNode.h>
+#include <react/utils/WorkStealingThreadPool.h>
 
 namespace facebook::react {
 
@@ -59,6 +60,15 @@ struct LayoutContext {
    * If React Native takes up entire screen, it will be {0, 0}.
    */
   Point viewportOffset{};
+
+  /*
+   * If set, subtrees whose layout does not depend on their ancestors (e.g.
+   * children or absolutely positioned containers with a fixed size) are laid
+   * out concurrently on this pool before the rest of the tree. The result is
+   * identical to a serial layout. Opt-in: measure functions of all components
+   * in the tree must be safe to call from any thread.
+   */
+  std::shared_ptr<WorkStealingThreadPool> layoutThreadPool{};
 };
 
 inline bool operator==(const LayoutContext &lhs, const LayoutContext &rhs)
@@ -68,13 +78,15 @@ inline bool operator==(const LayoutContext &lhs, const LayoutContext &rhs)
              lhs.affectedNodes,
              lhs.swapLeftAndRightInRTL,
              lhs.fontSizeMultiplier,
-             lhs.viewportOffset) ==
+             lhs.viewportOffset,
+             lhs.layoutThreadPool) ==
       std::tie(
              rhs.pointScaleFactor,
              rhs.affectedNodes,
              rhs.swapLeftAndRightInRTL,
              rhs.fontSizeMultiplier,
-             rhs.viewportOffset);
+             rhs.viewportOffset,
+             rhs.layoutThreadPool);
 }
 
 inline bool operator!=(const LayoutContext &lhs, const LayoutContext &rhs)
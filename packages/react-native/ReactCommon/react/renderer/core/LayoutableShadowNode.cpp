@@ -7,6 +7,7 @@
 
 #include "LayoutableShadowNode.h"
 
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutMetrics.h>
@@ -271,7 +272,8 @@ Float LayoutableShadowNode::baseline(
 
 std::shared_ptr<const ShadowNode> LayoutableShadowNode::findNodeAtPoint(
     const std::shared_ptr<const ShadowNode>& node,
-    Point point) {
+    Point point,
+    HitTestIndex* hitTestIndex) {
   auto layoutableShadowNode =
       dynamic_cast<const LayoutableShadowNode*>(node.get());
 
@@ -326,6 +328,19 @@ std::shared_ptr<const ShadowNode> LayoutableShadowNode::findNodeAtPoint(
   auto newPoint = point - transformedFrame.origin -
       layoutableShadowNode->getContentOriginOffset(false);
 
+  if (hitTestIndex != nullptr) {
+    const auto& children = node->getChildren();
+    for (auto childIndex :
+         hitTestIndex->findChildrenAtPoint(*node, newPoint)) {
+      auto hitView =
+          findNodeAtPoint(children[childIndex], newPoint, hitTestIndex);
+      if (hitView) {
+        return hitView;
+      }
+    }
+    return layoutableShadowNode->canBeTouchTarget() ? node : nullptr;
+  }
+
   auto sortedChildren = node->getChildren();
   std::stable_sort(
       sortedChildren.begin(),
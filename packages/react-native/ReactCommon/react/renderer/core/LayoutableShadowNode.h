@@ -23,6 +23,7 @@ namespace facebook::react {
 
 struct LayoutConstraints;
 struct LayoutContext;
+class HitTestIndex;
 
 /*
  * Describes all sufficient layout API (in approach-agnostic way)
@@ -136,8 +137,11 @@ class LayoutableShadowNode : public ShadowNode {
   /*
    * Returns the ShadowNode that is rendered at the Point received as a
    * parameter.
+   * If `hitTestIndex` is given, it is used to visit only the children which
+   * may contain the point; the result is the same.
    */
-  static std::shared_ptr<const ShadowNode> findNodeAtPoint(const std::shared_ptr<const ShadowNode> &node, Point point);
+  static std::shared_ptr<const ShadowNode>
+  findNodeAtPoint(const std::shared_ptr<const ShadowNode> &node, Point point, HitTestIndex *hitTestIndex = nullptr);
 
   /*
    * Clean or Dirty layout state:
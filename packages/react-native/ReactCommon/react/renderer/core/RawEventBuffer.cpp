@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RawEventBuffer.h"
+
+namespace facebook::react {
+
+RawEventBuffer::RawEventBuffer() : head_(new Node{}), tail_(head_.load()) {}
+
+RawEventBuffer::~RawEventBuffer() {
+  auto* node = tail_;
+  while (node != nullptr) {
+    auto* next = node->next.load(std::memory_order_acquire);
+    delete node;
+    node = next;
+  }
+}
+
+void RawEventBuffer::push(RawEvent&& rawEvent) {
+  auto* node = new Node{};
+  node->event.emplace(std::move(rawEvent));
+  auto* previous = head_.exchange(node, std::memory_order_acq_rel);
+  // Until this store, the consumer sees the queue end at `previous`.
+  previous->next.store(node, std::memory_order_release);
+}
+
+std::vector<RawEvent> RawEventBuffer::drain() {
+  auto events = std::vector<RawEvent>{};
+  lastEventIndexByTarget_.clear();
+
+  auto* next = tail_->next.load(std::memory_order_acquire);
+  while (next != nullptr) {
+    delete tail_;
+    tail_ = next;
+
+    auto& rawEvent = *tail_->event;
+    const auto* target = rawEvent.eventTarget.get();
+
+    auto [it, inserted] =
+        lastEventIndexByTarget_.try_emplace(target, events.size());
+    if (inserted) {
+      events.push_back(std::move(rawEvent));
+    } else {
+      // It is necessary to maintain order of different event types for the
+      // same target. If the same target has event types A1, B1 in the event
+      // queue and event A2 occurs, A1 has to stay in the queue.
+      auto& lastEvent = events[it->second];
+      if (rawEvent.isUnique && lastEvent.isUnique &&
+          lastEvent.type == rawEvent.type) {
+        lastEvent = std::move(rawEvent);
+      } else {
+        it->second = events.size();
+        events.push_back(std::move(rawEvent));
+      }
+    }
+    // The node stays as the new tail; its event is moved out.
+    tail_->event.reset();
+
+    next = tail_->next.load(std::memory_order_acquire);
+  }
+
+  return events;
+}
+
+bool RawEventBuffer::empty() const {
+  return tail_->next.load(std::memory_order_acquire) == nullptr;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/RawEvent.h>
+
+namespace facebook::react {
+
+/*
+ * Multi-producer, single-consumer buffer of `RawEvent`s, implemented as an
+ * intrusive linked queue (after Dmitry Vyukov's MPSC queue).
+ * Producers push an event with a single atomic exchange and never block on
+ * each other or on the consumer. The consumer takes the pending events in the
+ * order they were pushed and coalesces unique events on the way out (see
+ * `drain`), so the events dispatched to JavaScript don't pile up even if
+ * producers outpace it.
+ */
+class RawEventBuffer final {
+ public:
+  RawEventBuffer();
+  ~RawEventBuffer();
+
+  RawEventBuffer(const RawEventBuffer &other) = delete;
+  RawEventBuffer &operator=(const RawEventBuffer &other) = delete;
+
+  /*
+   * Adds the event to the buffer.
+   * Can be called on any thread.
+   */
+  void push(RawEvent &&rawEvent);
+
+  /*
+   * Removes the pending events from the buffer and returns them in the order
+   * they were pushed.
+   * A unique event replaces the last preceding event for the same target if
+   * that event is also unique and has the same type; otherwise it is appended.
+   * Looking up the last event of a target is `O(1)`.
+   * An event whose `push` hasn't completed yet (and the events pushed after
+   * it) are left for the next call.
+   * Must be called on a single (consumer) thread.
+   */
+  std::vector<RawEvent> drain();
+
+  /*
+   * Returns `true` if there are no pending events.
+   * Must be called on the consumer thread.
+   */
+  bool empty() const;
+
+ private:
+  struct Node {
+    std::atomic<Node *> next{nullptr};
+    std::optional<RawEvent> event;
+  };
+
+  /*
+   * The most recently pushed node. Exchanged by producers.
+   */
+  std::atomic<Node *> head_;
+
+  /*
+   * The node preceding the oldest pending event; its event was already
+   * drained (or it's the initial, empty node). Only accessed by the consumer.
+   */
+  Node *tail_;
+
+  /*
+   * Maps event targets to indices of their last events in the events being
+   * drained. Only accessed by the consumer; kept as a member to reuse buckets.
+   */
+  std::unordered_map<const EventTarget *, size_t> lastEventIndexByTarget_;
+};
+
+} // namespace facebook::react
@@ -14,9 +14,56 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 
 namespace facebook::react {
 
+namespace {
+
+// Average number of keys sharing a displacement.
+constexpr size_t kPerfectHashBucketSize = 2;
+
+// Number of hash seeds tried before falling back to the binary search.
+constexpr uint64_t kPerfectHashSeedCount = 8;
+
+uint64_t hashName(
+    const char* name,
+    RawPropsPropNameLength length,
+    uint64_t seed) noexcept {
+  // FNV-1a followed by a finalizer which spreads the entropy of the last
+  // characters over the upper bits.
+  auto hash = uint64_t{0xCBF29CE484222325} ^ seed;
+  for (RawPropsPropNameLength i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(name[i]);
+    hash *= uint64_t{0x100000001B3};
+  }
+  hash ^= hash >> 32;
+  hash *= uint64_t{0xD6E8FEB86659FD93};
+  hash ^= hash >> 32;
+  return hash;
+}
+
+// Maps `value` to `[0, range)` without a division.
+size_t reduce(uint32_t value, size_t range) noexcept {
+  return static_cast<size_t>((uint64_t{value} * range) >> 32);
+}
+
+size_t perfectHashBucket(uint64_t hash, size_t bucketCount) noexcept {
+  return reduce(static_cast<uint32_t>(hash >> 32), bucketCount);
+}
+
+size_t perfectHashSlot(
+    uint64_t hash,
+    uint16_t displacement,
+    size_t slotCount) noexcept {
+  auto value = static_cast<uint32_t>(hash) ^ (displacement * 0x9E3779B9u);
+  value *= 0x85EBCA6Bu;
+  value ^= value >> 16;
+  return reduce(value, slotCount);
+}
+
+} // namespace
+
 bool RawPropsKeyMap::hasSameName(const Item& lhs, const Item& rhs) noexcept {
   return lhs.length == rhs.length &&
       (std::memcmp(lhs.name, rhs.name, lhs.length) == 0);
@@ -73,6 +120,11 @@ void RawPropsKeyMap::reindex() noexcept {
     items_.erase(++result, items_.end());
   }
 
+  buckets_.clear();
+  if (buildPerfectHash()) {
+    return;
+  }
+
   buckets_.resize(kPropNameLengthHardCap);
 
   auto length = RawPropsPropNameLength{0};
@@ -91,11 +143,130 @@ void RawPropsKeyMap::reindex() noexcept {
   }
 }
 
+bool RawPropsKeyMap::buildPerfectHash() noexcept {
+  // Hash-and-displace: keys are distributed into buckets by one part of the
+  // hash, then (starting from the largest bucket) every bucket gets the
+  // smallest displacement which moves all its keys into free slots.
+
+  // The function built by a previous `reindex` does not fit the current
+  // items, and must not be used if no new one can be built.
+  displacements_.clear();
+  seed_ = 0;
+
+  auto itemCount = items_.size();
+  if (itemCount == 0) {
+    return false;
+  }
+
+  auto bucketCount =
+      (itemCount + kPerfectHashBucketSize - 1) / kPerfectHashBucketSize;
+  auto hashes = std::vector<uint64_t>(itemCount);
+  auto buckets = std::vector<std::vector<size_t>>(bucketCount);
+  auto bucketOrder = std::vector<size_t>(bucketCount);
+  auto displacements = std::vector<uint16_t>(bucketCount);
+  auto slotToItem = std::vector<size_t>(itemCount);
+  auto bucketSlots = std::vector<size_t>{};
+
+  for (uint64_t seed = 0; seed < kPerfectHashSeedCount; seed++) {
+    for (auto& bucket : buckets) {
+      bucket.clear();
+    }
+    for (size_t i = 0; i < itemCount; i++) {
+      hashes[i] = hashName(items_[i].name, items_[i].length, seed);
+      buckets[perfectHashBucket(hashes[i], bucketCount)].push_back(i);
+    }
+
+    for (size_t i = 0; i < bucketCount; i++) {
+      bucketOrder[i] = i;
+    }
+    std::stable_sort(
+        bucketOrder.begin(), bucketOrder.end(), [&](size_t lhs, size_t rhs) {
+          return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+    std::fill(slotToItem.begin(), slotToItem.end(), itemCount);
+    auto succeeded = true;
+
+    for (auto bucketIndex : bucketOrder) {
+      const auto& bucket = buckets[bucketIndex];
+      if (bucket.empty()) {
+        // All remaining buckets are empty.
+        break;
+      }
+
+      auto placed = false;
+      for (uint32_t displacement = 0;
+           displacement <= std::numeric_limits<uint16_t>::max();
+           displacement++) {
+        bucketSlots.clear();
+        for (auto itemIndex : bucket) {
+          auto slot = perfectHashSlot(
+              hashes[itemIndex],
+              static_cast<uint16_t>(displacement),
+              itemCount);
+          if (slotToItem[slot] != itemCount ||
+              std::find(bucketSlots.begin(), bucketSlots.end(), slot) !=
+                  bucketSlots.end()) {
+            break;
+          }
+          bucketSlots.push_back(slot);
+        }
+
+        if (bucketSlots.size() == bucket.size()) {
+          for (size_t i = 0; i < bucket.size(); i++) {
+            slotToItem[bucketSlots[i]] = bucket[i];
+          }
+          displacements[bucketIndex] = static_cast<uint16_t>(displacement);
+          placed = true;
+          break;
+        }
+      }
+
+      if (!placed) {
+        succeeded = false;
+        break;
+      }
+    }
+
+    if (succeeded) {
+      auto items = std::vector<Item>{};
+      items.reserve(itemCount);
+      for (auto itemIndex : slotToItem) {
+        items.push_back(items_[itemIndex]);
+      }
+      items_ = std::move(items);
+      displacements_ = std::move(displacements);
+      seed_ = seed;
+      return true;
+    }
+  }
+
+  LOG(WARNING) << "Failed to build a perfect hash function for "
+               << itemCount << " prop names; falling back to binary search.";
+  return false;
+}
+
+bool RawPropsKeyMap::hasPerfectHash() const noexcept {
+  return !displacements_.empty();
+}
+
 RawPropsValueIndex RawPropsKeyMap::at(
     const char* name,
     RawPropsPropNameLength length) noexcept {
   react_native_assert(length > 0);
   react_native_assert(length < kPropNameLengthHardCap);
+
+  if (!displacements_.empty()) {
+    auto hash = hashName(name, length, seed_);
+    auto displacement =
+        displacements_[perfectHashBucket(hash, displacements_.size())];
+    const auto& item =
+        items_[perfectHashSlot(hash, displacement, items_.size())];
+    return item.length == length && std::memcmp(item.name, name, length) == 0
+        ? item.value
+        : kRawPropsValueIndexEmpty;
+  }
+
   // 1. Find the bucket.
   auto lower = int{buckets_[length - 1]};
   auto upper = int{buckets_[length]} - 1;
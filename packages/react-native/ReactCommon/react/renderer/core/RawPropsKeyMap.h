@@ -9,14 +9,19 @@
 
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
+#include <cstdint>
 #include <vector>
 
 namespace facebook::react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
+ * The set of keys is fixed when the map is reindexed, so reindexing builds a
+ * minimal perfect hash function (hash-and-displace) for it: a lookup is then
+ * one hash of the name, one displacement load and one name comparison.
+ * If no perfect hash function is found, the map falls back to items sorted by
+ * length and name (conceptually a hash map with a hash function that returns
+ * the length of the string) searched with a binary search.
  * The map is optimized for reads only (the map must be reindexed before a bunch
  * of reads).
  */
@@ -39,6 +44,11 @@ class RawPropsKeyMap final {
    */
   RawPropsValueIndex at(const char *name, RawPropsPropNameLength length) noexcept;
 
+  /*
+   * Returns `true` if the map uses a perfect hash function for lookups.
+   */
+  bool hasPerfectHash() const noexcept;
+
  private:
   struct Item {
     RawPropsValueIndex value;
@@ -49,8 +59,16 @@ class RawPropsKeyMap final {
   static bool shouldFirstOneBeBeforeSecondOne(const Item &lhs, const Item &rhs) noexcept;
   static bool hasSameName(const Item &lhs, const Item &rhs) noexcept;
 
+  bool buildPerfectHash() noexcept;
+
+  // Sorted by length and name, or ordered by perfect hash slots if
+  // `displacements_` is not empty.
   std::vector<Item> items_{};
   std::vector<RawPropsPropNameLength> buckets_{};
+
+  // Perfect hash function parameters.
+  std::vector<uint16_t> displacements_{};
+  uint64_t seed_{0};
 };
 
 } // namespace facebook::react
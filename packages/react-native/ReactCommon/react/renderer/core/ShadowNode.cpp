@@ -8,6 +8,7 @@
 #include "ShadowNode.h"
 #include "DynamicPropsUtilities.h"
 #include "ShadowNodeFragment.h"
+#include "ShadowNodeMemoryPool.h"
 
 #include <react/debug/react_native_assert.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
@@ -28,6 +29,16 @@ namespace facebook::react {
  */
 thread_local bool useRuntimeShadowNodeReferenceUpdateOnThread{false}; // NOLINT
 
+/*
+ * Copies a list of children into a block owned by `ShadowNodeMemoryPool`.
+ */
+static std::shared_ptr<std::vector<std::shared_ptr<const ShadowNode>>>
+allocateChildrenList(
+    const std::vector<std::shared_ptr<const ShadowNode>>& children) {
+  using List = std::vector<std::shared_ptr<const ShadowNode>>;
+  return std::allocate_shared<List>(ShadowNodeAllocator<List>{}, children);
+}
+
 /* static */ void ShadowNode::setUseRuntimeShadowNodeReferenceUpdateOnThread(
     bool isEnabled) {
   useRuntimeShadowNodeReferenceUpdateOnThread = isEnabled;
@@ -92,8 +103,10 @@ ShadowNode::ShadowNode(
 
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
 
-  for (const auto& child : *children_) {
-    child->family_->setParent(family_);
+  for (size_t index = 0; index < children_->size(); index++) {
+    const auto& childFamily = (*children_)[index]->family_;
+    childFamily->setParent(family_);
+    childFamily->setChildIndexHint(index);
   }
 
   updateTraitsIfNeccessary();
@@ -129,8 +142,10 @@ ShadowNode::ShadowNode(
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
 
   if (fragment.children) {
-    for (const auto& child : *children_) {
-      child->family_->setParent(family_);
+    for (size_t index = 0; index < children_->size(); index++) {
+      const auto& childFamily = (*children_)[index]->family_;
+      childFamily->setParent(family_);
+      childFamily->setChildIndexHint(index);
     }
     updateTraitsIfNeccessary();
   }
@@ -248,6 +263,7 @@ void ShadowNode::appendChild(const std::shared_ptr<const ShadowNode>& child) {
   children.push_back(child);
 
   child->family_->setParent(family_);
+  child->family_->setChildIndexHint(children.size() - 1);
   updateTraitsIfNeccessary();
 }
 
@@ -270,6 +286,7 @@ void ShadowNode::replaceChild(
     // replacing in place using the index.
     if (children.at(suggestedIndex).get() == &oldChild) {
       children[suggestedIndex] = newChild;
+      newChild->family_->setChildIndexHint(suggestedIndex);
       return;
     }
   }
@@ -277,6 +294,7 @@ void ShadowNode::replaceChild(
   for (size_t index = 0; index < size; index++) {
     if (children.at(index).get() == &oldChild) {
       children[index] = newChild;
+      newChild->family_->setChildIndexHint(index);
       return;
     }
   }
@@ -291,8 +309,7 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-      *children_);
+  children_ = allocateChildrenList(*children_);
 }
 
 void ShadowNode::updateTraitsIfNeccessary() {
@@ -400,9 +417,7 @@ std::shared_ptr<ShadowNode> ShadowNode::cloneTree(
     children[childIndex] = childNode;
 
     childNode = parentNode.clone(
-        {.children =
-             std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-                 children)});
+        {.children = allocateChildrenList(children)});
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
@@ -425,9 +440,7 @@ std::shared_ptr<ShadowNode> cloneMultipleRecursive(
     if (childrenCount.contains(childFamily)) {
       count--;
       if (!newChildren) {
-        newChildren =
-            std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>(
-                children);
+        newChildren = allocateChildrenList(children);
       }
       (*newChildren)[i] =
           cloneMultipleRecursive(*children[i], childrenCount, callback);
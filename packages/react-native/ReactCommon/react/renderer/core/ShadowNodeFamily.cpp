@@ -43,6 +43,11 @@ void ShadowNodeFamily::setParent(const ShadowNodeFamily::Shared& parent) const {
   hasParent_ = true;
 }
 
+void ShadowNodeFamily::setChildIndexHint(size_t childIndex) const {
+  childIndexHint_.store(
+      static_cast<int>(childIndex), std::memory_order_relaxed);
+}
+
 ComponentHandle ShadowNodeFamily::getComponentHandle() const {
   return componentHandle_;
 }
@@ -118,22 +123,30 @@ AncestorList ShadowNodeFamily::getAncestors(
   auto parentNode = &ancestorShadowNode;
   for (auto it = families.rbegin(); it != families.rend(); it++) {
     auto childFamily = *it;
-    auto found = false;
-    auto childIndex = 0;
-    for (const auto& childNode : *parentNode->children_) {
-      if (childNode->family_.get() == childFamily) {
-        ancestors.emplace_back(*parentNode, childIndex);
-        parentNode = childNode.get();
-        found = true;
-        break;
+    const auto& children = *parentNode->children_;
+    auto size = static_cast<int>(children.size());
+
+    auto childIndex =
+        childFamily->childIndexHint_.load(std::memory_order_relaxed);
+    if (childIndex < 0 || childIndex >= size ||
+        children[childIndex]->family_.get() != childFamily) {
+      childIndex = -1;
+      for (int index = 0; index < size; index++) {
+        if (children[index]->family_.get() == childFamily) {
+          childIndex = index;
+          childFamily->setChildIndexHint(index);
+          break;
+        }
       }
-      childIndex++;
     }
 
-    if (!found) {
+    if (childIndex == -1) {
       ancestors.clear();
       return ancestors;
     }
+
+    ancestors.emplace_back(*parentNode, childIndex);
+    parentNode = children[childIndex].get();
   }
 
   return ancestors;
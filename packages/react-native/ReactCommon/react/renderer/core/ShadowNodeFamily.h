@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 
@@ -78,7 +79,9 @@ class ShadowNodeFamily final : public jsi::NativeState {
    * node and an index of the child of the parent node.
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
-   * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * Every step first checks the child index cached in the family (see
+   * `childIndexHint_`), so the complexity is `O(depth)` as long as the hints
+   * are fresh; stale hints fall back to a linear scan of the siblings.
    */
   AncestorList getAncestors(const ShadowNode &ancestorShadowNode) const;
 
@@ -141,6 +144,12 @@ class ShadowNodeFamily final : public jsi::NativeState {
    */
   std::shared_ptr<const State> getMostRecentStateIfObsolete(const State &state) const;
 
+  /*
+   * Caches the index of a node of this family in its parent's children list.
+   * To be used by `ShadowNode` only.
+   */
+  void setChildIndexHint(size_t childIndex) const;
+
   EventDispatcher::Weak eventDispatcher_;
   mutable std::shared_ptr<const State> mostRecentState_;
   mutable std::shared_mutex mutex_;
@@ -192,6 +201,14 @@ class ShadowNodeFamily final : public jsi::NativeState {
    */
   mutable bool hasParent_{false};
 
+  /*
+   * Index of a node of this family in the children list of its parent as of
+   * the most recently constructed or mutated parent node.
+   * Different revisions may place the family at different indices, so the
+   * value is only a hint and must be verified before use.
+   */
+  mutable std::atomic<int> childIndexHint_{-1};
+
   /*
    * Determines if the ShadowNodeFamily was ever mounted on the screen.
    */
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeMemoryPool.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+thread_local ShadowNodeMemoryPool::Counters threadLocalCounters_{}; // NOLINT
+thread_local ShadowNodeMemoryPool::Counters takenThreadLocalCounters_{}; // NOLINT
+
+// Set once the cache of the thread is destroyed, so that objects released
+// later during the thread's exit go to the shared free lists.
+thread_local bool isThreadCacheDestroyed_{false}; // NOLINT
+
+size_t roundUpToBlockAlignment(size_t size) {
+  constexpr auto alignment = ShadowNodeMemoryPool::kBlockAlignment;
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+size_t sizeClassIndexForSize(size_t size) {
+  return roundUpToBlockAlignment(size) /
+      ShadowNodeMemoryPool::kBlockAlignment -
+      1;
+}
+
+size_t blockSizeForSizeClassIndex(size_t sizeClassIndex) {
+  return (sizeClassIndex + 1) * ShadowNodeMemoryPool::kBlockAlignment;
+}
+
+} // namespace
+
+ShadowNodeMemoryPool::ThreadCache::~ThreadCache() {
+  isThreadCacheDestroyed_ = true;
+  auto& pool = ShadowNodeMemoryPool::shared();
+  for (size_t index = 0; index < kSizeClassCount; index++) {
+    pool.flush(*this, index, sizes[index]);
+  }
+}
+
+ShadowNodeMemoryPool& ShadowNodeMemoryPool::shared() {
+  // Intentionally leaked: shadow nodes may outlive any static destructor.
+  static auto* pool = new ShadowNodeMemoryPool();
+  return *pool;
+}
+
+ShadowNodeMemoryPool::Counters ShadowNodeMemoryPool::threadLocalCounters() {
+  return threadLocalCounters_;
+}
+
+ShadowNodeMemoryPool::Counters
+ShadowNodeMemoryPool::takeThreadLocalCounters() {
+  auto counters = Counters{
+      .allocations = threadLocalCounters_.allocations -
+          takenThreadLocalCounters_.allocations,
+      .systemAllocations = threadLocalCounters_.systemAllocations -
+          takenThreadLocalCounters_.systemAllocations};
+  takenThreadLocalCounters_ = threadLocalCounters_;
+  return counters;
+}
+
+void* ShadowNodeMemoryPool::allocate(size_t size) {
+  threadLocalCounters_.allocations++;
+
+  if (size == 0 || size > kMaxPooledBlockSize) {
+    threadLocalCounters_.systemAllocations++;
+    return ::operator new(size);
+  }
+
+  auto index = sizeClassIndexForSize(size);
+
+  if (auto* cache = threadCache()) {
+    if (cache->freeLists[index] == nullptr) {
+      refill(*cache, index);
+    }
+    auto* block = cache->freeLists[index];
+    cache->freeLists[index] = block->next;
+    cache->sizes[index]--;
+    return block;
+  }
+
+  auto& sizeClass = sizeClasses_[index];
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+  if (sizeClass.freeList == nullptr) {
+    addChunk(sizeClass, index);
+  }
+  auto* block = sizeClass.freeList;
+  sizeClass.freeList = block->next;
+  return block;
+}
+
+void ShadowNodeMemoryPool::deallocate(void* pointer, size_t size) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+
+  if (size == 0 || size > kMaxPooledBlockSize) {
+    ::operator delete(pointer);
+    return;
+  }
+
+  auto index = sizeClassIndexForSize(size);
+  auto* block = static_cast<FreeBlock*>(pointer);
+
+  if (auto* cache = threadCache()) {
+    block->next = cache->freeLists[index];
+    cache->freeLists[index] = block;
+    if (++cache->sizes[index] > kThreadCacheCapacity) {
+      flush(*cache, index, kThreadCacheBatchSize);
+    }
+    return;
+  }
+
+  auto& sizeClass = sizeClasses_[index];
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+  block->next = sizeClass.freeList;
+  sizeClass.freeList = block;
+}
+
+size_t ShadowNodeMemoryPool::trim() noexcept {
+  if (auto* cache = threadCache()) {
+    for (size_t index = 0; index < kSizeClassCount; index++) {
+      flush(*cache, index, cache->sizes[index]);
+    }
+  }
+
+  auto releasedBytes = size_t{0};
+  for (size_t index = 0; index < kSizeClassCount; index++) {
+    auto& sizeClass = sizeClasses_[index];
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    if (sizeClass.chunks.empty()) {
+      continue;
+    }
+
+    auto blockSize = blockSizeForSizeClassIndex(index);
+    auto blockCount = kChunkSize / blockSize;
+    auto chunkSize = blockCount * blockSize;
+
+    // Counts the free blocks of every chunk; chunks whose blocks are all free
+    // are released.
+    std::sort(sizeClass.chunks.begin(), sizeClass.chunks.end());
+    auto freeBlockCounts = std::vector<size_t>(sizeClass.chunks.size(), 0);
+    auto chunkIndexForBlock = [&](const FreeBlock* block) {
+      auto it = std::upper_bound(
+          sizeClass.chunks.begin(),
+          sizeClass.chunks.end(),
+          reinterpret_cast<const std::byte*>(block),
+          [](const std::byte* address, const auto& chunk) {
+            return std::less<const std::byte*>{}(address, chunk.get());
+          });
+      return static_cast<size_t>(it - sizeClass.chunks.begin()) - 1;
+    };
+    for (auto* block = sizeClass.freeList; block != nullptr;
+         block = block->next) {
+      freeBlockCounts[chunkIndexForBlock(block)]++;
+    }
+
+    auto* freeList = static_cast<FreeBlock*>(nullptr);
+    for (auto* block = sizeClass.freeList; block != nullptr;) {
+      auto* next = block->next;
+      if (freeBlockCounts[chunkIndexForBlock(block)] != blockCount) {
+        block->next = freeList;
+        freeList = block;
+      }
+      block = next;
+    }
+    sizeClass.freeList = freeList;
+
+    auto chunkIndex = size_t{0};
+    std::erase_if(sizeClass.chunks, [&](const auto& /*chunk*/) {
+      return freeBlockCounts[chunkIndex++] == blockCount;
+    });
+    releasedBytes +=
+        (freeBlockCounts.size() - sizeClass.chunks.size()) * chunkSize;
+  }
+  return releasedBytes;
+}
+
+size_t ShadowNodeMemoryPool::getChunkSizeInBytes() const {
+  auto chunkSizeInBytes = size_t{0};
+  for (size_t index = 0; index < kSizeClassCount; index++) {
+    auto blockSize = blockSizeForSizeClassIndex(index);
+    std::lock_guard<std::mutex> lock(sizeClasses_[index].mutex);
+    chunkSizeInBytes +=
+        sizeClasses_[index].chunks.size() * (kChunkSize / blockSize) * blockSize;
+  }
+  return chunkSizeInBytes;
+}
+
+ShadowNodeMemoryPool::ThreadCache* ShadowNodeMemoryPool::threadCache() noexcept {
+  if (this != &shared() || isThreadCacheDestroyed_) {
+    return nullptr;
+  }
+  thread_local ThreadCache threadCache{};
+  return &threadCache;
+}
+
+void ShadowNodeMemoryPool::addChunk(SizeClass& sizeClass, size_t sizeClassIndex) {
+  threadLocalCounters_.systemAllocations++;
+
+  auto blockSize = blockSizeForSizeClassIndex(sizeClassIndex);
+  auto blockCount = kChunkSize / blockSize;
+  auto chunk = std::make_unique<std::byte[]>(blockCount * blockSize);
+
+  // Threading blocks in reverse order so that they are handed out in
+  // ascending address order.
+  for (auto index = blockCount; index > 0; index--) {
+    auto* block =
+        reinterpret_cast<FreeBlock*>(chunk.get() + (index - 1) * blockSize);
+    block->next = sizeClass.freeList;
+    sizeClass.freeList = block;
+  }
+
+  sizeClass.chunks.push_back(std::move(chunk));
+}
+
+void ShadowNodeMemoryPool::refill(
+    ThreadCache& threadCache,
+    size_t sizeClassIndex) {
+  auto& sizeClass = sizeClasses_[sizeClassIndex];
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+  for (size_t count = 0; count < kThreadCacheBatchSize; count++) {
+    if (sizeClass.freeList == nullptr) {
+      if (count > 0) {
+        break;
+      }
+      addChunk(sizeClass, sizeClassIndex);
+    }
+    auto* block = sizeClass.freeList;
+    sizeClass.freeList = block->next;
+    block->next = threadCache.freeLists[sizeClassIndex];
+    threadCache.freeLists[sizeClassIndex] = block;
+    threadCache.sizes[sizeClassIndex]++;
+  }
+}
+
+void ShadowNodeMemoryPool::flush(
+    ThreadCache& threadCache,
+    size_t sizeClassIndex,
+    size_t blockCount) noexcept {
+  if (blockCount == 0) {
+    return;
+  }
+
+  auto* first = threadCache.freeLists[sizeClassIndex];
+  auto* last = first;
+  for (size_t count = 1; count < blockCount; count++) {
+    last = last->next;
+  }
+  threadCache.freeLists[sizeClassIndex] = last->next;
+  threadCache.sizes[sizeClassIndex] -= blockCount;
+
+  auto& sizeClass = sizeClasses_[sizeClassIndex];
+  std::lock_guard<std::mutex> lock(sizeClass.mutex);
+  last->next = sizeClass.freeList;
+  sizeClass.freeList = first;
+}
+
+} // namespace facebook::react
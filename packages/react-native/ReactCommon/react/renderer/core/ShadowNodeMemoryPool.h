@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Process-wide pool of fixed-size memory blocks backing shadow nodes,
+ * children lists and props.
+ * Every commit clones the spine from a changed node up to the root, and
+ * older revisions release the very same kinds of objects shortly after; the
+ * pool keeps those blocks on per-size-class free lists so that steady-state
+ * commits are served without reaching the global allocator.
+ * Every thread keeps a small cache of free blocks of the shared instance per
+ * size class, so that most allocations and releases don't take the lock of
+ * the size class.
+ * Chunks of blocks are returned to the system only by `trim` (on memory
+ * pressure and when surfaces are stopped); otherwise the memory footprint is
+ * bounded by the peak number of simultaneously alive objects plus
+ * `kThreadCacheCapacity` blocks per size class and thread.
+ * The class is thread-safe. Objects can be allocated and released on
+ * different threads.
+ */
+class ShadowNodeMemoryPool final {
+ public:
+  /*
+   * Monotonic allocation counters of the calling thread.
+   */
+  struct Counters {
+    /*
+     * Number of blocks handed out by the pool.
+     */
+    uint64_t allocations{0};
+
+    /*
+     * Number of times the pool had to reach the global allocator (to allocate
+     * a new chunk or a block that is too large to be pooled).
+     */
+    uint64_t systemAllocations{0};
+  };
+
+  /*
+   * Returns the shared instance. The instance is never destroyed, so objects
+   * released during static destruction are still handled correctly.
+   */
+  static ShadowNodeMemoryPool &shared();
+
+  /*
+   * Returns allocation counters accumulated by the calling thread.
+   */
+  static Counters threadLocalCounters();
+
+  /*
+   * Returns allocation counters accumulated by the calling thread since the
+   * previous call, e.g. everything a thread allocated for a commit, including
+   * the clones made before the commit started.
+   */
+  static Counters takeThreadLocalCounters();
+
+  /*
+   * Largest block size (in bytes) served from the pool.
+   */
+  static constexpr size_t kMaxPooledBlockSize = 2048;
+
+  /*
+   * Alignment guaranteed for every returned block.
+   */
+  static constexpr size_t kBlockAlignment = alignof(std::max_align_t);
+
+  /*
+   * Maximum number of free blocks of the shared instance kept by a thread per
+   * size class.
+   * Blocks over the capacity are moved to the shared free lists in batches of
+   * `kThreadCacheBatchSize`, which is also how many blocks a thread takes from
+   * them at once.
+   */
+  static constexpr size_t kThreadCacheCapacity = 64;
+  static constexpr size_t kThreadCacheBatchSize = kThreadCacheCapacity / 2;
+
+  ShadowNodeMemoryPool() = default;
+  ShadowNodeMemoryPool(const ShadowNodeMemoryPool &) = delete;
+  ShadowNodeMemoryPool &operator=(const ShadowNodeMemoryPool &) = delete;
+
+  void *allocate(size_t size);
+  void deallocate(void *pointer, size_t size) noexcept;
+
+  /*
+   * Returns chunks without allocated blocks to the system, after moving the
+   * free blocks cached by the calling thread to the shared free lists. Blocks
+   * cached by other threads keep their chunks alive.
+   * Returns the number of released bytes.
+   */
+  size_t trim() noexcept;
+
+  /*
+   * Number of bytes taken from the system for chunks.
+   */
+  size_t getChunkSizeInBytes() const;
+
+ private:
+  static constexpr size_t kSizeClassCount = kMaxPooledBlockSize / kBlockAlignment;
+  static constexpr size_t kChunkSize = 16 * 1024;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct SizeClass {
+    mutable std::mutex mutex;
+    FreeBlock *freeList{nullptr};
+    std::vector<std::unique_ptr<std::byte[]>> chunks;
+  };
+
+  /*
+   * Free blocks of the shared instance cached by a thread. Returned to the
+   * shared free lists when the thread exits.
+   */
+  struct ThreadCache {
+    std::array<FreeBlock *, kSizeClassCount> freeLists{};
+    std::array<size_t, kSizeClassCount> sizes{};
+
+    ~ThreadCache();
+  };
+
+  /*
+   * Returns the cache of the calling thread for the shared instance, or
+   * nullptr for other instances.
+   */
+  ThreadCache *threadCache() noexcept;
+
+  void addChunk(SizeClass &sizeClass, size_t sizeClassIndex);
+  void refill(ThreadCache &threadCache, size_t sizeClassIndex);
+  void flush(ThreadCache &threadCache, size_t sizeClassIndex, size_t blockCount) noexcept;
+
+  std::array<SizeClass, kSizeClassCount> sizeClasses_{};
+};
+
+/*
+ * Standard allocator over `ShadowNodeMemoryPool`.
+ * Meant to be used with `std::allocate_shared`, which places the `shared_ptr`
+ * control block and the object in a single pooled block.
+ */
+template <typename T>
+class ShadowNodeAllocator final {
+ public:
+  using value_type = T;
+
+  ShadowNodeAllocator() noexcept = default;
+
+  template <typename U>
+  ShadowNodeAllocator(const ShadowNodeAllocator<U> & /*other*/) noexcept
+  {
+  }
+
+  T *allocate(size_t count)
+  {
+    static_assert(
+        alignof(T) <= ShadowNodeMemoryPool::kBlockAlignment, "Over-aligned types are not supported by the pool.");
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(ShadowNodeMemoryPool::shared().allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T *pointer, size_t count) noexcept
+  {
+    ShadowNodeMemoryPool::shared().deallocate(pointer, count * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(const ShadowNodeAllocator<U> & /*rhs*/) const noexcept
+  {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const ShadowNodeAllocator<U> & /*rhs*/) const noexcept
+  {
+    return false;
+  }
+};
+
+} // namespace facebook::react
@@ -5,7 +5,10 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <random>
+
 #include <gtest/gtest.h>
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/element/Element.h>
 #include <react/renderer/element/testUtils.h>
 
@@ -452,3 +455,153 @@ TEST(FindNodeAtPointTest, considersOverflowAreaOfTheParent) {
           ->getTag(),
       3);
 }
+
+TEST(FindNodeAtPointTest, hitTestIndexFindsTopmostView) {
+  auto builder = simpleComponentBuilder();
+
+  auto children = std::vector<ElementFragment>{};
+  for (int i = 0; i < 100; i++) {
+    children.push_back(Element<ViewShadowNode>().tag(i + 2).finalize(
+        [i](ViewShadowNode& shadowNode) {
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.origin = {.x = Float(i * 10), .y = 0};
+          layoutMetrics.frame.size = {.width = 20, .height = 20};
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        }));
+  }
+  auto element = Element<ViewShadowNode>()
+                     .tag(1)
+                     .finalize([](ViewShadowNode& shadowNode) {
+                       auto layoutMetrics = EmptyLayoutMetrics;
+                       layoutMetrics.frame.size = {
+                           .width = 1000, .height = 100};
+                       shadowNode.setLayoutMetrics(layoutMetrics);
+                     })
+                     .children(children);
+
+  auto parentShadowNode = builder.build(element);
+  auto hitTestIndex = HitTestIndex{};
+
+  EXPECT_EQ(
+      LayoutableShadowNode::findNodeAtPoint(
+          parentShadowNode, {5, 5}, &hitTestIndex)
+          ->getTag(),
+      2);
+  EXPECT_EQ(
+      LayoutableShadowNode::findNodeAtPoint(
+          parentShadowNode, {505, 15}, &hitTestIndex)
+          ->getTag(),
+      52);
+  EXPECT_EQ(
+      LayoutableShadowNode::findNodeAtPoint(
+          parentShadowNode, {505, 50}, &hitTestIndex)
+          ->getTag(),
+      1);
+  EXPECT_EQ(
+      LayoutableShadowNode::findNodeAtPoint(
+          parentShadowNode, {1005, 5}, &hitTestIndex),
+      nullptr);
+}
+
+namespace {
+
+ElementFragment randomViewElement(
+    std::mt19937& random,
+    Tag& tag,
+    int depth) {
+  auto distribution = std::uniform_real_distribution<Float>{0, 1};
+  auto origin = Point{
+      .x = distribution(random) * 400 - 100,
+      .y = distribution(random) * 400 - 100};
+  auto size = Size{
+      .width = distribution(random) * 150,
+      .height = distribution(random) * 150};
+  auto overflowInset = EdgeInsets{};
+  if (random() % 4 == 0) {
+    overflowInset.right = -distribution(random) * 100;
+    overflowInset.bottom = -distribution(random) * 100;
+  }
+  auto zIndex = random() % 3 == 0 ? std::optional<int>(random() % 5 - 2)
+                                  : std::nullopt;
+  auto pointerEvents = random() % 6 == 0
+      ? PointerEventsMode(random() % 4)
+      : PointerEventsMode::Auto;
+  auto transform = Transform::Identity();
+  switch (random() % 5) {
+    case 0:
+      transform = Transform::Scale(0.5, 2, 1);
+      break;
+    case 1:
+      transform = Transform::RotateZ(distribution(random) * 3);
+      break;
+    case 2:
+      transform = Transform::VerticalInversion();
+      break;
+    default:
+      break;
+  }
+
+  auto children = std::vector<ElementFragment>{};
+  if (depth > 0) {
+    auto numberOfChildren = random() % (depth * 4);
+    for (size_t i = 0; i < numberOfChildren; i++) {
+      children.push_back(randomViewElement(random, tag, depth - 1));
+    }
+  }
+
+  return Element<ViewShadowNode>()
+      .tag(tag++)
+      .props([=] {
+        auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+        sharedProps->zIndex = zIndex;
+        sharedProps->pointerEvents = pointerEvents;
+        sharedProps->transform = transform;
+        sharedProps->yogaStyle.setPositionType(yoga::PositionType::Absolute);
+        return sharedProps;
+      })
+      .finalize([=](ViewShadowNode& shadowNode) {
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame = {.origin = origin, .size = size};
+        layoutMetrics.overflowInset = overflowInset;
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      })
+      .children(children);
+}
+
+} // namespace
+
+TEST(FindNodeAtPointTest, hitTestIndexMatchesRecursiveSearch) {
+  auto builder = simpleComponentBuilder();
+  auto random = std::mt19937{42};
+
+  for (int i = 0; i < 8; i++) {
+    auto tag = Tag{1};
+    auto children = std::vector<ElementFragment>{};
+    for (int j = 0; j < 40; j++) {
+      children.push_back(randomViewElement(random, tag, 2));
+    }
+    auto element = Element<ViewShadowNode>()
+                       .tag(tag++)
+                       .finalize([](ViewShadowNode& shadowNode) {
+                         auto layoutMetrics = EmptyLayoutMetrics;
+                         layoutMetrics.frame.size = {
+                             .width = 400, .height = 400};
+                         shadowNode.setLayoutMetrics(layoutMetrics);
+                       })
+                       .children(children);
+
+    auto parentShadowNode = builder.build(element);
+    auto hitTestIndex = HitTestIndex{};
+
+    for (Float x = -50; x <= 450; x += 7) {
+      for (Float y = -50; y <= 450; y += 7) {
+        auto point = Point{.x = x, .y = y};
+        EXPECT_EQ(
+            LayoutableShadowNode::findNodeAtPoint(
+                parentShadowNode, point, &hitTestIndex),
+            LayoutableShadowNode::findNodeAtPoint(parentShadowNode, point))
+            << "at (" << x << ", " << y << ")";
+      }
+    }
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/RawEventBuffer.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+static RawEvent createEvent(
+    std::string type,
+    SharedEventTarget eventTarget,
+    bool isUnique = false) {
+  return RawEvent(
+      std::move(type),
+      nullptr,
+      std::move(eventTarget),
+      {},
+      RawEvent::Category::Unspecified,
+      isUnique);
+}
+
+static std::vector<std::string> eventTypes(
+    const std::vector<RawEvent>& events) {
+  auto types = std::vector<std::string>{};
+  for (const auto& event : events) {
+    types.push_back(event.type);
+  }
+  return types;
+}
+
+TEST(RawEventBufferTest, drainPreservesOrder) {
+  auto buffer = RawEventBuffer{};
+  auto target = std::make_shared<EventTarget>(nullptr, 1);
+
+  EXPECT_TRUE(buffer.empty());
+
+  buffer.push(createEvent("A", target));
+  buffer.push(createEvent("B", nullptr));
+  buffer.push(createEvent("C", target));
+
+  EXPECT_FALSE(buffer.empty());
+  EXPECT_EQ(
+      eventTypes(buffer.drain()), (std::vector<std::string>{"A", "B", "C"}));
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_TRUE(buffer.drain().empty());
+}
+
+TEST(RawEventBufferTest, uniqueEventsAreCoalesced) {
+  auto buffer = RawEventBuffer{};
+  auto targetA = std::make_shared<EventTarget>(nullptr, 1);
+  auto targetB = std::make_shared<EventTarget>(nullptr, 1);
+
+  buffer.push(createEvent("scroll", targetA, true));
+  buffer.push(createEvent("scroll", targetB, true));
+  buffer.push(createEvent("scroll", targetA, true));
+
+  auto events = buffer.drain();
+  ASSERT_EQ(events.size(), 2);
+  // The coalesced event keeps the position of the replaced one.
+  EXPECT_EQ(events[0].eventTarget, targetA);
+  EXPECT_EQ(events[1].eventTarget, targetB);
+}
+
+TEST(RawEventBufferTest, coalescingKeepsOrderOfDifferentTypes) {
+  auto buffer = RawEventBuffer{};
+  auto target = std::make_shared<EventTarget>(nullptr, 1);
+
+  // A1, B1, A2: A1 must stay because B1 was dispatched in between.
+  buffer.push(createEvent("A", target, true));
+  buffer.push(createEvent("B", target, true));
+  buffer.push(createEvent("A", target, true));
+  // Non-unique events are never replaced.
+  buffer.push(createEvent("C", target));
+  buffer.push(createEvent("C", target, true));
+
+  EXPECT_EQ(
+      eventTypes(buffer.drain()),
+      (std::vector<std::string>{"A", "B", "A", "C", "C"}));
+}
+
+TEST(RawEventBufferTest, drainedEventsAreNotReplaced) {
+  auto buffer = RawEventBuffer{};
+  auto target = std::make_shared<EventTarget>(nullptr, 1);
+
+  buffer.push(createEvent("scroll", target, true));
+  EXPECT_EQ(buffer.drain().size(), 1);
+
+  // Coalescing only applies to the events drained together.
+  buffer.push(createEvent("scroll", target, true));
+  buffer.push(createEvent("scroll", target, true));
+  EXPECT_EQ(buffer.drain().size(), 1);
+  EXPECT_TRUE(buffer.empty());
+}
+
+TEST(RawEventBufferTest, concurrentProducers) {
+  auto buffer = RawEventBuffer{};
+  constexpr int kProducerCount = 4;
+  constexpr int kEventCount = 10000;
+
+  auto targets = std::vector<SharedEventTarget>{};
+  for (int i = 0; i < kProducerCount; i++) {
+    targets.push_back(std::make_shared<EventTarget>(nullptr, 1));
+  }
+
+  auto producers = std::vector<std::thread>{};
+  for (int i = 0; i < kProducerCount; i++) {
+    producers.emplace_back([&, i]() {
+      for (int j = 0; j < kEventCount; j++) {
+        buffer.push(createEvent(std::to_string(j), targets[i]));
+      }
+    });
+  }
+
+  // Draining concurrently with the producers.
+  auto events = std::vector<RawEvent>{};
+  while (events.size() < kProducerCount * kEventCount) {
+    for (auto& event : buffer.drain()) {
+      events.push_back(std::move(event));
+    }
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  ASSERT_EQ(events.size(), kProducerCount * kEventCount);
+
+  // Events of every producer must be delivered in order.
+  auto nextEventIndex = std::vector<int>(kProducerCount, 0);
+  for (const auto& event : events) {
+    for (int i = 0; i < kProducerCount; i++) {
+      if (event.eventTarget == targets[i]) {
+        EXPECT_EQ(event.type, std::to_string(nextEventIndex[i]++));
+      }
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -13,6 +13,7 @@
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/RawPropsKeyMap.h>
 #include <react/renderer/core/RawPropsParser.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/propsConversions.h>
@@ -467,3 +468,71 @@ TEST(RawPropsTest, copyJSIRawProps) {
   EXPECT_NEAR(
       copyProps->derivedFloatValue, originalProps->derivedFloatValue, 0.00001);
 }
+
+TEST(RawPropsTest, keyMapFindsAllKeysThroughPerfectHash) {
+  // Keeping the names alive for the whole test; `RawPropsKey` does not own
+  // them.
+  auto names = std::vector<std::string>{};
+  for (int i = 0; i < 500; i++) {
+    names.push_back("prop" + std::to_string(i));
+  }
+
+  auto map = RawPropsKeyMap{};
+  for (size_t i = 0; i < names.size(); i++) {
+    map.insert(
+        RawPropsKey{.prefix = "border", .name = names[i].c_str()},
+        static_cast<RawPropsValueIndex>(i));
+  }
+  // Duplicates are filtered out.
+  map.insert(
+      RawPropsKey{.prefix = "border", .name = names[0].c_str()},
+      static_cast<RawPropsValueIndex>(names.size()));
+  map.reindex();
+
+  EXPECT_TRUE(map.hasPerfectHash());
+
+  for (size_t i = 0; i < names.size(); i++) {
+    auto name = "border" + names[i];
+    EXPECT_EQ(
+        map.at(name.data(), static_cast<RawPropsPropNameLength>(name.size())),
+        i);
+  }
+
+  for (const auto& name : {
+           std::string{"prop0"},
+           std::string{"border"},
+           std::string{"borderprop"},
+           std::string{"borderprop500"},
+           std::string{"borderProp0"}}) {
+    EXPECT_EQ(
+        map.at(name.data(), static_cast<RawPropsPropNameLength>(name.size())),
+        kRawPropsValueIndexEmpty);
+  }
+}
+
+TEST(RawPropsTest, keyMapCanBeReindexedAfterInsertingMoreKeys) {
+  auto names = std::vector<std::string>{};
+  for (int i = 0; i < 200; i++) {
+    names.push_back("prop" + std::to_string(i));
+  }
+
+  auto map = RawPropsKeyMap{};
+  for (size_t i = 0; i < names.size(); i++) {
+    map.insert(
+        RawPropsKey{.name = names[i].c_str()},
+        static_cast<RawPropsValueIndex>(i));
+    if (i == names.size() / 2) {
+      map.reindex();
+    }
+  }
+  map.reindex();
+
+  EXPECT_TRUE(map.hasPerfectHash());
+  for (size_t i = 0; i < names.size(); i++) {
+    EXPECT_EQ(
+        map.at(
+            names[i].data(),
+            static_cast<RawPropsPropNameLength>(names[i].size())),
+        i);
+  }
+}
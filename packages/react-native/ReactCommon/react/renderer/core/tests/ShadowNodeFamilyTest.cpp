@@ -80,3 +80,67 @@ TEST(ShadowNodeFamilyTest, sealObjectCorrectly) {
   EXPECT_EQ(&ancestors2[0].first.get(), shadowNodeA.get());
   EXPECT_EQ(&ancestors2[1].first.get(), shadowNodeAA.get());
 }
+
+TEST(ShadowNodeFamilyTest, getAncestorsWithReorderedChildren) {
+  /*
+   * The structure:
+   * <A>
+   *  <AB/>
+   *  <AC/>
+   * </A>
+   */
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{
+              .eventDispatcher = eventDispatcher,
+              .contextContainer = nullptr,
+              .flavor = nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto shadowNodeAB = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeAC = std::shared_ptr<ViewShadowNode>{};
+
+  // clang-format off
+  auto elementA =
+      Element<ViewShadowNode>()
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .reference(shadowNodeAB),
+          Element<ViewShadowNode>()
+            .tag(3)
+            .reference(shadowNodeAC)
+        });
+  // clang-format on
+
+  auto shadowNodeA = builder.build(elementA);
+
+  // A newer revision of `A` with the children swapped.
+  auto shadowNodeA2 = shadowNodeA->clone(
+      {.children = std::make_shared<
+           const std::vector<std::shared_ptr<const ShadowNode>>>(
+           std::vector<std::shared_ptr<const ShadowNode>>{
+               shadowNodeAC, shadowNodeAB})});
+
+  // Both revisions must resolve correct indices, regardless of the order in
+  // which they are queried.
+  for (int i = 0; i < 2; i++) {
+    auto ancestors = shadowNodeAC->getFamily().getAncestors(*shadowNodeA);
+    EXPECT_EQ(ancestors.size(), 1);
+    EXPECT_EQ(&ancestors[0].first.get(), shadowNodeA.get());
+    EXPECT_EQ(ancestors[0].second, 1);
+
+    auto newAncestors =
+        shadowNodeAC->getFamily().getAncestors(*shadowNodeA2);
+    EXPECT_EQ(newAncestors.size(), 1);
+    EXPECT_EQ(&newAncestors[0].first.get(), shadowNodeA2.get());
+    EXPECT_EQ(newAncestors[0].second, 0);
+  }
+}
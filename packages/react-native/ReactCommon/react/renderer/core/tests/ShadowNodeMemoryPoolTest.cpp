@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
+
+using namespace facebook::react;
+
+TEST(ShadowNodeMemoryPoolTest, releasedBlocksAreReused) {
+  auto& pool = ShadowNodeMemoryPool::shared();
+
+  auto* blockA = pool.allocate(100);
+  pool.deallocate(blockA, 100);
+
+  auto countersBefore = ShadowNodeMemoryPool::threadLocalCounters();
+
+  // Same size class (rounded up to the block alignment).
+  auto* blockB = pool.allocate(104);
+  EXPECT_EQ(blockA, blockB);
+
+  auto countersAfter = ShadowNodeMemoryPool::threadLocalCounters();
+  EXPECT_EQ(countersAfter.allocations - countersBefore.allocations, 1);
+  EXPECT_EQ(countersAfter.systemAllocations, countersBefore.systemAllocations);
+
+  pool.deallocate(blockB, 104);
+}
+
+TEST(ShadowNodeMemoryPoolTest, oversizedBlocksAreServedBySystem) {
+  auto& pool = ShadowNodeMemoryPool::shared();
+  auto size = ShadowNodeMemoryPool::kMaxPooledBlockSize + 1;
+
+  auto countersBefore = ShadowNodeMemoryPool::threadLocalCounters();
+  auto* block = pool.allocate(size);
+  auto countersAfter = ShadowNodeMemoryPool::threadLocalCounters();
+
+  EXPECT_NE(block, nullptr);
+  EXPECT_EQ(
+      countersAfter.systemAllocations - countersBefore.systemAllocations, 1);
+
+  pool.deallocate(block, size);
+}
+
+TEST(ShadowNodeMemoryPoolTest, allocateSharedSupportsWeakReferences) {
+  auto weakString = std::weak_ptr<std::string>{};
+
+  {
+    auto string = std::allocate_shared<std::string>(
+        ShadowNodeAllocator<std::string>{},
+        "A string that does not fit into the small buffer.");
+    weakString = string;
+    EXPECT_FALSE(weakString.expired());
+    EXPECT_EQ(*weakString.lock(), *string);
+  }
+
+  EXPECT_TRUE(weakString.expired());
+}
+
+TEST(ShadowNodeMemoryPoolTest, blocksCanBeReleasedOnAnotherThread) {
+  auto lists = std::vector<std::shared_ptr<std::vector<int>>>{};
+  for (int i = 0; i < 1000; i++) {
+    lists.push_back(std::allocate_shared<std::vector<int>>(
+        ShadowNodeAllocator<std::vector<int>>{}, 4, i));
+  }
+
+  auto thread = std::thread([lists = std::move(lists)]() mutable {
+    for (int i = 0; i < static_cast<int>(lists.size()); i++) {
+      EXPECT_EQ(lists[i]->at(3), i);
+    }
+    lists.clear();
+  });
+  thread.join();
+
+  auto list = std::allocate_shared<std::vector<int>>(
+      ShadowNodeAllocator<std::vector<int>>{}, 4, 42);
+  EXPECT_EQ(list->at(0), 42);
+}
+
+TEST(ShadowNodeMemoryPoolTest, countersCanBeTaken) {
+  auto& pool = ShadowNodeMemoryPool::shared();
+  ShadowNodeMemoryPool::takeThreadLocalCounters();
+
+  auto* blockA = pool.allocate(100);
+  auto* blockB = pool.allocate(100);
+  pool.deallocate(blockA, 100);
+  pool.deallocate(blockB, 100);
+
+  EXPECT_EQ(ShadowNodeMemoryPool::takeThreadLocalCounters().allocations, 2);
+  EXPECT_EQ(ShadowNodeMemoryPool::takeThreadLocalCounters().allocations, 0);
+}
+
+TEST(ShadowNodeMemoryPoolTest, trimReleasesUnusedChunks) {
+  auto pool = ShadowNodeMemoryPool{};
+  constexpr size_t kBlockSize = 64;
+  constexpr size_t kBlocksPerChunk = 16 * 1024 / kBlockSize;
+
+  auto blocks = std::vector<void*>{};
+  for (size_t i = 0; i < kBlocksPerChunk + 1; i++) {
+    blocks.push_back(pool.allocate(kBlockSize));
+  }
+  EXPECT_EQ(pool.getChunkSizeInBytes(), 2 * 16 * 1024);
+  EXPECT_EQ(pool.trim(), 0);
+
+  // Keeps one block of the first chunk alive.
+  for (size_t i = 1; i < blocks.size(); i++) {
+    pool.deallocate(blocks[i], kBlockSize);
+  }
+  EXPECT_EQ(pool.trim(), 16 * 1024);
+  EXPECT_EQ(pool.getChunkSizeInBytes(), 16 * 1024);
+
+  // The remaining free blocks are still handed out.
+  auto* block = pool.allocate(kBlockSize);
+  EXPECT_NE(block, nullptr);
+  pool.deallocate(block, kBlockSize);
+  pool.deallocate(blocks[0], kBlockSize);
+  EXPECT_EQ(pool.trim(), 16 * 1024);
+  EXPECT_EQ(pool.getChunkSizeInBytes(), 0);
+}
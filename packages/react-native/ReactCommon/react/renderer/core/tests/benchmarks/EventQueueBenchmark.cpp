@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventQueueProcessor.h>
+#include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/RawEventBuffer.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kEventsPerProducer = 10000;
+constexpr int kTargetsPerProducer = 8;
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto eventProcessor = EventQueueProcessor{
+    [](jsi::Runtime& /*runtime*/,
+       const EventTarget* /*eventTarget*/,
+       const std::string& /*type*/,
+       ReactEventPriority /*priority*/,
+       const EventPayload& /*payload*/) {},
+    [](jsi::Runtime& /*runtime*/) {},
+    [](const StateUpdate& /*stateUpdate*/) {},
+    std::weak_ptr<EventLogger>{}};
+
+/*
+ * The previous implementation of the event queue: a vector protected by a
+ * mutex, coalescing unique events by scanning the queue backwards.
+ */
+class LockedEventQueue {
+ public:
+  void push(RawEvent&& rawEvent) {
+    std::scoped_lock lock(mutex_);
+
+    if (rawEvent.isUnique) {
+      for (auto it = queue_.rbegin(); it != queue_.rend(); ++it) {
+        if (it->eventTarget == rawEvent.eventTarget) {
+          if (it->isUnique && it->type == rawEvent.type) {
+            *it = std::move(rawEvent);
+            return;
+          }
+          break;
+        }
+      }
+    }
+
+    queue_.push_back(std::move(rawEvent));
+  }
+
+  std::vector<RawEvent> drain() {
+    std::scoped_lock lock(mutex_);
+    auto queue = std::move(queue_);
+    queue_.clear();
+    return queue;
+  }
+
+ private:
+  std::vector<RawEvent> queue_;
+  std::mutex mutex_;
+};
+
+/*
+ * Every producer alternates unique `scroll` events and regular `touch` events
+ * over its own set of targets, while the calling thread keeps flushing the
+ * queue through `EventQueueProcessor`.
+ */
+template <typename QueueT>
+static void produceAndFlush(benchmark::State& state) {
+  auto producerCount = static_cast<int>(state.range(0));
+
+  auto targets = std::vector<SharedEventTarget>{};
+  for (int i = 0; i < producerCount * kTargetsPerProducer; i++) {
+    targets.push_back(std::make_shared<EventTarget>(nullptr, 1));
+  }
+
+  for (auto _ : state) {
+    auto queue = QueueT{};
+    auto finishedProducerCount = std::atomic<int>{0};
+
+    auto producers = std::vector<std::thread>{};
+    for (int i = 0; i < producerCount; i++) {
+      producers.emplace_back([&, i]() {
+        for (int j = 0; j < kEventsPerProducer; j++) {
+          const auto& target =
+              targets[i * kTargetsPerProducer + j % kTargetsPerProducer];
+          auto isUnique = j % 4 != 0;
+          queue.push(RawEvent(
+              isUnique ? "scroll" : "touch",
+              nullptr,
+              target,
+              {},
+              isUnique ? RawEvent::Category::Continuous
+                       : RawEvent::Category::Discrete,
+              isUnique));
+        }
+        finishedProducerCount++;
+      });
+    }
+
+    auto flushedEventCount = size_t{0};
+    while (finishedProducerCount.load() < producerCount) {
+      auto events = queue.drain();
+      flushedEventCount += events.size();
+      eventProcessor.flushEvents(*runtime, std::move(events));
+    }
+
+    for (auto& producer : producers) {
+      producer.join();
+    }
+
+    auto events = queue.drain();
+    flushedEventCount += events.size();
+    eventProcessor.flushEvents(*runtime, std::move(events));
+
+    state.counters["flushedEvents"] = static_cast<double>(flushedEventCount);
+  }
+
+  state.SetItemsProcessed(
+      state.iterations() * producerCount * kEventsPerProducer);
+}
+
+static void lockedEventQueue(benchmark::State& state) {
+  produceAndFlush<LockedEventQueue>(state);
+}
+BENCHMARK(lockedEventQueue)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+static void rawEventBuffer(benchmark::State& state) {
+  produceAndFlush<RawEventBuffer>(state);
+}
+BENCHMARK(rawEventBuffer)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -8,6 +8,7 @@
 #include <benchmark/benchmark.h>
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <react/renderer/components/text/TextComponentDescriptor.h>
 #include <react/renderer/components/view/ViewComponentDescriptor.h>
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/RawProps.h>
@@ -23,6 +24,10 @@ auto viewComponentDescriptor =
     ViewComponentDescriptor{ComponentDescriptorParameters{
         .eventDispatcher = eventDispatcher,
         .contextContainer = contextContainer}};
+auto textComponentDescriptor =
+    TextComponentDescriptor{ComponentDescriptorParameters{
+        .eventDispatcher = eventDispatcher,
+        .contextContainer = contextContainer}};
 
 auto emptyPropsDynamic = folly::parseJson("{}");
 auto propsString = std::string{
@@ -33,6 +38,13 @@ auto propsStringWithSomeUnsupportedProps = std::string{
 auto unsupportedPropsDynamic =
     folly::parseJson(propsStringWithSomeUnsupportedProps);
 
+auto manyPropsString = std::string{
+    R"({"flex": 1, "flexDirection": "row", "alignItems": "center", "justifyContent": "space-between", "paddingHorizontal": 16, "paddingVertical": 8, "marginTop": 4, "borderRadius": 8, "borderWidth": 1, "borderColor": 255, "backgroundColor": 4294967295, "opacity": 0.9, "overflow": "hidden", "testID": "row", "accessible": true, "accessibilityLabel": "Row", "pointerEvents": "box-none", "zIndex": 1, "width": 320, "height": 48})"};
+auto manyPropsDynamic = folly::parseJson(manyPropsString);
+auto textPropsString = std::string{
+    R"({"fontSize": 14, "fontWeight": "600", "fontFamily": "System", "color": 4278190080, "lineHeight": 20, "letterSpacing": 0.5, "textAlign": "center", "numberOfLines": 2, "ellipsizeMode": "tail", "allowFontScaling": true, "selectable": false, "testID": "label"})"};
+auto textPropsDynamic = folly::parseJson(textPropsString);
+
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
@@ -84,6 +96,27 @@ static void propParsingRegularRawPropsWithNoSourceProps(
 }
 BENCHMARK(propParsingRegularRawPropsWithNoSourceProps);
 
+static void propParsingManyRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  for (auto _ : state) {
+    viewComponentDescriptor.cloneProps(
+        parserContext, sharedSourceProps, RawProps{manyPropsDynamic});
+  }
+}
+BENCHMARK(propParsingManyRawProps);
+
+static void textPropParsingRegularRawProps(benchmark::State& state) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  auto sharedTextSourceProps = TextShadowNode::defaultSharedProps();
+  for (auto _ : state) {
+    textComponentDescriptor.cloneProps(
+        parserContext, sharedTextSourceProps, RawProps{textPropsDynamic});
+  }
+}
+BENCHMARK(textPropParsingRegularRawProps);
+
 } // namespace facebook::react
 
 BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/utils/ContextContainer.h>
+#include <vector>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{ComponentDescriptorParameters{
+        .eventDispatcher = eventDispatcher,
+        .contextContainer = contextContainer}};
+
+static std::shared_ptr<const ShadowNode> createViewShadowNode(
+    Tag tag,
+    std::vector<std::shared_ptr<const ShadowNode>> children = {}) {
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          .props = ViewShadowNode::defaultSharedProps(),
+          .children = std::make_shared<
+              const std::vector<std::shared_ptr<const ShadowNode>>>(
+              std::move(children))},
+      viewComponentDescriptor.createFamily(
+          {.tag = tag, .surfaceId = 1, .instanceHandle = nullptr}));
+}
+
+/*
+ * Builds a tree of `depth` levels where every level has `width` siblings and
+ * only the last sibling has children (a list nested in a list, etc.).
+ * Returns the root and the deepest node.
+ */
+static std::pair<std::shared_ptr<const ShadowNode>, const ShadowNodeFamily*>
+buildWideTree(int depth, int width) {
+  Tag tag = 1;
+  auto node = createViewShadowNode(tag++);
+  const auto* deepestFamily = &node->getFamily();
+
+  for (int level = 0; level < depth; level++) {
+    auto children = std::vector<std::shared_ptr<const ShadowNode>>{};
+    children.reserve(width);
+    for (int i = 0; i < width - 1; i++) {
+      children.push_back(createViewShadowNode(tag++));
+    }
+    children.push_back(node);
+    node = createViewShadowNode(tag++, std::move(children));
+  }
+
+  return {node, deepestFamily};
+}
+
+static void getAncestorsInWideTree(benchmark::State& state) {
+  auto [root, family] = buildWideTree(8, static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family->getAncestors(*root));
+  }
+}
+BENCHMARK(getAncestorsInWideTree)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void getAncestorsInClonedWideTree(benchmark::State& state) {
+  auto [root, family] = buildWideTree(8, static_cast<int>(state.range(0)));
+
+  // Cloning the spine keeps the children lists (and the cached indices) of
+  // all siblings intact.
+  auto ancestors = family->getAncestors(*root);
+  auto& deepestParent = ancestors.back().first.get();
+  auto newRoot = root->cloneTree(
+      deepestParent.getFamily(),
+      [](const ShadowNode& oldShadowNode) { return oldShadowNode.clone({}); });
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(family->getAncestors(*newRoot));
+  }
+}
+BENCHMARK(getAncestorsInClonedWideTree)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
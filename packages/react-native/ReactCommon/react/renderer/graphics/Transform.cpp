@@ -7,14 +7,287 @@
 
 #include "Transform.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <glog/logging.h>
 #include <react/debug/react_native_assert.h>
 #include <react/utils/FloatComparison.h>
 
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define REACT_TRANSFORM_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define REACT_TRANSFORM_NEON 1
+#endif
+
 namespace facebook::react {
 
+namespace {
+
+// The matrices are stored row by row, and vectors are transformed as rows
+// (`v' = v * M`), so the last row holds the translation.
+// The SIMD kernels below perform the same operations in the same order as
+// the generic ones. `Float` is `double` on some platforms; those use the
+// generic kernels.
+
+constexpr std::array<Float, 16> kIdentityMatrix{
+    {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+
+bool isIdentity(const Transform& transform) noexcept {
+  return transform.operations.empty() && transform.matrix == kIdentityMatrix;
+}
+
+/*
+ * Computes `lhs * rhs`.
+ */
+template <typename T>
+void multiplyMatrices(const T* lhs, const T* rhs, T* result) noexcept {
+  for (int i = 0; i < 4; i++) {
+    auto rhs0 = rhs[(i * 4) + 0];
+    auto rhs1 = rhs[(i * 4) + 1];
+    auto rhs2 = rhs[(i * 4) + 2];
+    auto rhs3 = rhs[(i * 4) + 3];
+    for (int j = 0; j < 4; j++) {
+      result[(i * 4) + j] = rhs0 * lhs[j] + rhs1 * lhs[4 + j] +
+          rhs2 * lhs[8 + j] + rhs3 * lhs[12 + j];
+    }
+  }
+}
+
+#if defined(REACT_TRANSFORM_SSE)
+
+[[maybe_unused]] void multiplyMatrices(
+    const float* lhs,
+    const float* rhs,
+    float* result) noexcept {
+  auto lhs0 = _mm_loadu_ps(lhs);
+  auto lhs1 = _mm_loadu_ps(lhs + 4);
+  auto lhs2 = _mm_loadu_ps(lhs + 8);
+  auto lhs3 = _mm_loadu_ps(lhs + 12);
+  for (int i = 0; i < 4; i++) {
+    auto row = _mm_mul_ps(_mm_set1_ps(rhs[(i * 4) + 0]), lhs0);
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(rhs[(i * 4) + 1]), lhs1));
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(rhs[(i * 4) + 2]), lhs2));
+    row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(rhs[(i * 4) + 3]), lhs3));
+    _mm_storeu_ps(result + (i * 4), row);
+  }
+}
+
+#elif defined(REACT_TRANSFORM_NEON)
+
+[[maybe_unused]] void multiplyMatrices(
+    const float* lhs,
+    const float* rhs,
+    float* result) noexcept {
+  auto lhs0 = vld1q_f32(lhs);
+  auto lhs1 = vld1q_f32(lhs + 4);
+  auto lhs2 = vld1q_f32(lhs + 8);
+  auto lhs3 = vld1q_f32(lhs + 12);
+  for (int i = 0; i < 4; i++) {
+    // Not fused, like the multiplications and additions of the generic kernel.
+    auto row = vmulq_n_f32(lhs0, rhs[(i * 4) + 0]);
+    row = vaddq_f32(row, vmulq_n_f32(lhs1, rhs[(i * 4) + 1]));
+    row = vaddq_f32(row, vmulq_n_f32(lhs2, rhs[(i * 4) + 2]));
+    row = vaddq_f32(row, vmulq_n_f32(lhs3, rhs[(i * 4) + 3]));
+    vst1q_f32(result + (i * 4), row);
+  }
+}
+
+#endif
+
+/*
+ * Computes the bounding rect of the given rect transformed around `center`.
+ * Only the 2D affine part of the matrix affects points with `z = 0` and
+ * `w = 1`, so the corners are transformed with six coefficients.
+ */
+template <typename T>
+Rect transformRect(const T* matrix, const Rect& rect, const Point& center) {
+  auto transformCorner = [&](T x, T y) {
+    x -= center.x;
+    y -= center.y;
+    return Point{
+        .x = x * matrix[0] + y * matrix[4] + matrix[12] + center.x,
+        .y = x * matrix[1] + y * matrix[5] + matrix[13] + center.y};
+  };
+
+  return Rect::boundingRect(
+      transformCorner(rect.origin.x, rect.origin.y),
+      transformCorner(rect.getMaxX(), rect.origin.y),
+      transformCorner(rect.getMaxX(), rect.getMaxY()),
+      transformCorner(rect.origin.x, rect.getMaxY()));
+}
+
+#if defined(REACT_TRANSFORM_SSE)
+
+[[maybe_unused]] Rect transformRect(
+    const float* matrix,
+    const Rect& rect,
+    const Point& center) {
+  auto left = rect.origin.x - center.x;
+  auto right = rect.getMaxX() - center.x;
+  auto top = rect.origin.y - center.y;
+  auto bottom = rect.getMaxY() - center.y;
+  // The four corners, one per lane (`_mm_set_ps` takes the last lane first).
+  auto xs = _mm_set_ps(left, right, right, left);
+  auto ys = _mm_set_ps(bottom, bottom, top, top);
+
+  auto x = _mm_add_ps(
+      _mm_add_ps(
+          _mm_add_ps(
+              _mm_mul_ps(xs, _mm_set1_ps(matrix[0])),
+              _mm_mul_ps(ys, _mm_set1_ps(matrix[4]))),
+          _mm_set1_ps(matrix[12])),
+      _mm_set1_ps(center.x));
+  auto y = _mm_add_ps(
+      _mm_add_ps(
+          _mm_add_ps(
+              _mm_mul_ps(xs, _mm_set1_ps(matrix[1])),
+              _mm_mul_ps(ys, _mm_set1_ps(matrix[5]))),
+          _mm_set1_ps(matrix[13])),
+      _mm_set1_ps(center.y));
+
+  // Horizontal minimums and maximums of `x` and `y` at once: the low half of
+  // `xy` holds the `x` lanes 0 and 1, the high half the `y` lanes 0 and 1.
+  auto xy01 = _mm_movelh_ps(x, y);
+  auto xy23 = _mm_movehl_ps(y, x);
+  auto minimums = _mm_min_ps(xy01, xy23);
+  auto maximums = _mm_max_ps(xy01, xy23);
+  minimums = _mm_min_ps(
+      minimums, _mm_shuffle_ps(minimums, minimums, _MM_SHUFFLE(2, 3, 0, 1)));
+  maximums = _mm_max_ps(
+      maximums, _mm_shuffle_ps(maximums, maximums, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  float mins[4];
+  float maxs[4];
+  _mm_storeu_ps(mins, minimums);
+  _mm_storeu_ps(maxs, maximums);
+
+  return {
+      .origin = {.x = mins[0], .y = mins[2]},
+      .size = {.width = maxs[0] - mins[0], .height = maxs[2] - mins[2]}};
+}
+
+#elif defined(REACT_TRANSFORM_NEON)
+
+[[maybe_unused]] Rect transformRect(
+    const float* matrix,
+    const Rect& rect,
+    const Point& center) {
+  auto left = rect.origin.x - center.x;
+  auto right = rect.getMaxX() - center.x;
+  auto top = rect.origin.y - center.y;
+  auto bottom = rect.getMaxY() - center.y;
+  const float xsArray[4] = {left, right, right, left};
+  const float ysArray[4] = {top, top, bottom, bottom};
+  auto xs = vld1q_f32(xsArray);
+  auto ys = vld1q_f32(ysArray);
+
+  auto x = vaddq_f32(
+      vaddq_f32(
+          vaddq_f32(vmulq_n_f32(xs, matrix[0]), vmulq_n_f32(ys, matrix[4])),
+          vdupq_n_f32(matrix[12])),
+      vdupq_n_f32(center.x));
+  auto y = vaddq_f32(
+      vaddq_f32(
+          vaddq_f32(vmulq_n_f32(xs, matrix[1]), vmulq_n_f32(ys, matrix[5])),
+          vdupq_n_f32(matrix[13])),
+      vdupq_n_f32(center.y));
+
+  // Pairwise minimums and maximums of `x` and `y` lanes at once.
+  auto minimums = vpmin_f32(
+      vpmin_f32(vget_low_f32(x), vget_high_f32(x)),
+      vpmin_f32(vget_low_f32(y), vget_high_f32(y)));
+  auto maximums = vpmax_f32(
+      vpmax_f32(vget_low_f32(x), vget_high_f32(x)),
+      vpmax_f32(vget_low_f32(y), vget_high_f32(y)));
+
+  auto resultMinX = vget_lane_f32(minimums, 0);
+  auto resultMinY = vget_lane_f32(minimums, 1);
+  return {
+      .origin = {.x = resultMinX, .y = resultMinY},
+      .size = {
+          .width = vget_lane_f32(maximums, 0) - resultMinX,
+          .height = vget_lane_f32(maximums, 1) - resultMinY}};
+}
+
+#endif
+
+/*
+ * Inverts the matrix by expanding it into 2x2 sub-determinants; 2D affine
+ * matrices, the most common ones, take a shortcut. Returns `false` if the
+ * matrix is singular.
+ */
+template <typename T>
+bool invertMatrix(const T* m, T* result) noexcept {
+  auto isAffine2D = m[2] == 0 && m[3] == 0 && m[6] == 0 && m[7] == 0 &&
+      m[8] == 0 && m[9] == 0 && m[10] == 1 && m[11] == 0 && m[14] == 0 &&
+      m[15] == 1;
+
+  if (isAffine2D) {
+    auto determinant = m[0] * m[5] - m[1] * m[4];
+    if (determinant == 0 || !std::isfinite(determinant)) {
+      return false;
+    }
+    auto inverseDeterminant = 1 / determinant;
+    std::copy_n(kIdentityMatrix.begin(), 16, result);
+    result[0] = m[5] * inverseDeterminant;
+    result[1] = -m[1] * inverseDeterminant;
+    result[4] = -m[4] * inverseDeterminant;
+    result[5] = m[0] * inverseDeterminant;
+    result[12] = -(m[12] * result[0] + m[13] * result[4]);
+    result[13] = -(m[12] * result[1] + m[13] * result[5]);
+    return true;
+  }
+
+  auto s0 = m[0] * m[5] - m[4] * m[1];
+  auto s1 = m[0] * m[6] - m[4] * m[2];
+  auto s2 = m[0] * m[7] - m[4] * m[3];
+  auto s3 = m[1] * m[6] - m[5] * m[2];
+  auto s4 = m[1] * m[7] - m[5] * m[3];
+  auto s5 = m[2] * m[7] - m[6] * m[3];
+
+  auto c5 = m[10] * m[15] - m[14] * m[11];
+  auto c4 = m[9] * m[15] - m[13] * m[11];
+  auto c3 = m[9] * m[14] - m[13] * m[10];
+  auto c2 = m[8] * m[15] - m[12] * m[11];
+  auto c1 = m[8] * m[14] - m[12] * m[10];
+  auto c0 = m[8] * m[13] - m[12] * m[9];
+
+  auto determinant =
+      s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  if (determinant == 0 || !std::isfinite(determinant)) {
+    return false;
+  }
+  auto inverseDeterminant = 1 / determinant;
+
+  result[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * inverseDeterminant;
+  result[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * inverseDeterminant;
+  result[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * inverseDeterminant;
+  result[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * inverseDeterminant;
+
+  result[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * inverseDeterminant;
+  result[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * inverseDeterminant;
+  result[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * inverseDeterminant;
+  result[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * inverseDeterminant;
+
+  result[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * inverseDeterminant;
+  result[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * inverseDeterminant;
+  result[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * inverseDeterminant;
+  result[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * inverseDeterminant;
+
+  result[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * inverseDeterminant;
+  result[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * inverseDeterminant;
+  result[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * inverseDeterminant;
+  result[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * inverseDeterminant;
+
+  return true;
+}
+
+} // namespace
+
 /* static */ Transform Transform::Identity() noexcept {
   return {};
 }
@@ -361,12 +634,12 @@ bool Transform::operator!=(const Transform& rhs) const noexcept {
 }
 
 Transform Transform::operator*(const Transform& rhs) const {
-  if (*this == Transform::Identity()) {
+  if (isIdentity(*this)) {
     return rhs;
   }
 
-  const auto& lhs = *this;
   auto result = Transform{};
+  result.operations.reserve(operations.size() + rhs.operations.size());
   for (const auto& op : this->operations) {
     if (op.type == TransformOperationType::Identity &&
         !result.operations.empty()) {
@@ -382,62 +655,21 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  multiplyMatrices(matrix.data(), rhs.matrix.data(), result.matrix.data());
 
   return result;
 }
 
+std::optional<Transform> Transform::inverse() const {
+  auto result = Transform{};
+  if (!invertMatrix(matrix.data(), result.matrix.data())) {
+    return std::nullopt;
+  }
+  auto operation = DefaultTransformOperation(TransformOperationType::Arbitrary);
+  result.operations.push_back(operation);
+  return result;
+}
+
 Float& Transform::at(int i, int j) noexcept {
   return matrix[(i * 4) + j];
 }
@@ -447,13 +679,16 @@ const Float& Transform::at(int i, int j) const noexcept {
 }
 
 Point operator*(const Point& point, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (isIdentity(transform)) {
     return point;
   }
 
-  auto result = transform * Vector{.x = point.x, .y = point.y, .z = 0, .w = 1};
-
-  return {.x = result.x, .y = result.y};
+  // Only the 2D affine part of the matrix affects points with `z = 0` and
+  // `w = 1`.
+  const auto& matrix = transform.matrix;
+  return {
+      .x = point.x * matrix[0] + point.y * matrix[4] + matrix[12],
+      .y = point.x * matrix[1] + point.y * matrix[5] + matrix[13]};
 }
 
 Rect operator*(const Rect& rect, const Transform& transform) {
@@ -462,23 +697,7 @@ Rect operator*(const Rect& rect, const Transform& transform) {
 }
 
 Rect Transform::applyWithCenter(const Rect& rect, const Point& center) const {
-  auto a = Point{.x = rect.origin.x, .y = rect.origin.y} - center;
-  auto b = Point{.x = rect.getMaxX(), .y = rect.origin.y} - center;
-  auto c = Point{.x = rect.getMaxX(), .y = rect.getMaxY()} - center;
-  auto d = Point{.x = rect.origin.x, .y = rect.getMaxY()} - center;
-
-  auto vectorA = *this * Vector{.x = a.x, .y = a.y, .z = 0, .w = 1};
-  auto vectorB = *this * Vector{.x = b.x, .y = b.y, .z = 0, .w = 1};
-  auto vectorC = *this * Vector{.x = c.x, .y = c.y, .z = 0, .w = 1};
-  auto vectorD = *this * Vector{.x = d.x, .y = d.y, .z = 0, .w = 1};
-
-  Point transformedA{.x = vectorA.x + center.x, .y = vectorA.y + center.y};
-  Point transformedB{.x = vectorB.x + center.x, .y = vectorB.y + center.y};
-  Point transformedC{.x = vectorC.x + center.x, .y = vectorC.y + center.y};
-  Point transformedD{.x = vectorD.x + center.x, .y = vectorD.y + center.y};
-
-  return Rect::boundingRect(
-      transformedA, transformedB, transformedC, transformedD);
+  return transformRect(matrix.data(), rect, center);
 }
 
 EdgeInsets operator*(const EdgeInsets& edgeInsets, const Transform& transform) {
@@ -503,7 +722,7 @@ Vector operator*(const Transform& transform, const Vector& vector) {
 }
 
 Size operator*(const Size& size, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (isIdentity(transform)) {
     return size;
   }
 
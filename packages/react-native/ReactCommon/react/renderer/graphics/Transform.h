@@ -8,6 +8,7 @@
 #pragma once
 
 #include <array>
+#include <optional>
 #include <vector>
 
 #include <react/renderer/debug/flags.h>
@@ -172,6 +173,12 @@ struct Transform {
    */
   Transform operator*(const Transform &rhs) const;
 
+  /*
+   * Returns the inverse transform (an `Arbitrary` operation with the inverted
+   * matrix), or `std::nullopt` if the matrix is not invertible.
+   */
+  std::optional<Transform> inverse() const;
+
   Rect applyWithCenter(const Rect &rect, const Point &center) const;
 
   /**
@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 using namespace facebook::react;
 
@@ -134,3 +135,41 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, invertingTransform) {
+  auto transforms = std::vector<Transform>{
+      Transform::Scale(2, 0.5, 1) * Transform::Translate(10, -20, 0),
+      Transform::RotateZ(M_PI_4) * Transform::Skew(0.1, 0.2),
+      Transform::Rotate(0.3, 0.5, 0.7) * Transform::Perspective(500) *
+          Transform::Translate(1, 2, 3)};
+
+  for (const auto& transform : transforms) {
+    auto inverse = transform.inverse();
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_EQ(inverse->operations.size(), 1);
+    EXPECT_EQ(inverse->operations[0].type, TransformOperationType::Arbitrary);
+
+    auto product = transform * *inverse;
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        EXPECT_NEAR(product.at(i, j), i == j ? 1 : 0, 0.0001);
+      }
+    }
+  }
+}
+
+TEST(TransformTest, invertingAffineTransform) {
+  auto transform = Transform::RotateZ(M_PI_4) * Transform::Scale(2, 3, 1) *
+      Transform::Translate(10, -20, 0);
+  auto inverse = transform.inverse();
+  ASSERT_TRUE(inverse.has_value());
+
+  auto point = facebook::react::Point{30, 40} * transform * *inverse;
+  EXPECT_NEAR(point.x, 30, 0.0001);
+  EXPECT_NEAR(point.y, 40, 0.0001);
+}
+
+TEST(TransformTest, invertingSingularTransform) {
+  EXPECT_FALSE(Transform::Scale(0, 1, 1).inverse().has_value());
+  EXPECT_FALSE(Transform::Scale(1, 1, 0).inverse().has_value());
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kCount = 1024;
+
+/*
+ * A mix of the transforms views usually have: translations and scales from
+ * animations, and occasional rotations and perspective.
+ */
+static std::vector<Transform> createTransforms() {
+  auto random = std::mt19937{7};
+  auto distribution = std::uniform_real_distribution<Float>{-1, 1};
+  auto transforms = std::vector<Transform>{};
+  transforms.reserve(kCount);
+  for (int i = 0; i < kCount; i++) {
+    auto transform = Transform::Translate(
+        distribution(random) * 100, distribution(random) * 100, 0);
+    switch (random() % 4) {
+      case 0: {
+        auto scale = 1 + distribution(random) / 2;
+        transform = transform * Transform::Scale(scale, scale, 1);
+        break;
+      }
+      case 1:
+        transform = transform * Transform::RotateZ(distribution(random));
+        break;
+      case 2:
+        transform = transform * Transform::Perspective(500) *
+            Transform::RotateX(distribution(random));
+        break;
+      default:
+        break;
+    }
+    transforms.push_back(transform);
+  }
+  return transforms;
+}
+
+static std::vector<Rect> createRects() {
+  auto random = std::mt19937{11};
+  auto distribution = std::uniform_real_distribution<Float>{0, 500};
+  auto rects = std::vector<Rect>{};
+  rects.reserve(kCount);
+  for (int i = 0; i < kCount; i++) {
+    rects.push_back(
+        Rect{
+            .origin = {.x = distribution(random), .y = distribution(random)},
+            .size = {
+                .width = distribution(random),
+                .height = distribution(random)}});
+  }
+  return rects;
+}
+
+auto transforms = createTransforms();
+auto rects = createRects();
+
+static void rectTimesTransform(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < kCount; i++) {
+      benchmark::DoNotOptimize(rects[i] * transforms[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(rectTimesTransform);
+
+static void pointTimesTransform(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < kCount; i++) {
+      benchmark::DoNotOptimize(rects[i].origin * transforms[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(pointTimesTransform);
+
+/*
+ * Accumulates the transforms of ancestors, the way `CullingContext` and
+ * `LayoutableShadowNode::computeRelativeLayoutMetrics` do.
+ */
+static void transformTimesTransform(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i + 1 < kCount; i++) {
+      benchmark::DoNotOptimize(transforms[i] * transforms[i + 1]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (kCount - 1));
+}
+BENCHMARK(transformTimesTransform);
+
+static void invertTransform(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < kCount; i++) {
+      benchmark::DoNotOptimize(transforms[i].inverse());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(invertTransform);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageCache.h"
+
+namespace facebook::react {
+
+ImageCache::ImageCache(size_t capacityInBytes)
+    : capacityInBytes_(capacityInBytes) {}
+
+std::optional<LoadedImage> ImageCache::get(const ImageCacheKey& key) {
+  if (key.reload) {
+    return std::nullopt;
+  }
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    return std::nullopt;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->second;
+}
+
+bool ImageCache::contains(const ImageCacheKey& key) const {
+  return !key.reload && index_.find(key) != index_.end();
+}
+
+void ImageCache::put(ImageCacheKey key, LoadedImage loadedImage) {
+  // Reloaded images are returned to all later requests.
+  key.reload = false;
+  if (auto it = index_.find(key); it != index_.end()) {
+    sizeInBytes_ -= it->second->second.byteSize;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+
+  if (loadedImage.byteSize > capacityInBytes_) {
+    return;
+  }
+
+  evict(capacityInBytes_ - loadedImage.byteSize);
+  sizeInBytes_ += loadedImage.byteSize;
+  entries_.emplace_front(key, std::move(loadedImage));
+  index_.emplace(key, entries_.begin());
+}
+
+size_t ImageCache::size() const {
+  return entries_.size();
+}
+
+size_t ImageCache::getSizeInBytes() const {
+  return sizeInBytes_;
+}
+
+void ImageCache::evict(size_t capacityInBytes) {
+  while (sizeInBytes_ > capacityInBytes) {
+    const auto& [key, loadedImage] = entries_.back();
+    sizeInBytes_ -= loadedImage.byteSize;
+    index_.erase(key);
+    entries_.pop_back();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <react/renderer/imagemanager/ImagePipelineLoader.h>
+#include <react/renderer/imagemanager/ImageRequestParams.h>
+#include <react/renderer/imagemanager/primitives.h>
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+/*
+ * Identifies images which are loaded once and shared by all requests: the
+ * same source with the same parameters. Unlike `ImageSource::operator==`,
+ * which only compares the type and URI, all the fields of the source which
+ * affect the loaded image (e.g. the headers, method and body of the request,
+ * or the scale and size of the image) are compared.
+ * Sources with the `Reload` cache strategy get keys of their own, which never
+ * hit the cache (see `ImageCache`).
+ */
+struct ImageCacheKey {
+  ImageSource::Type type;
+  std::string uri;
+  std::string bundle;
+  Float scale;
+  Size size;
+  std::string body;
+  std::string method;
+  std::vector<std::pair<std::string, std::string>> headers;
+  Float blurRadius;
+  bool reload;
+
+  ImageCacheKey(const ImageSource &imageSource, const ImageRequestParams &imageRequestParams)
+      : type(imageSource.type),
+        uri(imageSource.uri),
+        bundle(imageSource.bundle),
+        scale(imageSource.scale),
+        size(imageSource.size),
+        body(imageSource.body),
+        method(imageSource.method),
+        headers(imageSource.headers),
+        blurRadius(imageRequestParams.blurRadius),
+        reload(imageSource.cache == ImageSource::CacheStategy::Reload)
+  {
+  }
+
+  bool operator==(const ImageCacheKey &rhs) const = default;
+};
+
+} // namespace facebook::react
+
+namespace std {
+
+template <>
+struct hash<facebook::react::ImageCacheKey> {
+  size_t operator()(const facebook::react::ImageCacheKey &key) const
+  {
+    auto seed = facebook::react::hash_combine(
+        static_cast<int>(key.type),
+        key.uri,
+        key.bundle,
+        key.scale,
+        key.size,
+        key.body,
+        key.method,
+        key.blurRadius,
+        key.reload);
+    for (const auto &[name, value] : key.headers) {
+      facebook::react::hash_combine(seed, name, value);
+    }
+    return seed;
+  }
+};
+
+} // namespace std
+
+namespace facebook::react {
+
+/*
+ * Least-recently-used cache of decoded images, bounded by their total
+ * `LoadedImage::byteSize` rather than by their number, as a few large images
+ * take as much memory as many thumbnails.
+ * Reload keys never hit the cache; images stored for them replace the ones
+ * of the same image loaded without reloading.
+ * Not thread-safe.
+ */
+class ImageCache final {
+ public:
+  explicit ImageCache(size_t capacityInBytes);
+
+  /*
+   * Returns the image stored for `key` (if any) and marks it as the most
+   * recently used one. Returns nothing for reload keys.
+   */
+  std::optional<LoadedImage> get(const ImageCacheKey &key);
+
+  bool contains(const ImageCacheKey &key) const;
+
+  /*
+   * Stores the image, evicting the least recently used images to stay within
+   * the capacity. Images larger than the whole capacity are not stored.
+   */
+  void put(ImageCacheKey key, LoadedImage loadedImage);
+
+  size_t size() const;
+
+  size_t getSizeInBytes() const;
+
+ private:
+  using Entry = std::pair<ImageCacheKey, LoadedImage>;
+
+  void evict(size_t capacityInBytes);
+
+  /*
+   * Entries ordered from the most to the least recently used.
+   */
+  std::list<Entry> entries_;
+  std::unordered_map<ImageCacheKey, std::list<Entry>::iterator> index_;
+
+  size_t capacityInBytes_;
+  size_t sizeInBytes_{0};
+};
+
+} // namespace facebook::react
@@ -6,27 +6,39 @@
  */
 
 #include "ImageManager.h"
+#include "ImagePipeline.h"
 
 namespace facebook::react {
 
 ImageManager::ImageManager(
-    const std::shared_ptr<const ContextContainer>& /*contextContainer*/) {
-  // Silence unused-private-field warning.
-  (void)self_;
-  // Not implemented.
+    const std::shared_ptr<const ContextContainer>& contextContainer) {
+  auto imagePipeline = contextContainer != nullptr
+      ? contextContainer
+            ->find<std::shared_ptr<ImagePipeline>>(
+                ImagePipeline::ContextContainerKey)
+            .value_or(nullptr)
+      : nullptr;
+  if (imagePipeline != nullptr) {
+    self_ = new std::shared_ptr<ImagePipeline>(std::move(imagePipeline));
+  }
 }
 
 ImageManager::~ImageManager() {
-  // Not implemented.
+  delete static_cast<std::shared_ptr<ImagePipeline>*>(self_);
 }
 
 ImageRequest ImageManager::requestImage(
     const ImageSource& imageSource,
-    SurfaceId /*surfaceId*/,
-    const ImageRequestParams& /*imageRequestParams*/,
+    SurfaceId surfaceId,
+    const ImageRequestParams& imageRequestParams,
     Tag /*tag*/) const {
-  // Not implemented.
-  return {imageSource, nullptr, {}};
+  if (self_ == nullptr) {
+    // No pipeline was registered by the host, so images are never loaded.
+    return {imageSource, nullptr, {}};
+  }
+  return static_cast<std::shared_ptr<ImagePipeline>*>(self_)
+      ->get()
+      ->requestImage(imageSource, surfaceId, imageRequestParams);
 }
 
 } // namespace facebook::react
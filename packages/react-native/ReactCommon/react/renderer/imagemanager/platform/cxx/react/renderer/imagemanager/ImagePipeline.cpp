@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImagePipeline.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+/*
+ * The pipeline's side of an `ImageRequest`.
+ */
+struct ImagePipeline::Waiter {
+  ImageCacheKey key;
+  ImageSource imageSource;
+  ImageRequestParams imageRequestParams;
+  std::weak_ptr<const ImageResponseObserverCoordinator> coordinator{};
+
+  /*
+   * Whether the request has observers. Protected by `mutex_`.
+   */
+  bool isActive{true};
+};
+
+/*
+ * A load of an image shared by all requests for it.
+ * Mutable fields are protected by `mutex_`.
+ */
+struct ImagePipeline::Load {
+  ImageCacheKey key;
+  ImageSource imageSource;
+  ImageRequestParams imageRequestParams;
+  ImagePriority priority{ImagePriority::Background};
+  std::vector<std::shared_ptr<Waiter>> waiters{};
+  std::vector<OnPrefetch> prefetchCallbacks{};
+  bool isPrefetch{false};
+  bool isQueued{false};
+  bool isStarted{false};
+  bool isCancelled{false};
+  bool isFinished{false};
+};
+
+ImagePipeline::ImagePipeline(
+    std::shared_ptr<ImagePipelineLoader> imageLoader,
+    size_t cacheCapacityInBytes,
+    size_t maximumConcurrentLoads)
+    : imageLoader_(std::move(imageLoader)),
+      maximumConcurrentLoads_(maximumConcurrentLoads),
+      cache_(cacheCapacityInBytes) {}
+
+ImageRequest ImagePipeline::requestImage(
+    const ImageSource& imageSource,
+    SurfaceId surfaceId,
+    const ImageRequestParams& imageRequestParams,
+    ImagePriority priority) {
+  auto waiter = std::make_shared<Waiter>(
+      Waiter{
+          .key = ImageCacheKey{imageSource, imageRequestParams},
+          .imageSource = imageSource,
+          .imageRequestParams = imageRequestParams});
+
+  auto weakThis = weak_from_this();
+  auto request = ImageRequest{
+      imageSource,
+      std::make_shared<ImageTelemetry>(surfaceId),
+      SharedFunction<>{[weakThis, waiter]() {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->resume(waiter);
+        }
+      }},
+      SharedFunction<>{[weakThis, waiter]() {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->cancel(waiter);
+        }
+      }}};
+  waiter->coordinator = request.getSharedObserverCoordinator();
+
+  auto loadsToStart = Loads{};
+  if (auto loadedImage = attach(waiter, priority, loadsToStart)) {
+    request.getObserverCoordinator().nativeImageResponseComplete(
+        ImageResponse{loadedImage->image, loadedImage->metadata});
+  }
+  startLoads(loadsToStart);
+  return request;
+}
+
+void ImagePipeline::prefetchImage(
+    const ImageSource& imageSource,
+    const ImageRequestParams& imageRequestParams,
+    ImagePriority priority,
+    OnPrefetch onPrefetch) {
+  auto key = ImageCacheKey{imageSource, imageRequestParams};
+
+  std::unique_lock lock(mutex_);
+  if (cache_.contains(key)) {
+    lock.unlock();
+    if (onPrefetch) {
+      onPrefetch(std::nullopt);
+    }
+    return;
+  }
+
+  auto& load = loads_[key];
+  if (load == nullptr) {
+    load = std::make_shared<Load>(
+        Load{
+            .key = key,
+            .imageSource = imageSource,
+            .imageRequestParams = imageRequestParams});
+  }
+  load->isPrefetch = true;
+  if (onPrefetch) {
+    load->prefetchCallbacks.push_back(std::move(onPrefetch));
+  }
+  enqueue(load, priority);
+  auto loadsToStart = dequeueLoads();
+  lock.unlock();
+
+  startLoads(loadsToStart);
+}
+
+ImagePipeline::Statistics ImagePipeline::getStatistics() const {
+  std::scoped_lock lock(mutex_);
+  return statistics_;
+}
+
+std::optional<LoadedImage> ImagePipeline::attach(
+    const std::shared_ptr<Waiter>& waiter,
+    ImagePriority priority,
+    Loads& loadsToStart) {
+  std::scoped_lock lock(mutex_);
+  statistics_.requests++;
+  waiter->isActive = true;
+
+  if (auto loadedImage = cache_.get(waiter->key)) {
+    statistics_.cacheHits++;
+    statistics_.deliveredResponses++;
+    return loadedImage;
+  }
+
+  auto& load = loads_[waiter->key];
+  if (load == nullptr) {
+    load = std::make_shared<Load>(
+        Load{
+            .key = waiter->key,
+            .imageSource = waiter->imageSource,
+            .imageRequestParams = waiter->imageRequestParams});
+  }
+
+  // A resumed request may still be waiting for its load.
+  if (std::find(load->waiters.begin(), load->waiters.end(), waiter) ==
+      load->waiters.end()) {
+    if (!load->waiters.empty() || load->isPrefetch) {
+      statistics_.deduplicatedRequests++;
+    }
+    load->waiters.push_back(waiter);
+  }
+  enqueue(load, priority);
+  loadsToStart = dequeueLoads();
+  return std::nullopt;
+}
+
+void ImagePipeline::resume(const std::shared_ptr<Waiter>& waiter) {
+  auto loadsToStart = Loads{};
+  if (auto loadedImage = attach(waiter, ImagePriority::Visible, loadsToStart)) {
+    if (auto coordinator = waiter->coordinator.lock()) {
+      coordinator->nativeImageResponseComplete(
+          ImageResponse{loadedImage->image, loadedImage->metadata});
+    }
+  }
+  startLoads(loadsToStart);
+}
+
+void ImagePipeline::cancel(const std::shared_ptr<Waiter>& waiter) {
+  std::unique_lock lock(mutex_);
+  waiter->isActive = false;
+
+  auto it = loads_.find(waiter->key);
+  if (it == loads_.end()) {
+    return;
+  }
+  auto load = it->second;
+  if (load->isPrefetch ||
+      std::any_of(
+          load->waiters.begin(),
+          load->waiters.end(),
+          [](const auto& otherWaiter) { return otherWaiter->isActive; })) {
+    return;
+  }
+
+  loads_.erase(it);
+  load->isCancelled = true;
+  statistics_.cancelledLoads++;
+  if (!load->isStarted) {
+    // The load is dropped from its queue when it comes up.
+    return;
+  }
+
+  runningLoads_--;
+  auto loadsToStart = dequeueLoads();
+  lock.unlock();
+
+  imageLoader_->cancelImage(load->imageSource, load->imageRequestParams);
+  startLoads(loadsToStart);
+}
+
+void ImagePipeline::enqueue(
+    const std::shared_ptr<Load>& load,
+    ImagePriority priority) {
+  if (load->isStarted || (load->isQueued && load->priority <= priority)) {
+    return;
+  }
+
+  // When the priority of a queued load is raised, the load is queued again and
+  // its entry in the previous queue is skipped.
+  load->priority = priority;
+  load->isQueued = true;
+  pendingLoads_[static_cast<size_t>(priority)].push_back(load);
+}
+
+ImagePipeline::Loads ImagePipeline::dequeueLoads() {
+  auto loads = Loads{};
+  auto queueIndex = size_t{0};
+  while (runningLoads_ < maximumConcurrentLoads_ &&
+         queueIndex < pendingLoads_.size()) {
+    auto& queue = pendingLoads_[queueIndex];
+    if (queue.empty()) {
+      queueIndex++;
+      continue;
+    }
+
+    auto load = std::move(queue.front());
+    queue.pop_front();
+    if (load->isStarted || load->isCancelled ||
+        static_cast<size_t>(load->priority) != queueIndex) {
+      continue;
+    }
+
+    load->isStarted = true;
+    runningLoads_++;
+    statistics_.loads++;
+    loads.push_back(std::move(load));
+  }
+  return loads;
+}
+
+void ImagePipeline::startLoads(const Loads& loads) {
+  auto weakThis = weak_from_this();
+  for (const auto& load : loads) {
+    imageLoader_->loadImage(
+        load->imageSource,
+        load->imageRequestParams,
+        load->priority,
+        [weakThis, load](LoadedImage loadedImage) {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->finishLoad(load, std::move(loadedImage), std::nullopt);
+          }
+        },
+        [weakThis, load](const ImageLoadError& error) {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->finishLoad(load, std::nullopt, error);
+          }
+        });
+  }
+}
+
+void ImagePipeline::finishLoad(
+    const std::shared_ptr<Load>& load,
+    std::optional<LoadedImage> loadedImage,
+    std::optional<ImageLoadError> error) {
+  std::unique_lock lock(mutex_);
+  if (load->isFinished) {
+    return;
+  }
+  load->isFinished = true;
+
+  if (loadedImage.has_value()) {
+    cache_.put(load->key, *loadedImage);
+  } else {
+    statistics_.failedLoads++;
+  }
+
+  if (load->isCancelled) {
+    // Nobody waits for the result anymore.
+    return;
+  }
+
+  runningLoads_--;
+  loads_.erase(load->key);
+
+  // Requests without observers get the response as well, so that it's
+  // delivered as soon as they are observed again.
+  auto coordinators =
+      std::vector<std::shared_ptr<const ImageResponseObserverCoordinator>>{};
+  coordinators.reserve(load->waiters.size());
+  for (const auto& waiter : load->waiters) {
+    if (auto coordinator = waiter->coordinator.lock()) {
+      coordinators.push_back(std::move(coordinator));
+    }
+  }
+  if (loadedImage.has_value()) {
+    statistics_.deliveredResponses += coordinators.size();
+  }
+  auto prefetchCallbacks = std::move(load->prefetchCallbacks);
+  auto loadsToStart = dequeueLoads();
+  lock.unlock();
+
+  for (const auto& coordinator : coordinators) {
+    if (loadedImage.has_value()) {
+      coordinator->nativeImageResponseComplete(
+          ImageResponse{loadedImage->image, loadedImage->metadata});
+    } else {
+      coordinator->nativeImageResponseFailed(*error);
+    }
+  }
+  for (const auto& onPrefetch : prefetchCallbacks) {
+    onPrefetch(error);
+  }
+  startLoads(loadsToStart);
+}
+
+} // namespace facebook::react
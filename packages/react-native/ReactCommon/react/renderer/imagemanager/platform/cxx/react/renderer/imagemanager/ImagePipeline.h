@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/imagemanager/ImagePipelineLoader.h>
+#include <react/renderer/imagemanager/ImageCache.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+
+namespace facebook::react {
+
+/*
+ * Loads images for the cxx `ImageManager` with an `ImagePipelineLoader`.
+ *
+ * - Decoded images are kept in an `ImageCache`, so requests for cached images
+ *   complete synchronously.
+ * - Requests for an image which is already being loaded (e.g. the same avatar
+ *   in several lists or surfaces) share the load.
+ * - At most `maximumConcurrentLoads` loads run at once; the others wait in
+ *   queues per `ImagePriority`. Prefetches never delay visible images.
+ * - A load is cancelled once no request is interested in it anymore, unless
+ *   it's a prefetch.
+ *
+ * Hosts register an instance in `ContextContainer` under
+ * `ImagePipeline::ContextContainerKey` (as `std::shared_ptr<ImagePipeline>`)
+ * and may prefetch images through it; without one, `ImageManager` doesn't load
+ * images. The ReactCxxPlatform `ReactHost` registers one which loads images
+ * with the `IImageLoader` of its mounting manager, unless the host provided its
+ * own.
+ */
+class ImagePipeline final : public std::enable_shared_from_this<ImagePipeline> {
+ public:
+  static constexpr const char *ContextContainerKey = "ImagePipeline";
+
+  static constexpr size_t DefaultCacheCapacityInBytes = 64 * 1024 * 1024;
+  static constexpr size_t DefaultMaximumConcurrentLoads = 8;
+
+  /*
+   * Counters of the work done by the pipeline, e.g. for benchmarks.
+   */
+  struct Statistics {
+    size_t requests{0};
+    size_t cacheHits{0};
+    size_t deduplicatedRequests{0};
+    size_t loads{0};
+    size_t cancelledLoads{0};
+    size_t failedLoads{0};
+    // Responses delivered to requests, each of which results in a state
+    // update of an image view.
+    size_t deliveredResponses{0};
+  };
+
+  ImagePipeline(
+      std::shared_ptr<ImagePipelineLoader> imageLoader,
+      size_t cacheCapacityInBytes = DefaultCacheCapacityInBytes,
+      size_t maximumConcurrentLoads = DefaultMaximumConcurrentLoads);
+
+  ImagePipeline(const ImagePipeline &) = delete;
+  ImagePipeline &operator=(const ImagePipeline &) = delete;
+
+  ImageRequest requestImage(
+      const ImageSource &imageSource,
+      SurfaceId surfaceId,
+      const ImageRequestParams &imageRequestParams = {},
+      ImagePriority priority = ImagePriority::Visible);
+
+  /*
+   * Called once a prefetched image is in the cache (with no error) or failed
+   * to load.
+   */
+  using OnPrefetch = std::function<void(const std::optional<ImageLoadError> &error)>;
+
+  /*
+   * Loads an image into the cache ahead of being requested.
+   * `onPrefetch` is called synchronously if the image is already cached.
+   */
+  void prefetchImage(
+      const ImageSource &imageSource,
+      const ImageRequestParams &imageRequestParams = {},
+      ImagePriority priority = ImagePriority::Prefetch,
+      OnPrefetch onPrefetch = nullptr);
+
+  Statistics getStatistics() const;
+
+ private:
+  struct Waiter;
+  struct Load;
+
+  using Loads = std::vector<std::shared_ptr<Load>>;
+
+  /*
+   * Adds the request of `waiter` to the matching load (or starts a new one).
+   * Returns the image if it's cached.
+   */
+  std::optional<LoadedImage> attach(const std::shared_ptr<Waiter> &waiter, ImagePriority priority, Loads &loadsToStart);
+  void resume(const std::shared_ptr<Waiter> &waiter);
+  void cancel(const std::shared_ptr<Waiter> &waiter);
+
+  void enqueue(const std::shared_ptr<Load> &load, ImagePriority priority);
+  Loads dequeueLoads();
+  void startLoads(const Loads &loads);
+  void finishLoad(
+      const std::shared_ptr<Load> &load,
+      std::optional<LoadedImage> loadedImage,
+      std::optional<ImageLoadError> error);
+
+  std::shared_ptr<ImagePipelineLoader> imageLoader_;
+  const size_t maximumConcurrentLoads_;
+
+  mutable std::mutex mutex_;
+  ImageCache cache_;
+  std::unordered_map<ImageCacheKey, std::shared_ptr<Load>> loads_;
+  std::array<std::deque<std::shared_ptr<Load>>, 3> pendingLoads_;
+  size_t runningLoads_{0};
+  Statistics statistics_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <react/renderer/graphics/Size.h>
+#include <react/renderer/imagemanager/ImageRequestParams.h>
+#include <react/renderer/imagemanager/ImageResponse.h>
+#include <react/renderer/imagemanager/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * Classes of urgency of image loads, from the most to the least urgent.
+ */
+enum class ImagePriority {
+  // Images of mounted views.
+  Visible = 0,
+  // Images which are about to be shown (e.g. the next items of a list).
+  Prefetch = 1,
+  // Images which may be shown at some point.
+  Background = 2,
+};
+
+/*
+ * An image decoded by an `ImagePipelineLoader`.
+ */
+struct LoadedImage {
+  /*
+   * Platform-specific image and metadata, passed to observers as
+   * `ImageResponse`.
+   */
+  std::shared_ptr<void> image;
+  std::shared_ptr<void> metadata;
+
+  Size size;
+
+  /*
+   * The memory taken by the decoded image, which the image cache is bounded by.
+   */
+  size_t byteSize;
+};
+
+/*
+ * Fetches and decodes images for the `ImagePipeline` of the cxx
+ * `ImageManager`. Implemented by hosts, e.g. with a network stack and a codec,
+ * or with synthetic images in tests. Hosts built on ReactCxxPlatform can adapt
+ * their `IImageLoader` with `ImagePipelineLoaderAdapter`.
+ */
+class ImagePipelineLoader {
+ public:
+  using OnLoad = std::function<void(LoadedImage loadedImage)>;
+  using OnError = std::function<void(const ImageLoadError &error)>;
+
+  virtual ~ImagePipelineLoader() = default;
+
+  /*
+   * Starts loading an image. Must eventually call either `onLoad` or `onError`
+   * exactly once, on any thread (including synchronously).
+   */
+  virtual void loadImage(
+      const ImageSource &imageSource,
+      const ImageRequestParams &imageRequestParams,
+      ImagePriority priority,
+      OnLoad onLoad,
+      OnError onError) = 0;
+
+  /*
+   * Called when nobody is interested in an image being loaded anymore.
+   * The result of the load is ignored, so loaders may stop it.
+   */
+  virtual void cancelImage(const ImageSource & /*imageSource*/, const ImageRequestParams & /*imageRequestParams*/) {}
+};
+
+} // namespace facebook::react
@@ -6,13 +6,289 @@
  */
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include <react/renderer/imagemanager/ImageCache.h>
 #include <react/renderer/imagemanager/ImageManager.h>
+#include <react/renderer/imagemanager/ImagePipeline.h>
 
 using namespace facebook::react;
 
-TEST(ImageManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+ImageSource remoteImageSource(const std::string& uri) {
+  auto imageSource = ImageSource{};
+  imageSource.type = ImageSource::Type::Remote;
+  imageSource.uri = uri;
+  return imageSource;
+}
+
+LoadedImage loadedImage(size_t byteSize) {
+  return LoadedImage{
+      .image = std::make_shared<int>(0),
+      .metadata = nullptr,
+      .size = {.width = 10, .height = 10},
+      .byteSize = byteSize};
+}
+
+/*
+ * Keeps loads pending until they are completed by the test.
+ */
+class FakeImageLoader : public ImagePipelineLoader {
+ public:
+  struct PendingLoad {
+    std::string uri;
+    ImagePriority priority;
+    OnLoad onLoad;
+    OnError onError;
+  };
+
+  void loadImage(
+      const ImageSource& imageSource,
+      const ImageRequestParams& /*imageRequestParams*/,
+      ImagePriority priority,
+      OnLoad onLoad,
+      OnError onError) override {
+    pendingLoads.push_back(
+        PendingLoad{
+            .uri = imageSource.uri,
+            .priority = priority,
+            .onLoad = std::move(onLoad),
+            .onError = std::move(onError)});
+  }
+
+  void cancelImage(
+      const ImageSource& imageSource,
+      const ImageRequestParams& /*imageRequestParams*/) override {
+    cancelledUris.push_back(imageSource.uri);
+  }
+
+  void completeFirstLoad() {
+    auto pendingLoad = std::move(pendingLoads.front());
+    pendingLoads.erase(pendingLoads.begin());
+    pendingLoad.onLoad(loadedImage(100));
+  }
+
+  void failFirstLoad() {
+    auto pendingLoad = std::move(pendingLoads.front());
+    pendingLoads.erase(pendingLoads.begin());
+    pendingLoad.onError(ImageLoadError{nullptr});
+  }
+
+  std::vector<PendingLoad> pendingLoads;
+  std::vector<std::string> cancelledUris;
+};
+
+class CountingObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    receivedImages++;
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {}
+
+  mutable int receivedImages{0};
+};
+
+} // namespace
+
+TEST(ImageManagerTest, cacheEvictsLeastRecentlyUsedImages) {
+  auto cache = ImageCache{300};
+  auto keyA = ImageCacheKey{remoteImageSource("a"), {}};
+  auto keyB = ImageCacheKey{remoteImageSource("b"), {}};
+  auto keyC = ImageCacheKey{remoteImageSource("c"), {}};
+  auto keyD = ImageCacheKey{remoteImageSource("d"), {}};
+
+  cache.put(keyA, loadedImage(100));
+  cache.put(keyB, loadedImage(100));
+  cache.put(keyC, loadedImage(100));
+  EXPECT_TRUE(cache.get(keyA).has_value());
+  cache.put(keyD, loadedImage(100));
+
+  EXPECT_TRUE(cache.contains(keyA));
+  EXPECT_FALSE(cache.contains(keyB));
+  EXPECT_TRUE(cache.contains(keyC));
+  EXPECT_TRUE(cache.contains(keyD));
+  EXPECT_EQ(cache.getSizeInBytes(), 300);
+
+  // Images larger than the cache are not stored.
+  cache.put(ImageCacheKey{remoteImageSource("e"), {}}, loadedImage(400));
+  EXPECT_EQ(cache.size(), 3);
+}
+
+TEST(ImageManagerTest, cacheKeysDistinguishRequests) {
+  auto imageSource = remoteImageSource("a");
+  auto key = ImageCacheKey{imageSource, {}};
+  EXPECT_EQ(key, (ImageCacheKey{remoteImageSource("a"), {}}));
+
+  auto withHeaders = imageSource;
+  withHeaders.headers.emplace_back("Authorization", "Bearer token");
+  auto withMethod = imageSource;
+  withMethod.method = "POST";
+  auto withBody = imageSource;
+  withBody.body = "body";
+  auto withScale = imageSource;
+  withScale.scale = 2;
+  auto withSize = imageSource;
+  withSize.size = {.width = 10, .height = 10};
+  for (const auto& otherImageSource :
+       {withHeaders, withMethod, withBody, withScale, withSize}) {
+    auto otherKey = ImageCacheKey{otherImageSource, {}};
+    EXPECT_NE(key, otherKey);
+    EXPECT_NE(
+        std::hash<ImageCacheKey>{}(key), std::hash<ImageCacheKey>{}(otherKey));
+  }
+}
+
+TEST(ImageManagerTest, identicalRequestsShareLoad) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(imageLoader);
+  auto observer = CountingObserver{};
+
+  auto request1 = imagePipeline->requestImage(remoteImageSource("a"), 1);
+  auto request2 = imagePipeline->requestImage(remoteImageSource("a"), 2);
+  request1.getObserverCoordinator().addObserver(observer);
+  request2.getObserverCoordinator().addObserver(observer);
+  ASSERT_EQ(imageLoader->pendingLoads.size(), 1);
+
+  imageLoader->completeFirstLoad();
+  EXPECT_EQ(observer.receivedImages, 2);
+
+  auto statistics = imagePipeline->getStatistics();
+  EXPECT_EQ(statistics.requests, 2);
+  EXPECT_EQ(statistics.loads, 1);
+  EXPECT_EQ(statistics.deduplicatedRequests, 1);
+  EXPECT_EQ(statistics.deliveredResponses, 2);
+}
+
+TEST(ImageManagerTest, cachedImagesCompleteSynchronously) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(imageLoader);
+  auto observer = CountingObserver{};
+
+  {
+    auto request = imagePipeline->requestImage(remoteImageSource("a"), 1);
+    imageLoader->completeFirstLoad();
+  }
+
+  auto request = imagePipeline->requestImage(remoteImageSource("a"), 1);
+  request.getObserverCoordinator().addObserver(observer);
+  EXPECT_EQ(observer.receivedImages, 1);
+  EXPECT_TRUE(imageLoader->pendingLoads.empty());
+  EXPECT_EQ(imagePipeline->getStatistics().cacheHits, 1);
+}
+
+TEST(ImageManagerTest, visibleImagesLoadBeforePrefetches) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(
+      imageLoader, ImagePipeline::DefaultCacheCapacityInBytes, 1);
+
+  imagePipeline->prefetchImage(remoteImageSource("a"));
+  imagePipeline->prefetchImage(remoteImageSource("b"));
+  auto request = imagePipeline->requestImage(remoteImageSource("c"), 1);
+  ASSERT_EQ(imageLoader->pendingLoads.size(), 1);
+  EXPECT_EQ(imageLoader->pendingLoads[0].uri, "a");
+
+  imageLoader->completeFirstLoad();
+  ASSERT_EQ(imageLoader->pendingLoads.size(), 1);
+  EXPECT_EQ(imageLoader->pendingLoads[0].uri, "c");
+  EXPECT_EQ(imageLoader->pendingLoads[0].priority, ImagePriority::Visible);
+}
+
+TEST(ImageManagerTest, reloadsBypassCache) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(imageLoader);
+  auto observer = CountingObserver{};
+  auto reloadedImageSource = remoteImageSource("a");
+  reloadedImageSource.cache = ImageSource::CacheStategy::Reload;
+
+  imagePipeline->prefetchImage(remoteImageSource("a"));
+  imageLoader->completeFirstLoad();
+
+  auto request = imagePipeline->requestImage(reloadedImageSource, 1);
+  request.getObserverCoordinator().addObserver(observer);
+  ASSERT_EQ(imageLoader->pendingLoads.size(), 1);
+  EXPECT_EQ(observer.receivedImages, 0);
+  EXPECT_EQ(imagePipeline->getStatistics().cacheHits, 0);
+
+  imageLoader->completeFirstLoad();
+  EXPECT_EQ(observer.receivedImages, 1);
+
+  // Images loaded by reloads are stored for the requests without reloading.
+  auto cache = ImageCache{ImagePipeline::DefaultCacheCapacityInBytes};
+  cache.put(ImageCacheKey{reloadedImageSource, {}}, loadedImage(100));
+  EXPECT_FALSE(cache.contains(ImageCacheKey{reloadedImageSource, {}}));
+  EXPECT_TRUE(cache.contains(ImageCacheKey{remoteImageSource("a"), {}}));
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(ImageManagerTest, prefetchesReportCompletion) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(imageLoader);
+  auto completions = std::vector<std::string>{};
+  auto onPrefetch = [&](const std::string& name) {
+    return [&completions, name](const std::optional<ImageLoadError>& error) {
+      completions.push_back(name + (error.has_value() ? ": failed" : ": ok"));
+    };
+  };
+
+  imagePipeline->prefetchImage(
+      remoteImageSource("a"), {}, ImagePriority::Prefetch, onPrefetch("a"));
+  imagePipeline->prefetchImage(
+      remoteImageSource("b"), {}, ImagePriority::Prefetch, onPrefetch("b"));
+  EXPECT_TRUE(completions.empty());
+
+  imageLoader->completeFirstLoad();
+  imageLoader->failFirstLoad();
+  EXPECT_EQ(completions, (std::vector<std::string>{"a: ok", "b: failed"}));
+
+  // Cached images complete synchronously.
+  imagePipeline->prefetchImage(
+      remoteImageSource("a"), {}, ImagePriority::Prefetch, onPrefetch("c"));
+  EXPECT_EQ(completions.back(), "c: ok");
+  EXPECT_TRUE(imageLoader->pendingLoads.empty());
+}
+
+TEST(ImageManagerTest, unobservedLoadsAreCancelled) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto imagePipeline = std::make_shared<ImagePipeline>(imageLoader);
+  auto observer = CountingObserver{};
+
+  auto request = imagePipeline->requestImage(remoteImageSource("a"), 1);
+  request.getObserverCoordinator().addObserver(observer);
+  request.getObserverCoordinator().removeObserver(observer);
+
+  ASSERT_EQ(imageLoader->cancelledUris.size(), 1);
+  EXPECT_EQ(imageLoader->cancelledUris[0], "a");
+  EXPECT_EQ(imagePipeline->getStatistics().cancelledLoads, 1);
+
+  // Observing the request again loads the image again.
+  request.getObserverCoordinator().addObserver(observer);
+  ASSERT_EQ(imageLoader->pendingLoads.size(), 2);
+  imageLoader->completeFirstLoad();
+  EXPECT_EQ(observer.receivedImages, 0);
+  imageLoader->completeFirstLoad();
+  EXPECT_EQ(observer.receivedImages, 1);
+}
+
+TEST(ImageManagerTest, imageManagerUsesPipelineFromContextContainer) {
+  auto imageLoader = std::make_shared<FakeImageLoader>();
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      ImagePipeline::ContextContainerKey,
+      std::make_shared<ImagePipeline>(imageLoader));
+  auto imageManager = ImageManager{contextContainer};
+
+  auto request = imageManager.requestImage(remoteImageSource("a"), 1);
+  EXPECT_NE(request.getSharedTelemetry(), nullptr);
+  EXPECT_EQ(imageLoader->pendingLoads.size(), 1);
 }
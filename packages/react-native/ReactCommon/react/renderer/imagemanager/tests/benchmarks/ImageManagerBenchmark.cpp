@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/imagemanager/ImagePipeline.h>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kNumberOfRows = 2000;
+constexpr int kNumberOfDistinctImages = 300;
+constexpr int kNumberOfVisibleRows = 12;
+constexpr SurfaceId kNumberOfSurfaces = 2;
+
+/*
+ * Decodes every image as a 256x256 bitmap, completing the loads started
+ * during a frame at the end of it, as a network stack would.
+ */
+class FrameImageLoader : public ImagePipelineLoader {
+ public:
+  void loadImage(
+      const ImageSource& /*imageSource*/,
+      const ImageRequestParams& /*imageRequestParams*/,
+      ImagePriority /*priority*/,
+      OnLoad onLoad,
+      OnError /*onError*/) override {
+    pendingLoads_.push_back(std::move(onLoad));
+  }
+
+  void finishFrame() {
+    while (!pendingLoads_.empty()) {
+      auto onLoad = std::move(pendingLoads_.front());
+      pendingLoads_.pop_front();
+      onLoad(
+          LoadedImage{
+              .image = image_,
+              .metadata = nullptr,
+              .size = {.width = 256, .height = 256},
+              .byteSize = 256 * 256 * 4});
+    }
+  }
+
+ private:
+  std::deque<OnLoad> pendingLoads_;
+  std::shared_ptr<void> image_ = std::make_shared<int>(0);
+};
+
+class NullObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {}
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {}
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {}
+};
+
+static ImageSource imageSourceForRow(int row) {
+  auto imageSource = ImageSource{};
+  imageSource.type = ImageSource::Type::Remote;
+  imageSource.uri = "https://example.com/avatars/" +
+      std::to_string(row % kNumberOfDistinctImages) + ".jpg";
+  return imageSource;
+}
+
+/*
+ * Scrolls a list of rows with an avatar each, shown in `kNumberOfSurfaces`
+ * surfaces at once, by one row per frame. Rows which scroll into view
+ * request their images and observe them, as image views do; rows which
+ * scroll out of view stop observing them. Optionally, the images of the
+ * rows below the viewport are prefetched.
+ */
+static void scrollImageList(benchmark::State& state, bool prefetch) {
+  auto observer = NullObserver{};
+  auto statistics = ImagePipeline::Statistics{};
+  for (auto _ : state) {
+    auto imageLoader = std::make_shared<FrameImageLoader>();
+    auto imagePipeline = std::make_shared<ImagePipeline>(
+        imageLoader, 16 * 1024 * 1024 /* 64 images */);
+    auto mountedRequests = std::deque<ImageRequest>{};
+
+    for (int row = 0; row < kNumberOfRows; row++) {
+      for (SurfaceId surfaceId = 0; surfaceId < kNumberOfSurfaces;
+           surfaceId++) {
+        mountedRequests.push_back(
+            imagePipeline->requestImage(imageSourceForRow(row), surfaceId));
+        mountedRequests.back().getObserverCoordinator().addObserver(observer);
+      }
+      while (mountedRequests.size() >
+             kNumberOfVisibleRows * kNumberOfSurfaces) {
+        mountedRequests.front().getObserverCoordinator().removeObserver(
+            observer);
+        mountedRequests.pop_front();
+      }
+      if (prefetch) {
+        imagePipeline->prefetchImage(
+            imageSourceForRow(row + kNumberOfVisibleRows));
+      }
+      imageLoader->finishFrame();
+    }
+
+    for (auto& request : mountedRequests) {
+      request.getObserverCoordinator().removeObserver(observer);
+    }
+    statistics = imagePipeline->getStatistics();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kNumberOfRows);
+  state.counters["requests"] = static_cast<double>(statistics.requests);
+  state.counters["cacheHits"] = static_cast<double>(statistics.cacheHits);
+  state.counters["deduplicatedRequests"] =
+      static_cast<double>(statistics.deduplicatedRequests);
+  state.counters["loads"] = static_cast<double>(statistics.loads);
+  state.counters["stateUpdates"] =
+      static_cast<double>(statistics.deliveredResponses);
+}
+
+static void scrollImageListWithoutPrefetching(benchmark::State& state) {
+  scrollImageList(state, false);
+}
+BENCHMARK(scrollImageListWithoutPrefetching);
+
+static void scrollImageListWithPrefetching(benchmark::State& state) {
+  scrollImageList(state, true);
+}
+BENCHMARK(scrollImageListWithPrefetching);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -20,6 +20,7 @@
 namespace facebook::react {
 
 class JReadableMapBuffer;
+class MapBufferView;
 
 // clang-format off
 
@@ -137,6 +138,13 @@ class MapBuffer {
 
   uint16_t count() const;
 
+  /**
+   * Returns a non-owning view of the map which reads strings and nested maps
+   * without copying them. The view is valid as long as the MapBuffer is alive
+   * (and not moved from).
+   */
+  MapBufferView view() const;
+
  private:
   // Buffer and its size
   std::vector<uint8_t> bytes_;
@@ -144,11 +152,6 @@ class MapBuffer {
   // amount of items in the MapBuffer
   uint16_t count_ = 0;
 
-  // returns the relative offset of the first byte of dynamic data
-  int32_t getDynamicDataOffset() const;
-
-  int32_t getKeyBucket(MapBuffer::Key key) const;
-
   friend JReadableMapBuffer;
 };
 
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferArena.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+// Maps are aligned so that headers can be read in place.
+constexpr size_t MAP_ALIGNMENT = alignof(uint64_t);
+
+MapBufferArena::MapBufferArena(size_t chunkSize) : chunkSize_(chunkSize) {}
+
+void MapBufferArena::reset() {
+  chunkIndex_ = 0;
+  chunkOffset_ = 0;
+}
+
+size_t MapBufferArena::capacity() const {
+  size_t capacity = 0;
+  for (const auto& chunk : chunks_) {
+    capacity += chunk.size;
+  }
+  return capacity;
+}
+
+uint8_t* MapBufferArena::allocate(size_t size) {
+  size = (size + MAP_ALIGNMENT - 1) / MAP_ALIGNMENT * MAP_ALIGNMENT;
+
+  // Skipping chunks which cannot fit the map.
+  while (chunkIndex_ < chunks_.size() &&
+         chunkOffset_ + size > chunks_[chunkIndex_].size) {
+    chunkIndex_++;
+    chunkOffset_ = 0;
+  }
+
+  if (chunkIndex_ == chunks_.size()) {
+    auto chunkSize = std::max(chunkSize_, size);
+    chunks_.push_back(
+        Chunk{
+            .bytes = std::unique_ptr<uint8_t[]>(new uint8_t[chunkSize]),
+            .size = chunkSize});
+  }
+
+  auto* bytes = chunks_[chunkIndex_].bytes.get() + chunkOffset_;
+  chunkOffset_ += size;
+  return bytes;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+class MapBufferBuilder;
+
+/**
+ * Append-only storage for MapBuffers built with
+ * `MapBufferBuilder::build(MapBufferArena &)`.
+ * Maps are written into chunks owned by the arena and are accessed through
+ * `MapBufferView`s, which stay valid until the arena is reset or destroyed.
+ * Resetting keeps the chunks, so an arena reused for every transaction stops
+ * allocating once it has grown to the size of a typical transaction.
+ * Not thread-safe.
+ */
+class MapBufferArena {
+ public:
+  constexpr static size_t DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+  explicit MapBufferArena(size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+  MapBufferArena(const MapBufferArena &) = delete;
+  MapBufferArena &operator=(const MapBufferArena &) = delete;
+
+  /**
+   * Invalidates all maps stored in the arena; the memory is reused for
+   * subsequently built maps.
+   */
+  void reset();
+
+  /**
+   * Returns the amount of memory owned by the arena.
+   */
+  size_t capacity() const;
+
+ private:
+  friend MapBufferBuilder;
+
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> bytes;
+    size_t size;
+  };
+
+  uint8_t *allocate(size_t size);
+
+  size_t chunkSize_;
+  std::vector<Chunk> chunks_{};
+  size_t chunkIndex_{0};
+  size_t chunkOffset_{0};
+};
+
+} // namespace facebook::react
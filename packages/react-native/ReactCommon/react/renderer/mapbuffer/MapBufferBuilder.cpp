@@ -7,6 +7,7 @@
 
 #include "MapBufferBuilder.h"
 #include <algorithm>
+#include <cstring>
 
 namespace facebook::react {
 
@@ -83,7 +84,7 @@ void MapBufferBuilder::putLong(MapBuffer::Key key, int64_t value) {
       LONG_SIZE);
 }
 
-void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
+void MapBufferBuilder::putString(MapBuffer::Key key, std::string_view value) {
   auto strSize = value.size();
   const char* strData = value.data();
 
@@ -102,6 +103,12 @@ void MapBufferBuilder::putString(MapBuffer::Key key, const std::string& value) {
 }
 
 void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
+  putMapBuffer(key, map.view());
+}
+
+void MapBufferBuilder::putMapBuffer(
+    MapBuffer::Key key,
+    const MapBufferView& map) {
   auto mapBufferSize = map.size();
 
   auto offset = dynamicData_.size();
@@ -123,16 +130,29 @@ void MapBufferBuilder::putMapBuffer(MapBuffer::Key key, const MapBuffer& map) {
 void MapBufferBuilder::putMapBufferList(
     MapBuffer::Key key,
     const std::vector<MapBuffer>& mapBufferList) {
+  putMapBufferListImpl(key, mapBufferList);
+}
+
+void MapBufferBuilder::putMapBufferList(
+    MapBuffer::Key key,
+    const std::vector<MapBufferView>& mapBufferList) {
+  putMapBufferListImpl(key, mapBufferList);
+}
+
+template <typename MapT>
+void MapBufferBuilder::putMapBufferListImpl(
+    MapBuffer::Key key,
+    const std::vector<MapT>& mapBufferList) {
   auto offset = static_cast<int32_t>(dynamicData_.size());
   int32_t dataSize = 0;
-  for (const MapBuffer& mapBuffer : mapBufferList) {
+  for (const MapT& mapBuffer : mapBufferList) {
     dataSize = dataSize + INT_SIZE + static_cast<int32_t>(mapBuffer.size());
   }
 
   dynamicData_.resize(offset + INT_SIZE, 0);
   memcpy(dynamicData_.data() + offset, &dataSize, INT_SIZE);
 
-  for (const MapBuffer& mapBuffer : mapBufferList) {
+  for (const MapT& mapBuffer : mapBufferList) {
     auto mapBufferSize = static_cast<int32_t>(mapBuffer.size());
     auto dynamicDataSize = static_cast<int32_t>(dynamicData_.size());
     dynamicData_.resize(dynamicDataSize + INT_SIZE + mapBufferSize, 0);
@@ -159,7 +179,7 @@ static inline bool compareBuckets(
   return a.key < b.key;
 }
 
-MapBuffer MapBufferBuilder::build() {
+size_t MapBufferBuilder::prepareForBuild() {
   // Create buffer: [header] + [key, values] + [dynamic data]
   auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
   auto headerSize = sizeof(MapBuffer::Header);
@@ -169,19 +189,44 @@ MapBuffer MapBufferBuilder::build() {
 
   if (needsSort_) {
     std::sort(buckets_.begin(), buckets_.end(), compareBuckets);
+    needsSort_ = false;
   }
 
   // TODO(T83483191): add pass to check for duplicates
 
-  std::vector<uint8_t> buffer(bufferSize);
-  memcpy(buffer.data(), &header_, headerSize);
-  memcpy(buffer.data() + headerSize, buckets_.data(), bucketSize);
+  return bufferSize;
+}
+
+void MapBufferBuilder::writeTo(uint8_t* buffer) const {
+  auto bucketSize = buckets_.size() * sizeof(MapBuffer::Bucket);
+  auto headerSize = sizeof(MapBuffer::Header);
+
+  memcpy(buffer, &header_, headerSize);
+  memcpy(buffer + headerSize, buckets_.data(), bucketSize);
   memcpy(
-      buffer.data() + headerSize + bucketSize,
+      buffer + headerSize + bucketSize,
       dynamicData_.data(),
       dynamicData_.size());
+}
 
+MapBuffer MapBufferBuilder::build() {
+  std::vector<uint8_t> buffer(prepareForBuild());
+  writeTo(buffer.data());
   return MapBuffer(std::move(buffer));
 }
 
+MapBufferView MapBufferBuilder::build(MapBufferArena& arena) {
+  auto bufferSize = prepareForBuild();
+  auto* buffer = arena.allocate(bufferSize);
+  writeTo(buffer);
+
+  buckets_.clear();
+  dynamicData_.clear();
+  header_.count = 0;
+  header_.bufferSize = 0;
+  lastKey_ = 0;
+
+  return {buffer, bufferSize};
+}
+
 } // namespace facebook::react
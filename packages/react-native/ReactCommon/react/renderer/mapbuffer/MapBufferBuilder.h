@@ -8,8 +8,11 @@
 #pragma once
 
 #include <react/debug/react_native_assert.h>
+#include <string_view>
 #include <vector>
 #include "MapBuffer.h"
+#include "MapBufferArena.h"
+#include "MapBufferView.h"
 
 namespace facebook::react {
 
@@ -33,14 +36,27 @@ class MapBufferBuilder {
 
   void putDouble(MapBuffer::Key key, double value);
 
-  void putString(MapBuffer::Key key, const std::string &value);
+  void putString(MapBuffer::Key key, std::string_view value);
 
   void putMapBuffer(MapBuffer::Key key, const MapBuffer &map);
 
+  void putMapBuffer(MapBuffer::Key key, const MapBufferView &map);
+
   void putMapBufferList(MapBuffer::Key key, const std::vector<MapBuffer> &mapBufferList);
 
+  void putMapBufferList(MapBuffer::Key key, const std::vector<MapBufferView> &mapBufferList);
+
   MapBuffer build();
 
+  /**
+   * Copies the map into `arena` and returns a view of it. Unlike `build()`,
+   * this does not allocate a buffer per map (once the arena has grown), but
+   * the header, buckets and dynamic data are still copied from the builder.
+   * The builder is emptied (keeping its memory), so it can be reused for
+   * building the next map.
+   */
+  MapBufferView build(MapBufferArena &arena);
+
  private:
   MapBuffer::Header header_;
 
@@ -53,6 +69,13 @@ class MapBufferBuilder {
   bool needsSort_{false};
 
   void storeKeyValue(MapBuffer::Key key, MapBuffer::DataType type, const uint8_t *value, uint32_t valueSize);
+
+  template <typename MapT>
+  void putMapBufferListImpl(MapBuffer::Key key, const std::vector<MapT> &mapBufferList);
+
+  size_t prepareForBuild();
+
+  void writeTo(uint8_t *buffer) const;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MapBufferView.h"
+
+namespace facebook::react {
+
+static inline int32_t bucketOffset(int32_t index) {
+  return sizeof(MapBuffer::Header) + sizeof(MapBuffer::Bucket) * index;
+}
+
+static inline int32_t valueOffset(int32_t bucketIndex) {
+  return bucketOffset(bucketIndex) + offsetof(MapBuffer::Bucket, data);
+}
+
+MapBufferView::MapBufferView(const uint8_t* data, size_t size)
+    : data_(data), size_(size) {
+  auto header = reinterpret_cast<const MapBuffer::Header*>(data_);
+  count_ = header->count;
+
+  if (header->bufferSize != size_) {
+    LOG(ERROR) << "Error: Data size does not match, expected "
+               << header->bufferSize << " found: " << size_;
+    abort();
+  }
+}
+
+MapBufferView::MapBufferView(const uint8_t* data, size_t size, uint16_t count)
+    : data_(data), size_(size), count_(count) {}
+
+int32_t MapBufferView::getKeyBucket(MapBuffer::Key key) const {
+  int32_t lo = 0;
+  int32_t hi = count_ - 1;
+  while (lo <= hi) {
+    int32_t mid = (lo + hi) >> 1;
+
+    MapBuffer::Key midVal =
+        *reinterpret_cast<const MapBuffer::Key*>(data_ + bucketOffset(mid));
+
+    if (midVal < key) {
+      lo = mid + 1;
+    } else if (midVal > key) {
+      hi = mid - 1;
+    } else {
+      return mid;
+    }
+  }
+
+  return -1;
+}
+
+int32_t MapBufferView::getInt(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return *reinterpret_cast<const int32_t*>(data_ + valueOffset(bucketIndex));
+}
+
+int64_t MapBufferView::getLong(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return *reinterpret_cast<const int64_t*>(data_ + valueOffset(bucketIndex));
+}
+
+bool MapBufferView::getBool(MapBuffer::Key key) const {
+  return getInt(key) != 0;
+}
+
+double MapBufferView::getDouble(MapBuffer::Key key) const {
+  auto bucketIndex = getKeyBucket(key);
+  react_native_assert(bucketIndex != -1 && "Key not found in MapBuffer");
+
+  return *reinterpret_cast<const double*>(data_ + valueOffset(bucketIndex));
+}
+
+int32_t MapBufferView::getDynamicDataOffset() const {
+  // The start of dynamic data can be calculated as the offset of the next
+  // key in the map
+  return bucketOffset(count_);
+}
+
+std::string_view MapBufferView::getString(MapBuffer::Key key) const {
+  // TODO T83483191:Add checks to verify that offsets are under the boundaries
+  // of the map buffer
+  int32_t dynamicDataOffset = getDynamicDataOffset();
+  int32_t offset = getInt(key);
+  int32_t stringLength =
+      *reinterpret_cast<const int32_t*>(data_ + dynamicDataOffset + offset);
+  const auto* stringPtr = reinterpret_cast<const char*>(
+      data_ + dynamicDataOffset + offset + sizeof(int32_t));
+
+  return {stringPtr, static_cast<size_t>(stringLength)};
+}
+
+MapBufferView MapBufferView::getMapBuffer(MapBuffer::Key key) const {
+  // TODO T83483191: Add checks to verify that offsets are under the boundaries
+  // of the map buffer
+  int32_t dynamicDataOffset = getDynamicDataOffset();
+
+  int32_t offset = getInt(key);
+  int32_t mapBufferLength =
+      *reinterpret_cast<const int32_t*>(data_ + dynamicDataOffset + offset);
+
+  return {
+      data_ + dynamicDataOffset + offset + sizeof(int32_t),
+      static_cast<size_t>(mapBufferLength)};
+}
+
+std::vector<MapBufferView> MapBufferView::getMapBufferList(
+    MapBuffer::Key key) const {
+  std::vector<MapBufferView> mapBufferList;
+
+  int32_t dynamicDataOffset = getDynamicDataOffset();
+  int32_t offset = getInt(key);
+  int32_t mapBufferListLength =
+      *reinterpret_cast<const int32_t*>(data_ + dynamicDataOffset + offset);
+  offset = offset + sizeof(uint32_t);
+
+  int32_t curLen = 0;
+  while (curLen < mapBufferListLength) {
+    int32_t mapBufferLength = *reinterpret_cast<const int32_t*>(
+        data_ + dynamicDataOffset + offset + curLen);
+    curLen = curLen + sizeof(uint32_t);
+    mapBufferList.emplace_back(
+        data_ + dynamicDataOffset + offset + curLen,
+        static_cast<size_t>(mapBufferLength));
+    curLen = curLen + mapBufferLength;
+  }
+  return mapBufferList;
+}
+
+bool MapBufferView::contains(MapBuffer::Key key) const {
+  return getKeyBucket(key) != -1;
+}
+
+size_t MapBufferView::size() const {
+  return size_;
+}
+
+const uint8_t* MapBufferView::data() const {
+  return data_;
+}
+
+uint16_t MapBufferView::count() const {
+  return count_;
+}
+
+} // namespace facebook::react
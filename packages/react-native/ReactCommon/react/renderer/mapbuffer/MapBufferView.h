@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/mapbuffer/MapBuffer.h>
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * Non-owning read-only view of MapBuffer data (see `MapBuffer` for the format).
+ * Strings and nested maps are returned as views into the same memory, so
+ * reading never copies the payload. A view must not outlive the memory it
+ * refers to (a `MapBuffer` or a `MapBufferArena`).
+ */
+class MapBufferView {
+ public:
+  MapBufferView(const uint8_t *data, size_t size);
+
+  int32_t getInt(MapBuffer::Key key) const;
+
+  int64_t getLong(MapBuffer::Key key) const;
+
+  bool getBool(MapBuffer::Key key) const;
+
+  double getDouble(MapBuffer::Key key) const;
+
+  std::string_view getString(MapBuffer::Key key) const;
+
+  MapBufferView getMapBuffer(MapBuffer::Key key) const;
+
+  std::vector<MapBufferView> getMapBufferList(MapBuffer::Key key) const;
+
+  /**
+   * Returns `true` if the map contains an entry for `key`.
+   */
+  bool contains(MapBuffer::Key key) const;
+
+  size_t size() const;
+
+  const uint8_t *data() const;
+
+  uint16_t count() const;
+
+ private:
+  friend MapBuffer;
+
+  /*
+   * Creates a view of a buffer whose header was already validated.
+   */
+  MapBufferView(const uint8_t *data, size_t size, uint16_t count);
+
+  const uint8_t *data_;
+  size_t size_;
+
+  // amount of items in the MapBuffer
+  uint16_t count_;
+
+  // returns the relative offset of the first byte of dynamic data
+  int32_t getDynamicDataOffset() const;
+
+  int32_t getKeyBucket(MapBuffer::Key key) const;
+};
+
+} // namespace facebook::react
@@ -11,7 +11,9 @@
 
 #include <gtest/gtest.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferArena.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
 
 using namespace facebook::react;
 
@@ -219,3 +221,99 @@ TEST(MapBufferTest, testMapRandomAccess) {
   EXPECT_EQ(map.getInt(1234), 4321);
   EXPECT_EQ(map.getString(65535), "Let's count: 的, 一, 是");
 }
+
+TEST(MapBufferTest, testViewReadsWithoutCopying) {
+  auto nestedBuilder = MapBufferBuilder();
+  nestedBuilder.putString(0, "Nested");
+  nestedBuilder.putDouble(1, 42.5);
+  auto nestedMap = nestedBuilder.build();
+
+  auto builder = MapBufferBuilder();
+  builder.putString(0, "This is a test");
+  builder.putInt(1, 1234);
+  builder.putMapBuffer(2, nestedMap);
+  builder.putMapBufferList(3, std::vector<MapBuffer>{});
+  auto map = builder.build();
+
+  auto view = map.view();
+  EXPECT_EQ(view.count(), 4);
+  EXPECT_EQ(view.getString(0), "This is a test");
+  EXPECT_EQ(view.getInt(1), 1234);
+  EXPECT_TRUE(view.contains(2));
+  EXPECT_FALSE(view.contains(4));
+
+  // Strings and nested maps point into the memory of the outer map.
+  auto string = view.getString(0);
+  EXPECT_GE(reinterpret_cast<const uint8_t*>(string.data()), map.data());
+  EXPECT_LE(
+      reinterpret_cast<const uint8_t*>(string.data() + string.size()),
+      map.data() + map.size());
+
+  auto nestedView = view.getMapBuffer(2);
+  EXPECT_GT(nestedView.data(), map.data());
+  EXPECT_EQ(nestedView.size(), nestedMap.size());
+  EXPECT_EQ(nestedView.getString(0), "Nested");
+  EXPECT_EQ(nestedView.getDouble(1), 42.5);
+
+  EXPECT_TRUE(view.getMapBufferList(3).empty());
+}
+
+TEST(MapBufferTest, testArenaBuild) {
+  auto arena = MapBufferArena(64);
+  auto builder = MapBufferBuilder();
+
+  builder.putInt(1, 4321);
+  builder.putString(0, "This is a test");
+  auto first = builder.build(arena);
+
+  // The builder is reusable after building into an arena.
+  builder.putDouble(0, 908.1);
+  builder.putMapBuffer(1, first);
+  auto second = builder.build(arena);
+
+  EXPECT_EQ(first.count(), 2);
+  EXPECT_EQ(first.getString(0), "This is a test");
+  EXPECT_EQ(first.getInt(1), 4321);
+
+  EXPECT_EQ(second.count(), 2);
+  EXPECT_EQ(second.getDouble(0), 908.1);
+  EXPECT_EQ(second.getMapBuffer(1).getString(0), "This is a test");
+
+  builder.putMapBufferList(0, std::vector<MapBufferView>{first, second});
+  auto list = builder.build(arena).getMapBufferList(0);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list[0].getInt(1), 4321);
+  EXPECT_EQ(list[1].getDouble(0), 908.1);
+
+  // Views built into the arena can be copied into owning MapBuffers.
+  auto owningBuilder = MapBufferBuilder();
+  owningBuilder.putMapBuffer(0, second);
+  auto map = owningBuilder.build();
+  EXPECT_EQ(map.getMapBuffer(0).getMapBuffer(1).getInt(1), 4321);
+}
+
+TEST(MapBufferTest, testArenaReuse) {
+  auto arena = MapBufferArena(1024);
+  auto builder = MapBufferBuilder();
+
+  for (int i = 0; i < 10; i++) {
+    builder.putString(0, std::string(100, 'a'));
+    builder.build(arena);
+  }
+  auto capacity = arena.capacity();
+  EXPECT_GE(capacity, 1024);
+
+  // Maps larger than a chunk get their own chunk.
+  builder.putString(0, std::string(4096, 'b'));
+  auto large = builder.build(arena);
+  EXPECT_EQ(large.getString(0), std::string(4096, 'b'));
+  capacity = arena.capacity();
+
+  arena.reset();
+  for (int i = 0; i < 10; i++) {
+    builder.putString(0, std::string(100, 'c'));
+    auto view = builder.build(arena);
+    EXPECT_EQ(view.getString(0), std::string(100, 'c'));
+  }
+  EXPECT_EQ(arena.capacity(), capacity);
+}
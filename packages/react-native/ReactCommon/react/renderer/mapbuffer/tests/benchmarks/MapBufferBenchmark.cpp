@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/mapbuffer/MapBufferArena.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+#include <react/renderer/mapbuffer/MapBufferView.h>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kViewCount = 100;
+
+constexpr MapBuffer::Key kKeyOpacity = 0;
+constexpr MapBuffer::Key kKeyBackgroundColor = 1;
+constexpr MapBuffer::Key kKeyBorderRadius = 2;
+constexpr MapBuffer::Key kKeyTestId = 3;
+constexpr MapBuffer::Key kKeyAccessibilityLabel = 4;
+constexpr MapBuffer::Key kKeyBorderWidths = 5;
+constexpr MapBuffer::Key kKeyTransform = 6;
+constexpr MapBuffer::Key kKeyPointerEvents = 7;
+constexpr MapBuffer::Key kKeyZIndex = 8;
+
+auto testId = std::string{"feed-item-with-a-reasonably-long-test-id"};
+auto accessibilityLabel =
+    std::string{"A feed item with a title, a subtitle and a thumbnail"};
+
+/*
+ * Puts the props of a typical view: a few primitives, two strings, a nested
+ * map of border widths and a list of transform operations.
+ */
+template <typename BuildNestedT>
+static void putViewProps(
+    MapBufferBuilder& builder,
+    int index,
+    BuildNestedT buildNested) {
+  builder.putDouble(kKeyOpacity, 0.5 + index % 2);
+  builder.putInt(kKeyBackgroundColor, 0xFF00FF00 + index);
+  builder.putDouble(kKeyBorderRadius, 8);
+  builder.putString(kKeyTestId, testId);
+  builder.putString(kKeyAccessibilityLabel, accessibilityLabel);
+  buildNested(builder);
+  builder.putInt(kKeyPointerEvents, 1);
+  builder.putInt(kKeyZIndex, index);
+}
+
+template <typename MapT>
+static void readViewProps(const MapT& map) {
+  benchmark::DoNotOptimize(map.getDouble(kKeyOpacity));
+  benchmark::DoNotOptimize(map.getInt(kKeyBackgroundColor));
+  benchmark::DoNotOptimize(map.getDouble(kKeyBorderRadius));
+  benchmark::DoNotOptimize(map.getString(kKeyTestId));
+  benchmark::DoNotOptimize(map.getString(kKeyAccessibilityLabel));
+  auto borderWidths = map.getMapBuffer(kKeyBorderWidths);
+  for (MapBuffer::Key edge = 0; edge < 4; edge++) {
+    benchmark::DoNotOptimize(borderWidths.getDouble(edge));
+  }
+  for (const auto& operation : map.getMapBufferList(kKeyTransform)) {
+    benchmark::DoNotOptimize(operation.getDouble(1));
+  }
+  benchmark::DoNotOptimize(map.getInt(kKeyPointerEvents));
+  benchmark::DoNotOptimize(map.getInt(kKeyZIndex));
+}
+
+static MapBuffer buildBorderWidths() {
+  auto builder = MapBufferBuilder();
+  for (MapBuffer::Key edge = 0; edge < 4; edge++) {
+    builder.putDouble(edge, 1);
+  }
+  return builder.build();
+}
+
+static std::vector<MapBuffer> buildTransform() {
+  auto transform = std::vector<MapBuffer>{};
+  for (int i = 0; i < 3; i++) {
+    auto builder = MapBufferBuilder();
+    builder.putInt(0, i);
+    builder.putDouble(1, 1.5);
+    transform.push_back(builder.build());
+  }
+  return transform;
+}
+
+static void buildAndReadOwningMapBuffers(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < kViewCount; i++) {
+      auto builder = MapBufferBuilder();
+      putViewProps(builder, i, [](MapBufferBuilder& builder) {
+        builder.putMapBuffer(kKeyBorderWidths, buildBorderWidths());
+        builder.putMapBufferList(kKeyTransform, buildTransform());
+      });
+      auto map = builder.build();
+      readViewProps(map);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kViewCount);
+}
+BENCHMARK(buildAndReadOwningMapBuffers);
+
+static void buildAndReadMapBufferViewsInArena(benchmark::State& state) {
+  auto arena = MapBufferArena();
+  auto builder = MapBufferBuilder();
+  auto nestedBuilder = MapBufferBuilder();
+  auto transform = std::vector<MapBufferView>{};
+
+  for (auto _ : state) {
+    arena.reset();
+    for (int i = 0; i < kViewCount; i++) {
+      putViewProps(builder, i, [&](MapBufferBuilder& builder) {
+        for (MapBuffer::Key edge = 0; edge < 4; edge++) {
+          nestedBuilder.putDouble(edge, 1);
+        }
+        builder.putMapBuffer(kKeyBorderWidths, nestedBuilder.build(arena));
+
+        transform.clear();
+        for (int j = 0; j < 3; j++) {
+          nestedBuilder.putInt(0, j);
+          nestedBuilder.putDouble(1, 1.5);
+          transform.push_back(nestedBuilder.build(arena));
+        }
+        builder.putMapBufferList(kKeyTransform, transform);
+      });
+      auto map = builder.build(arena);
+      readViewProps(map);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kViewCount);
+}
+BENCHMARK(buildAndReadMapBufferViewsInArena);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
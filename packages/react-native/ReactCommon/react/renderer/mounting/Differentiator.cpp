@@ -1361,9 +1361,226 @@ static void calculateShadowViewMutations(
       std::back_inserter(mutations));
 }
 
+static bool isHiddenShadowNode(const ShadowNode& shadowNode) {
+  // Must be kept in sync with `sliceChildShadowNodeViewPairsRecursively`.
+  return
+#ifdef ANDROID
+      ReactNativeFeatureFlags::useTraitHiddenOnAndroid() &&
+#endif
+      shadowNode.getTraits().check(ShadowNodeTraits::Trait::Hidden);
+}
+
+static bool hasVisibleChildren(const ShadowNode& shadowNode) {
+  for (const auto& childShadowNode : shadowNode.getChildren()) {
+    if (!isHiddenShadowNode(*childShadowNode)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+using ChangedShadowViewNodePairs =
+    std::vector<std::pair<ShadowViewNodePair, ShadowViewNodePair>>;
+
+/**
+ * Collects pairs of children (including children hoisted from flattened
+ * changed children) that differ between `oldParentShadowNode` and
+ * `newParentShadowNode`, in the order in which they would appear in the
+ * result of `sliceChildShadowNodeViewPairs`.
+ *
+ * Returns `false` if the level changed its shape in any way that might make
+ * the result of the full algorithm differ from only visiting changed pairs:
+ * different children counts or families, changed traits, reordering via
+ * `orderIndex` or static positioning, hidden nodes or moved flattened nodes.
+ */
+static bool collectChangedChildShadowViewNodePairs(
+    const ShadowNode& oldParentShadowNode,
+    const ShadowNode& newParentShadowNode,
+    Point layoutOffset,
+    ChangedShadowViewNodePairs& changedPairs) {
+  const auto& oldChildren = oldParentShadowNode.getChildren();
+  const auto& newChildren = newParentShadowNode.getChildren();
+  if (oldChildren.size() != newChildren.size()) {
+    return false;
+  }
+
+  bool childrenFormStackingContexts = newParentShadowNode.getTraits().check(
+      ShadowNodeTraits::Trait::ChildrenFormStackingContext);
+  if (childrenFormStackingContexts !=
+      oldParentShadowNode.getTraits().check(
+          ShadowNodeTraits::Trait::ChildrenFormStackingContext)) {
+    return false;
+  }
+
+  for (size_t index = 0; index < newChildren.size(); index++) {
+    const auto& oldChildShadowNode = *oldChildren[index];
+    const auto& newChildShadowNode = *newChildren[index];
+
+    // Unchanged subtrees produce identical pairs in both trees.
+    if (&oldChildShadowNode == &newChildShadowNode) {
+      continue;
+    }
+
+    auto traits = newChildShadowNode.getTraits();
+    if (!ShadowNode::sameFamily(oldChildShadowNode, newChildShadowNode) ||
+        traits.get() != oldChildShadowNode.getTraits().get() ||
+        isHiddenShadowNode(newChildShadowNode) ||
+        oldChildShadowNode.getOrderIndex() != 0 ||
+        newChildShadowNode.getOrderIndex() != 0) {
+      return false;
+    }
+
+    auto oldShadowView = ShadowView(oldChildShadowNode);
+    auto newShadowView = ShadowView(newChildShadowNode);
+
+    // Static children are inserted in front of the other children, which
+    // changes the relative order of changed pairs.
+    if (oldShadowView.layoutMetrics.positionType !=
+            newShadowView.layoutMetrics.positionType ||
+        newShadowView.layoutMetrics.positionType == PositionType::Static) {
+      return false;
+    }
+
+    auto oldOrigin = layoutOffset;
+    if (oldShadowView.layoutMetrics != EmptyLayoutMetrics) {
+      oldOrigin += oldShadowView.layoutMetrics.frame.origin;
+      oldShadowView.layoutMetrics.frame.origin += layoutOffset;
+    }
+    auto newOrigin = layoutOffset;
+    if (newShadowView.layoutMetrics != EmptyLayoutMetrics) {
+      newOrigin += newShadowView.layoutMetrics.frame.origin;
+      newShadowView.layoutMetrics.frame.origin += layoutOffset;
+    }
+
+    bool isConcreteView =
+        (traits.check(ShadowNodeTraits::Trait::FormsView) ||
+         childrenFormStackingContexts) &&
+        !traits.check(ShadowNodeTraits::Trait::ForceFlattenView);
+    bool areChildrenFlattened =
+        (!traits.check(ShadowNodeTraits::Trait::FormsStackingContext) &&
+         !childrenFormStackingContexts) ||
+        traits.check(ShadowNodeTraits::Trait::ForceFlattenView);
+
+    // Moving a flattened node moves all of its hoisted descendants, so the
+    // unchanged ones would need `Update` mutations too.
+    if (areChildrenFlattened && oldOrigin != newOrigin) {
+      return false;
+    }
+
+    changedPairs.emplace_back(
+        ShadowViewNodePair{
+            .shadowView = std::move(oldShadowView),
+            .shadowNode = &oldChildShadowNode,
+            .flattened = areChildrenFlattened,
+            .isConcreteView = isConcreteView,
+            .contextOrigin = areChildrenFlattened ? oldOrigin : Point{}},
+        ShadowViewNodePair{
+            .shadowView = std::move(newShadowView),
+            .shadowNode = &newChildShadowNode,
+            .flattened = areChildrenFlattened,
+            .isConcreteView = isConcreteView,
+            .contextOrigin = areChildrenFlattened ? newOrigin : Point{}});
+
+    if (areChildrenFlattened &&
+        !collectChangedChildShadowViewNodePairs(
+            oldChildShadowNode, newChildShadowNode, newOrigin, changedPairs)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Incremental counterpart of `calculateShadowViewMutations` for a single
+ * level of the tree whose shape did not change. Instead of slicing and
+ * comparing every child, only children that were cloned between the two
+ * trees (the changed spine) are visited; pointer-equal siblings are skipped.
+ *
+ * Produces exactly the mutations the full algorithm would have produced for
+ * this level, or returns `false` without producing anything if it cannot
+ * guarantee that, in which case the caller must fall back to a full diff.
+ * Must only be used when view culling is disabled.
+ */
+static bool calculateShadowViewMutationsAlongChangedSpine(
+    ShadowViewMutation::List& mutations,
+    Tag parentTag,
+    const ShadowNode& oldParentShadowNode,
+    const ShadowNode& newParentShadowNode) {
+  auto changedPairs = ChangedShadowViewNodePairs{};
+  if (!collectChangedChildShadowViewNodePairs(
+          oldParentShadowNode, newParentShadowNode, {}, changedPairs)) {
+    return false;
+  }
+
+  auto updateMutations = ShadowViewMutation::List{};
+  auto downwardMutations = ShadowViewMutation::List{};
+  auto destructiveDownwardMutations = ShadowViewMutation::List{};
+
+  for (const auto& [oldChildPair, newChildPair] : changedPairs) {
+    DEBUG_LOGS({
+      LOG(ERROR) << "Differ Spine: Same tags, update and recurse: "
+                 << oldChildPair << " and " << newChildPair << " with parent: ["
+                 << parentTag << "]";
+    });
+
+    if (newChildPair.isConcreteView &&
+        oldChildPair.shadowView != newChildPair.shadowView) {
+      updateMutations.push_back(
+          ShadowViewMutation::UpdateMutation(
+              oldChildPair.shadowView, newChildPair.shadowView, parentTag));
+    }
+
+    // Children of flattened nodes were already collected on this level.
+    if (oldChildPair.flattened) {
+      continue;
+    }
+
+    auto& childMutations = hasVisibleChildren(*newChildPair.shadowNode)
+        ? downwardMutations
+        : destructiveDownwardMutations;
+
+    if (calculateShadowViewMutationsAlongChangedSpine(
+            childMutations,
+            oldChildPair.shadowView.tag,
+            *oldChildPair.shadowNode,
+            *newChildPair.shadowNode)) {
+      continue;
+    }
+
+    ViewNodePairScope innerScope{};
+    calculateShadowViewMutations(
+        innerScope,
+        childMutations,
+        oldChildPair.shadowView.tag,
+        sliceChildShadowNodeViewPairsFromViewNodePair(
+            oldChildPair, innerScope, false, {}),
+        sliceChildShadowNodeViewPairsFromViewNodePair(
+            newChildPair, innerScope, false, {}));
+  }
+
+  // Same order as in `calculateShadowViewMutations`; a level of unchanged
+  // shape can't produce any other kinds of mutations.
+  std::move(
+      destructiveDownwardMutations.begin(),
+      destructiveDownwardMutations.end(),
+      std::back_inserter(mutations));
+  std::move(
+      updateMutations.begin(),
+      updateMutations.end(),
+      std::back_inserter(mutations));
+  std::move(
+      downwardMutations.begin(),
+      downwardMutations.end(),
+      std::back_inserter(mutations));
+
+  return true;
+}
+
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode& oldRootShadowNode,
-    const ShadowNode& newRootShadowNode) {
+    const ShadowNode& newRootShadowNode,
+    bool allowIncrementalDiffing) {
   TraceSection s("calculateShadowViewMutations");
 
   // Root shadow nodes must be belong the same family.
@@ -1386,24 +1603,36 @@ ShadowViewMutation::List calculateShadowViewMutations(
             oldRootShadowView, newRootShadowView, {}));
   }
 
-  auto sliceOne = sliceChildShadowNodeViewPairs(
-      ShadowViewNodePair{.shadowNode = &oldRootShadowNode},
-      viewNodePairScope,
-      false /* allowFlattened */,
-      {} /* layoutOffset */,
-      {} /* cullingContext */);
-  auto sliceTwo = sliceChildShadowNodeViewPairs(
-      ShadowViewNodePair{.shadowNode = &newRootShadowNode},
-      viewNodePairScope,
-      false /* allowFlattened */,
-      {} /* layoutOffset */,
-      {} /* cullingContext */);
-  calculateShadowViewMutations(
-      innerViewNodePairScope,
-      mutations,
-      oldRootShadowNode.getTag(),
-      std::move(sliceOne),
-      std::move(sliceTwo));
+  // View culling makes the result depend on the position of every ancestor,
+  // so there is no cheap way to tell that a sibling subtree is unaffected.
+  bool diffedIncrementally = allowIncrementalDiffing &&
+      !ReactNativeFeatureFlags::enableViewCulling() &&
+      calculateShadowViewMutationsAlongChangedSpine(
+          mutations,
+          oldRootShadowNode.getTag(),
+          oldRootShadowNode,
+          newRootShadowNode);
+
+  if (!diffedIncrementally) {
+    auto sliceOne = sliceChildShadowNodeViewPairs(
+        ShadowViewNodePair{.shadowNode = &oldRootShadowNode},
+        viewNodePairScope,
+        false /* allowFlattened */,
+        {} /* layoutOffset */,
+        {} /* cullingContext */);
+    auto sliceTwo = sliceChildShadowNodeViewPairs(
+        ShadowViewNodePair{.shadowNode = &newRootShadowNode},
+        viewNodePairScope,
+        false /* allowFlattened */,
+        {} /* layoutOffset */,
+        {} /* cullingContext */);
+    calculateShadowViewMutations(
+        innerViewNodePairScope,
+        mutations,
+        oldRootShadowNode.getTag(),
+        std::move(sliceOne),
+        std::move(sliceTwo));
+  }
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Completed: " << mutations.size() << " mutations";
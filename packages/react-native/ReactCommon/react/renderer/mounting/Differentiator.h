@@ -16,9 +16,16 @@ namespace facebook::react {
  * Calculates a list of view mutations which describes how the old
  * `ShadowTree` can be transformed to the new one.
  * The list of mutations might be and might not be optimal.
+ *
+ * When `allowIncrementalDiffing` is `true`, the differ only descends along
+ * the spine of nodes that were cloned between the two trees, skipping the
+ * flattening of unchanged siblings whenever the shape of a level did not
+ * change. It falls back to a full diff of a level otherwise. Both modes
+ * produce identical mutation lists.
  */
 ShadowViewMutation::List calculateShadowViewMutations(
     const ShadowNode &oldRootShadowNode,
-    const ShadowNode &newRootShadowNode);
+    const ShadowNode &newRootShadowNode,
+    bool allowIncrementalDiffing = true);
 
 } // namespace facebook::react
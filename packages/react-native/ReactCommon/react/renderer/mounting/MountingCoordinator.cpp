@@ -12,6 +12,7 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/utils/LowPriorityExecutor.h>
+#include <react/utils/Telemetry.h>
 #include <condition_variable>
 #include "updateMountedFlag.h"
 
@@ -37,6 +38,8 @@ SurfaceId MountingCoordinator::getSurfaceId() const {
 }
 
 void MountingCoordinator::push(ShadowTreeRevision revision) const {
+  auto diffExecutor = DiffExecutor{};
+
   {
     std::scoped_lock lock(mutex_);
 
@@ -44,21 +47,79 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
         !lastRevision_.has_value() || revision.number != lastRevision_->number);
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
+      if (lastRevision_.has_value()) {
+        numberOfCoalescedRevisions_++;
+      }
       lastRevision_ = std::move(revision);
+
+      // A scheduled calculation picks up the new revision once it's done
+      // with the current one.
+      if (diffExecutor_ && !isDiffScheduled_) {
+        isDiffScheduled_ = true;
+        diffExecutor = diffExecutor_;
+      }
     }
   }
 
   signal_.notify_all();
+
+  if (diffExecutor) {
+    diffExecutor([weakThis = weak_from_this()]() {
+      if (auto strongThis = weakThis.lock()) {
+        strongThis->calculatePendingMutations();
+      }
+    });
+  }
 }
 
 void MountingCoordinator::revoke() const {
-  std::scoped_lock lock(mutex_);
+  std::unique_lock lock(mutex_);
   // We have two goals here.
   // 1. We need to stop retaining `ShadowNode`s to not prolong their lifetime
   // to prevent them from overliving `ComponentDescriptor`s.
   // 2. A possible call to `pullTransaction()` should return empty optional.
+  // A running calculation of mutations accesses the `ShadowNode`s too, so it
+  // has to finish first.
+  signal_.wait(
+      lock, [this]() { return !revisionNumberBeingDiffed_.has_value(); });
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+  precalculatedMutations_.reset();
+}
+
+void MountingCoordinator::calculatePendingMutations() const {
+  TraceSection section("MountingCoordinator::calculatePendingMutations");
+
+  std::unique_lock lock(mutex_);
+
+  while (lastRevision_.has_value() && baseRevision_.rootShadowNode &&
+         !(precalculatedMutations_.has_value() &&
+           precalculatedMutations_->baseRevisionNumber ==
+               baseRevision_.number &&
+           precalculatedMutations_->revisionNumber == lastRevision_->number)) {
+    auto baseRevision = baseRevision_;
+    auto revision = *lastRevision_;
+    revisionNumberBeingDiffed_ = revision.number;
+    lock.unlock();
+
+    auto telemetry = revision.telemetry;
+    telemetry.willDiff();
+    auto mutations = calculateShadowViewMutations(
+        *baseRevision.rootShadowNode, *revision.rootShadowNode);
+    telemetry.didDiff();
+
+    lock.lock();
+    // The mutations may be outdated already, `pullTransaction` checks that.
+    precalculatedMutations_ = PrecalculatedMutations{
+        .baseRevisionNumber = baseRevision.number,
+        .revisionNumber = revision.number,
+        .mutations = std::move(mutations),
+        .telemetry = telemetry};
+    revisionNumberBeingDiffed_.reset();
+    signal_.notify_all();
+  }
+
+  isDiffScheduled_ = false;
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -72,7 +133,19 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
     bool willPerformAsynchronously) const {
   TraceSection section("MountingCoordinator::pullTransaction");
 
-  std::scoped_lock lock(mutex_);
+  std::unique_lock lock(mutex_);
+
+  // Waiting for the mutations leading to the revision being mounted if they
+  // are being calculated already, which is never slower than calculating them
+  // again on this thread.
+  auto waitStartTime = telemetryTimePointNow();
+  signal_.wait(lock, [this]() {
+    return !revisionNumberBeingDiffed_.has_value() ||
+        !lastRevision_.has_value() ||
+        *revisionNumberBeingDiffed_ != lastRevision_->number;
+  });
+  auto waitTime = std::chrono::duration_cast<TelemetryDuration>(
+      telemetryTimePointNow() - waitStartTime);
 
   auto transaction = std::optional<MountingTransaction>{};
 
@@ -80,14 +153,29 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
   if (lastRevision_.has_value()) {
     number_++;
 
-    auto telemetry = lastRevision_->telemetry;
+    auto mutations = ShadowViewMutation::List{};
+    auto telemetry = TransactionTelemetry{};
 
-    telemetry.willDiff();
+    if (precalculatedMutations_.has_value() &&
+        precalculatedMutations_->baseRevisionNumber == baseRevision_.number &&
+        precalculatedMutations_->revisionNumber == lastRevision_->number) {
+      mutations = std::move(precalculatedMutations_->mutations);
+      telemetry = precalculatedMutations_->telemetry;
+      telemetry.didDiffAhead(waitTime);
+    } else {
+      telemetry = lastRevision_->telemetry;
 
-    auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+      telemetry.willDiff();
 
-    telemetry.didDiff();
+      mutations = calculateShadowViewMutations(
+          *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+
+      telemetry.didDiff();
+    }
+
+    precalculatedMutations_.reset();
+    telemetry.setNumberOfCoalescedRevisions(numberOfCoalescedRevisions_);
+    numberOfCoalescedRevisions_ = 0;
 
     transaction = MountingTransaction{
         surfaceId_, number_, std::move(mutations), telemetry};
@@ -207,6 +295,11 @@ ShadowTreeRevision MountingCoordinator::getBaseRevision() const {
   return baseRevision_;
 }
 
+void MountingCoordinator::setDiffExecutor(DiffExecutor diffExecutor) const {
+  std::scoped_lock lock(mutex_);
+  diffExecutor_ = std::move(diffExecutor);
+}
+
 void MountingCoordinator::setMountingOverrideDelegate(
     std::weak_ptr<const MountingOverrideDelegate> delegate) const {
   std::scoped_lock lock(mutex_);
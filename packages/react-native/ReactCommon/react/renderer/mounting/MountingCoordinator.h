@@ -9,6 +9,8 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <optional>
 
 #include <react/renderer/debug/flags.h>
@@ -30,9 +32,13 @@ namespace facebook::react {
  * recent committed one. Then when a new mounting transaction is requested the
  * object generates mutation instructions and returns it as a
  * `MountingTransaction`.
+ * Optionally, the mutation instructions can be calculated ahead of time on a
+ * background executor (see `setDiffExecutor`).
  */
-class MountingCoordinator final {
+class MountingCoordinator final : public std::enable_shared_from_this<MountingCoordinator> {
  public:
+  using DiffExecutor = std::function<void(std::function<void()> &&task)>;
+
   /*
    * The constructor is meant to be used only inside `ShadowTree`, and it's
    * `public` only to enable using with `std::make_shared<>`.
@@ -96,6 +102,17 @@ class MountingCoordinator final {
 
   ShadowTreeRevision getBaseRevision() const;
 
+  /*
+   * Sets the executor used to calculate the mutations of pushed revisions
+   * ahead of `pullTransaction`, so the diff doesn't happen on the mounting
+   * thread. The executor must eventually run every task it receives.
+   * A revision superseded by a newer one before its mutations are calculated
+   * is skipped. `pullTransaction` uses the calculated mutations if they lead
+   * to the revision being mounted, waits for the calculation if it is in
+   * progress, and diffs the revisions itself otherwise.
+   */
+  void setDiffExecutor(DiffExecutor diffExecutor) const;
+
   /*
    * Methods from this section are meant to be used by
    * `MountingOverrideDelegate` only.
@@ -120,10 +137,26 @@ class MountingCoordinator final {
    */
   void revoke() const;
 
+  /*
+   * Mutations between two revisions calculated ahead of `pullTransaction`.
+   */
+  struct PrecalculatedMutations {
+    ShadowTreeRevision::Number baseRevisionNumber;
+    ShadowTreeRevision::Number revisionNumber;
+    ShadowViewMutation::List mutations;
+    TransactionTelemetry telemetry;
+  };
+
+  /*
+   * Runs on the diff executor: calculates the mutations leading to the last
+   * pushed revision until they are up to date.
+   */
+  void calculatePendingMutations() const;
+
   const SurfaceId surfaceId_;
 
-  // Protects access to `baseRevision_`, `lastRevision_` and
-  // `mountingOverrideDelegate_`.
+  // Protects access to `baseRevision_`, `lastRevision_`,
+  // `mountingOverrideDelegate_` and the state of the mutation calculation.
   mutable std::mutex mutex_;
   mutable ShadowTreeRevision baseRevision_;
   mutable bool hasPendingTransactionsOverride_{false};
@@ -132,6 +165,15 @@ class MountingCoordinator final {
   mutable std::condition_variable signal_;
   mutable std::vector<std::weak_ptr<const MountingOverrideDelegate>> mountingOverrideDelegates_;
 
+  mutable DiffExecutor diffExecutor_;
+  mutable bool isDiffScheduled_{false};
+  // The number of the revision whose mutations are being calculated.
+  mutable std::optional<ShadowTreeRevision::Number> revisionNumberBeingDiffed_{};
+  mutable std::optional<PrecalculatedMutations> precalculatedMutations_{};
+  // Revisions pushed since the last transaction and superseded before being
+  // mounted.
+  mutable int numberOfCoalescedRevisions_{0};
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
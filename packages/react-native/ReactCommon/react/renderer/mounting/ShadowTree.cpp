@@ -13,6 +13,7 @@
 #include <react/renderer/components/view/ViewShadowNode.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
@@ -352,6 +353,15 @@ CommitStatus ShadowTree::tryCommit(
           commitOptions.source);
     }
 
+    currentRevisionIndex_.update(
+        *currentRevision_.rootShadowNode, *newRootShadowNode);
+
+    // Includes the clones made by React before the commit, which happen on the
+    // committing thread as well.
+    auto allocationCounters = ShadowNodeMemoryPool::takeThreadLocalCounters();
+    telemetry.setShadowNodeAllocationCounts(
+        static_cast<int>(allocationCounters.allocations),
+        static_cast<int>(allocationCounters.systemAllocations));
     telemetry.didCommit();
     telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
 
@@ -381,6 +391,22 @@ ShadowTreeRevision ShadowTree::getCurrentRevision() const {
   return currentRevision_;
 }
 
+std::shared_ptr<const ShadowNode> ShadowTree::findNodeByTag(Tag tag) const {
+  SharedLock lock = sharedCommitLock();
+  return currentRevisionIndex_.findNodeByTag(tag);
+}
+
+std::optional<std::shared_ptr<const ShadowNode>>
+ShadowTree::findNodeByNativeId(
+    const RootShadowNode& rootShadowNode,
+    const std::string& nativeId) const {
+  SharedLock lock = sharedCommitLock();
+  if (&rootShadowNode != currentRevision_.rootShadowNode.get()) {
+    return std::nullopt;
+  }
+  return currentRevisionIndex_.findNodeByNativeId(rootShadowNode, nativeId);
+}
+
 void ShadowTree::mount(ShadowTreeRevision revision, bool mountSynchronously)
     const {
   mountingCoordinator_->push(std::move(revision));
@@ -9,7 +9,9 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <string>
 
 #include <react/renderer/components/root/RootShadowNode.h>
 #include <react/renderer/core/LayoutConstraints.h>
@@ -17,6 +19,7 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/mounting/MountingCoordinator.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeIndex.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/utils/ContextContainer.h>
 #include "MountingOverrideDelegate.h"
@@ -123,6 +126,24 @@ class ShadowTree final {
    */
   ShadowTreeRevision getCurrentRevision() const;
 
+  /*
+   * Returns the node of the current revision with the given tag, or `nullptr`
+   * if there is none. Lookups are served from an index which is updated
+   * incrementally by every commit.
+   */
+  std::shared_ptr<const ShadowNode> findNodeByTag(Tag tag) const;
+
+  /*
+   * Returns the first descendant of `rootShadowNode` (in depth-first
+   * pre-order) with the given `nativeId`, or `nullptr` if there is none.
+   * Lookups are served from the same index as `findNodeByTag`, which only
+   * describes the current revision, so an empty optional is returned if
+   * `rootShadowNode` is not the root node of the current revision.
+   */
+  std::optional<std::shared_ptr<const ShadowNode>> findNodeByNativeId(
+      const RootShadowNode &rootShadowNode,
+      const std::string &nativeId) const;
+
   /*
    * Commit an empty tree (a new `RootShadowNode` with no children).
    */
@@ -149,6 +170,7 @@ class ShadowTree final {
   mutable std::recursive_mutex commitMutexRecursive_;
   mutable CommitMode commitMode_{CommitMode::Normal}; // Protected by `commitMutex_`.
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
+  mutable ShadowTreeIndex currentRevisionIndex_; // Protected by `commitMutex_`.
   std::shared_ptr<const MountingCoordinator> mountingCoordinator_;
 
   using UniqueLock = std::variant<std::unique_lock<std::shared_mutex>, std::unique_lock<std::recursive_mutex>>;
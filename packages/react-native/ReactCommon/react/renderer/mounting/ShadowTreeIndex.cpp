@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowTreeIndex.h"
+
+#include <algorithm>
+
+#include <cxxreact/TraceSection.h>
+
+namespace facebook::react {
+
+namespace {
+
+using ShadowNodeList = std::vector<std::shared_ptr<const ShadowNode>>;
+
+/*
+ * Collects the nodes which are only part of the old tree and the nodes which
+ * are only part of the new tree. This is the same simplified diffing
+ * algorithm as the one in `updateMountedFlag`: updated nodes are both removed
+ * and inserted, and identical subtrees are skipped.
+ */
+void collectChanges(
+    const ShadowNodeList& oldChildren,
+    const ShadowNodeList& newChildren,
+    std::vector<const ShadowNode*>& removedNodes,
+    std::vector<const std::shared_ptr<const ShadowNode>*>& insertedNodes) {
+  if (&oldChildren == &newChildren) {
+    return;
+  }
+
+  size_t index = 0;
+
+  // Stage 1: Updated children.
+  for (index = 0; index < oldChildren.size() && index < newChildren.size();
+       index++) {
+    const auto& oldChild = oldChildren[index];
+    const auto& newChild = newChildren[index];
+
+    if (oldChild == newChild) {
+      // Nodes are identical, skipping the subtree.
+      continue;
+    }
+
+    if (!ShadowNode::sameFamily(*oldChild, *newChild)) {
+      break;
+    }
+
+    removedNodes.push_back(oldChild.get());
+    insertedNodes.push_back(&newChild);
+    collectChanges(
+        oldChild->getChildren(),
+        newChild->getChildren(),
+        removedNodes,
+        insertedNodes);
+  }
+
+  size_t lastIndexAfterFirstStage = index;
+
+  // Stage 2: Inserted children.
+  for (index = lastIndexAfterFirstStage; index < newChildren.size(); index++) {
+    const auto& newChild = newChildren[index];
+    insertedNodes.push_back(&newChild);
+    collectChanges({}, newChild->getChildren(), removedNodes, insertedNodes);
+  }
+
+  // Stage 3: Removed children.
+  for (index = lastIndexAfterFirstStage; index < oldChildren.size(); index++) {
+    const auto& oldChild = oldChildren[index];
+    removedNodes.push_back(oldChild.get());
+    collectChanges(oldChild->getChildren(), {}, removedNodes, insertedNodes);
+  }
+}
+
+std::shared_ptr<const ShadowNode> findNodeByNativeIdRecursively(
+    const ShadowNode& shadowNode,
+    const std::string& nativeId) {
+  for (const auto& childNode : shadowNode.getChildren()) {
+    if (childNode->getProps()->nativeId == nativeId) {
+      return childNode;
+    }
+
+    auto result = findNodeByNativeIdRecursively(*childNode, nativeId);
+    if (result) {
+      return result;
+    }
+  }
+
+  return nullptr;
+}
+
+} // namespace
+
+void ShadowTreeIndex::update(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode) {
+  TraceSection s("ShadowTreeIndex::update");
+
+  auto removedNodes = std::vector<const ShadowNode*>{};
+  auto insertedNodes = std::vector<const std::shared_ptr<const ShadowNode>*>{};
+  collectChanges(
+      oldRootShadowNode.getChildren(),
+      newRootShadowNode.getChildren(),
+      removedNodes,
+      insertedNodes);
+
+  // All removals go first, so a node which was moved to a different parent
+  // (and is therefore both removed and inserted) stays in the index.
+  for (const auto* node : removedNodes) {
+    auto tag = node->getTag();
+    auto it = nodesByTag_.find(tag);
+    if (it != nodesByTag_.end() && it->second.get() == node) {
+      nodesByTag_.erase(it);
+    }
+
+    const auto& nativeId = node->getProps()->nativeId;
+    if (!nativeId.empty()) {
+      auto tagsIt = tagsByNativeId_.find(nativeId);
+      if (tagsIt != tagsByNativeId_.end()) {
+        auto& tags = tagsIt->second;
+        auto tagIt = std::find(tags.begin(), tags.end(), tag);
+        if (tagIt != tags.end()) {
+          tags.erase(tagIt);
+        }
+        if (tags.empty()) {
+          tagsByNativeId_.erase(tagsIt);
+        }
+      }
+    }
+  }
+
+  for (const auto* node : insertedNodes) {
+    auto tag = (*node)->getTag();
+    nodesByTag_[tag] = *node;
+
+    const auto& nativeId = (*node)->getProps()->nativeId;
+    if (!nativeId.empty()) {
+      tagsByNativeId_[nativeId].push_back(tag);
+    }
+  }
+}
+
+std::shared_ptr<const ShadowNode> ShadowTreeIndex::findNodeByTag(
+    Tag tag) const {
+  auto it = nodesByTag_.find(tag);
+  return it != nodesByTag_.end() ? it->second : nullptr;
+}
+
+std::shared_ptr<const ShadowNode> ShadowTreeIndex::findNodeByNativeId(
+    const ShadowNode& rootShadowNode,
+    const std::string& nativeId) const {
+  if (nativeId.empty()) {
+    return findNodeByNativeIdRecursively(rootShadowNode, nativeId);
+  }
+
+  auto it = tagsByNativeId_.find(nativeId);
+  if (it == tagsByNativeId_.end()) {
+    return nullptr;
+  }
+
+  if (it->second.size() == 1) {
+    return findNodeByTag(it->second.front());
+  }
+
+  // The index doesn't keep track of the order of the nodes.
+  return findNodeByNativeIdRecursively(rootShadowNode, nativeId);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/core/ShadowNode.h>
+
+namespace facebook::react {
+
+/*
+ * Indexes the descendants of the root node of a shadow tree revision by tag
+ * and `nativeId`.
+ * The index is not rebuilt for every revision: `update` derives it from the
+ * index of the previous revision and the nodes which were inserted, removed
+ * or updated between the two revisions. Subtrees shared by both revisions are
+ * skipped, so an update costs as much as the diff of the revisions.
+ * The class is not thread-safe; `ShadowTree` protects it with its commit
+ * lock.
+ */
+class ShadowTreeIndex final {
+ public:
+  /*
+   * Updates the index of the tree with root `oldRootShadowNode` to describe
+   * the tree with root `newRootShadowNode`.
+   */
+  void update(const ShadowNode &oldRootShadowNode, const ShadowNode &newRootShadowNode);
+
+  /*
+   * Returns the descendant of the indexed root node with the given tag, or
+   * `nullptr` if there is none.
+   */
+  std::shared_ptr<const ShadowNode> findNodeByTag(Tag tag) const;
+
+  /*
+   * Returns the first descendant (in depth-first pre-order) of the indexed
+   * root node `rootShadowNode` with the given `nativeId`, or `nullptr` if
+   * there is none. Duplicated `nativeId`s are resolved by searching the tree.
+   */
+  std::shared_ptr<const ShadowNode> findNodeByNativeId(const ShadowNode &rootShadowNode, const std::string &nativeId) const;
+
+ private:
+  std::unordered_map<Tag, std::shared_ptr<const ShadowNode>> nodesByTag_;
+  std::unordered_map<std::string, std::vector<Tag>> tagsByNativeId_;
+};
+
+} // namespace facebook::react
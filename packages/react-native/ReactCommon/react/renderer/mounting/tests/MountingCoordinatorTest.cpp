@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
+
+namespace facebook::react {
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  }
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {}
+};
+
+} // namespace
+
+class MountingCoordinatorTest : public ::testing::Test {
+ protected:
+  MountingCoordinatorTest()
+      : builder_(simpleComponentBuilder()),
+        shadowTree_(
+            SurfaceId{11},
+            LayoutConstraints{},
+            LayoutContext{},
+            shadowTreeDelegate_,
+            contextContainer_),
+        mountingCoordinator_(shadowTree_.getMountingCoordinator()) {
+    mountingCoordinator_->setDiffExecutor(
+        [this](std::function<void()>&& task) {
+          tasks_.push_back(std::move(task));
+        });
+  }
+
+  void commit(int numberOfChildren) {
+    auto children = std::make_shared<ShadowNode::ListOfShared>();
+    for (int i = 0; i < numberOfChildren; i++) {
+      children->push_back(builder_.build(Element<ViewShadowNode>().tag(i + 2)));
+    }
+
+    // The new root must belong to the family of the root of the tree.
+    shadowTree_.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return std::static_pointer_cast<RootShadowNode>(
+              oldRootShadowNode.ShadowNode::clone({.children = children}));
+        },
+        {});
+  }
+
+  void runTasks() {
+    auto tasks = std::move(tasks_);
+    tasks_.clear();
+    for (auto& task : tasks) {
+      task();
+    }
+  }
+
+  size_t expectedNumberOfMutations(const ShadowTreeRevision& baseRevision) {
+    return calculateShadowViewMutations(
+               *baseRevision.rootShadowNode,
+               *shadowTree_.getCurrentRevision().rootShadowNode)
+        .size();
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  DummyShadowTreeDelegate shadowTreeDelegate_{};
+  ShadowTree shadowTree_;
+  std::shared_ptr<const MountingCoordinator> mountingCoordinator_;
+  std::vector<std::function<void()>> tasks_;
+};
+
+TEST_F(MountingCoordinatorTest, diffsPushedRevisionAhead) {
+  auto baseRevision = mountingCoordinator_->getBaseRevision();
+
+  commit(1);
+  EXPECT_EQ(tasks_.size(), 1);
+  runTasks();
+
+  auto transaction = mountingCoordinator_->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_TRUE(transaction->getTelemetry().isDiffedAhead());
+  EXPECT_EQ(transaction->getTelemetry().getNumberOfCoalescedRevisions(), 0);
+  EXPECT_EQ(
+      transaction->getMutations().size(),
+      expectedNumberOfMutations(baseRevision));
+  EXPECT_FALSE(mountingCoordinator_->pullTransaction().has_value());
+}
+
+TEST_F(MountingCoordinatorTest, coalescesSupersededRevisions) {
+  auto baseRevision = mountingCoordinator_->getBaseRevision();
+
+  commit(1);
+  commit(3);
+  commit(2);
+  // The scheduled calculation diffs only the last revision.
+  EXPECT_EQ(tasks_.size(), 1);
+  runTasks();
+
+  auto transaction = mountingCoordinator_->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_TRUE(transaction->getTelemetry().isDiffedAhead());
+  EXPECT_EQ(transaction->getTelemetry().getNumberOfCoalescedRevisions(), 2);
+  EXPECT_EQ(
+      transaction->getMutations().size(),
+      expectedNumberOfMutations(baseRevision));
+}
+
+TEST_F(MountingCoordinatorTest, diffsOnPullIfCalculationDidNotRun) {
+  auto baseRevision = mountingCoordinator_->getBaseRevision();
+
+  commit(1);
+  auto transaction = mountingCoordinator_->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_FALSE(transaction->getTelemetry().isDiffedAhead());
+  EXPECT_EQ(
+      transaction->getMutations().size(),
+      expectedNumberOfMutations(baseRevision));
+
+  // The outdated calculation has nothing to do.
+  runTasks();
+  EXPECT_FALSE(mountingCoordinator_->pullTransaction().has_value());
+
+  baseRevision = mountingCoordinator_->getBaseRevision();
+  commit(2);
+  EXPECT_EQ(tasks_.size(), 1);
+  runTasks();
+
+  transaction = mountingCoordinator_->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_TRUE(transaction->getTelemetry().isDiffedAhead());
+  EXPECT_EQ(
+      transaction->getMutations().size(),
+      expectedNumberOfMutations(baseRevision));
+}
+
+TEST_F(MountingCoordinatorTest, aggregatesDiffAheadTelemetryPerSurface) {
+  auto noop = [](const MountingTransaction& /*transaction*/,
+                 const SurfaceTelemetry& /*surfaceTelemetry*/) {};
+  auto surfaceTelemetry = SurfaceTelemetry{};
+  auto didMount = [&](const MountingTransaction& /*transaction*/,
+                      const SurfaceTelemetry& compoundTelemetry) {
+    surfaceTelemetry = compoundTelemetry;
+  };
+  auto& telemetryController = mountingCoordinator_->getTelemetryController();
+
+  commit(1);
+  commit(2);
+  runTasks();
+  EXPECT_TRUE(telemetryController.pullTransaction(noop, noop, didMount));
+
+  commit(3);
+  EXPECT_TRUE(telemetryController.pullTransaction(noop, noop, didMount));
+
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTransactions(), 2);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTransactionsDiffedAhead(), 1);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfCoalescedRevisions(), 1);
+}
+
+} // namespace facebook::react
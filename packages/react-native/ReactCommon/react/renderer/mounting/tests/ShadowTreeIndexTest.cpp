@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/ShadowTreeIndex.h>
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+namespace {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  }
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {}
+};
+
+std::function<std::shared_ptr<const ViewShadowNodeProps>()>
+viewPropsWithNativeId(const std::string& nativeId) {
+  return [nativeId] {
+    auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+    sharedProps->nativeId = nativeId;
+    return sharedProps;
+  };
+}
+
+std::shared_ptr<ShadowNode> cloneWithChildren(
+    const ShadowNode& shadowNode,
+    std::vector<std::shared_ptr<const ShadowNode>> children) {
+  return shadowNode.clone(
+      {.children = std::make_shared<
+           const std::vector<std::shared_ptr<const ShadowNode>>>(
+           std::move(children))});
+}
+
+void expectIndexDescribesTree(
+    const ShadowTreeIndex& index,
+    const ShadowNode& shadowNode) {
+  for (const auto& childNode : shadowNode.getChildren()) {
+    EXPECT_EQ(index.findNodeByTag(childNode->getTag()), childNode);
+    expectIndexDescribesTree(index, *childNode);
+  }
+}
+
+} // namespace
+
+TEST(ShadowTreeIndexTest, indexIsUpdatedIncrementally) {
+  auto builder = simpleComponentBuilder();
+
+  auto rootShadowNode = std::shared_ptr<RootShadowNode>{};
+  auto viewShadowNodeA = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeAA = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeB = std::shared_ptr<ViewShadowNode>{};
+  auto viewShadowNodeC = std::shared_ptr<ViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode)
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .reference(viewShadowNodeA)
+            .tag(2)
+            .children({
+              Element<ViewShadowNode>()
+                .reference(viewShadowNodeAA)
+                .tag(3)
+                .props(viewPropsWithNativeId("duplicate"))
+            }),
+          Element<ViewShadowNode>()
+            .reference(viewShadowNodeB)
+            .tag(4)
+            .props(viewPropsWithNativeId("duplicate")),
+          Element<ViewShadowNode>()
+            .reference(viewShadowNodeC)
+            .tag(5)
+            .props(viewPropsWithNativeId("unique"))
+        });
+  // clang-format on
+
+  builder.build(element);
+
+  auto emptyRootShadowNode = cloneWithChildren(*rootShadowNode, {});
+
+  auto index = ShadowTreeIndex{};
+  index.update(*emptyRootShadowNode, *rootShadowNode);
+
+  expectIndexDescribesTree(index, *rootShadowNode);
+  EXPECT_EQ(index.findNodeByTag(1), nullptr);
+  EXPECT_EQ(index.findNodeByTag(42), nullptr);
+
+  // Duplicates resolve to the first node in depth-first pre-order.
+  EXPECT_EQ(
+      index.findNodeByNativeId(*rootShadowNode, "duplicate"), viewShadowNodeAA);
+  EXPECT_EQ(
+      index.findNodeByNativeId(*rootShadowNode, "unique"), viewShadowNodeC);
+  EXPECT_EQ(index.findNodeByNativeId(*rootShadowNode, "missing"), nullptr);
+
+  // Reorders the children, removes one of them and changes the `nativeId` of
+  // another one. Reordered nodes are removed from and inserted into the tree
+  // by the same update.
+  auto newViewShadowNodeA = viewShadowNodeA->clone({});
+  auto newViewShadowNodeC = viewShadowNodeC->clone(
+      {.props = viewPropsWithNativeId("renamed")()});
+  auto newRootShadowNode = cloneWithChildren(
+      *rootShadowNode, {newViewShadowNodeC, newViewShadowNodeA});
+
+  index.update(*rootShadowNode, *newRootShadowNode);
+
+  expectIndexDescribesTree(index, *newRootShadowNode);
+  EXPECT_EQ(index.findNodeByTag(2), newViewShadowNodeA);
+  EXPECT_EQ(index.findNodeByTag(3), viewShadowNodeAA);
+  EXPECT_EQ(index.findNodeByTag(4), nullptr);
+  EXPECT_EQ(index.findNodeByTag(5), newViewShadowNodeC);
+
+  EXPECT_EQ(
+      index.findNodeByNativeId(*newRootShadowNode, "duplicate"),
+      viewShadowNodeAA);
+  EXPECT_EQ(index.findNodeByNativeId(*newRootShadowNode, "unique"), nullptr);
+  EXPECT_EQ(
+      index.findNodeByNativeId(*newRootShadowNode, "renamed"),
+      newViewShadowNodeC);
+
+  // Committing an empty tree empties the index.
+  index.update(*newRootShadowNode, *emptyRootShadowNode);
+
+  for (Tag tag = 1; tag <= 5; tag++) {
+    EXPECT_EQ(index.findNodeByTag(tag), nullptr);
+  }
+  EXPECT_EQ(
+      index.findNodeByNativeId(*emptyRootShadowNode, "duplicate"), nullptr);
+  EXPECT_EQ(
+      index.findNodeByNativeId(*emptyRootShadowNode, "renamed"), nullptr);
+}
+
+TEST(ShadowTreeIndexTest, shadowTreeIndexesCurrentRevision) {
+  auto builder = simpleComponentBuilder();
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .props(viewPropsWithNativeId("view"))
+        });
+  // clang-format on
+
+  auto rootShadowNode = builder.build(element);
+
+  ContextContainer contextContainer{};
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{1},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  auto initialRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  EXPECT_EQ(shadowTree.findNodeByTag(2), nullptr);
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(
+            rootShadowNode->ShadowNode::clone({}));
+      },
+      {});
+
+  // Layout clones the view, so the committed node is a different one.
+  auto currentRootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+  auto committedViewShadowNode = currentRootShadowNode->getChildren().front();
+  EXPECT_EQ(committedViewShadowNode->getTag(), 2);
+  EXPECT_EQ(shadowTree.findNodeByTag(2), committedViewShadowNode);
+  EXPECT_EQ(
+      shadowTree.findNodeByNativeId(*currentRootShadowNode, "view"),
+      committedViewShadowNode);
+  EXPECT_EQ(
+      shadowTree.findNodeByNativeId(*currentRootShadowNode, "missing"),
+      nullptr);
+
+  // The index can't answer lookups in other revisions.
+  EXPECT_EQ(
+      shadowTree.findNodeByNativeId(*initialRootShadowNode, "view"),
+      std::nullopt);
+
+  shadowTree.commitEmptyTree();
+
+  EXPECT_EQ(shadowTree.findNodeByTag(2), nullptr);
+}
+
+TEST(ShadowTreeIndexTest, indexDescribesRandomlyAlteredTrees) {
+  auto entropy = Entropy();
+
+  auto contextContainer = std::make_shared<ContextContainer>();
+  auto componentDescriptorParameters = ComponentDescriptorParameters{
+      .eventDispatcher = EventDispatcher::Shared{},
+      .contextContainer = contextContainer,
+      .flavor = nullptr};
+  auto viewComponentDescriptor =
+      ViewComponentDescriptor(componentDescriptorParameters);
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(componentDescriptorParameters);
+
+  for (int i = 0; i < 16; i++) {
+    auto family = rootComponentDescriptor.createFamily(
+        {.tag = Tag(1), .surfaceId = SurfaceId(1), .instanceHandle = nullptr});
+    auto emptyRootNode = std::static_pointer_cast<const RootShadowNode>(
+        rootComponentDescriptor.createShadowNode(
+            ShadowNodeFragment{.props = RootShadowNode::defaultSharedProps()},
+            family));
+
+    auto currentRootNode = std::static_pointer_cast<const RootShadowNode>(
+        cloneWithChildren(
+            *emptyRootNode,
+            {generateShadowNodeTree(entropy, viewComponentDescriptor, 256)}));
+
+    auto index = ShadowTreeIndex{};
+    index.update(*emptyRootNode, *currentRootNode);
+    expectIndexDescribesTree(index, *currentRootNode);
+
+    for (int j = 0; j < 16; j++) {
+      auto nextRootNode = currentRootNode;
+      alterShadowTree(
+          entropy,
+          nextRootNode,
+          {
+              &messWithChildren,
+              &messWithYogaStyles,
+              &messWithLayoutableOnlyFlag,
+          });
+
+      index.update(*currentRootNode, *nextRootNode);
+      expectIndexDescribesTree(index, *nextRootNode);
+
+      currentRootNode = nextRootNode;
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -26,6 +26,23 @@
 
 namespace facebook::react {
 
+static bool areMutationListsEqual(
+    const ShadowViewMutation::List& lhs,
+    const ShadowViewMutation::List& rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); i++) {
+    if (lhs[i].type != rhs[i].type || lhs[i].parentTag != rhs[i].parentTag ||
+        lhs[i].index != rhs[i].index ||
+        lhs[i].oldChildShadowView != rhs[i].oldChildShadowView ||
+        lhs[i].newChildShadowView != rhs[i].newChildShadowView) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static void testShadowNodeTreeLifeCycle(
     uint_fast32_t seed,
     int treeSize,
@@ -119,6 +136,15 @@ static void testShadowNodeTreeLifeCycle(
       auto mutations =
           calculateShadowViewMutations(*currentRootNode, *nextRootNode);
 
+      // Incremental diffing must produce exactly the same mutations as the
+      // full diff.
+      EXPECT_TRUE(areMutationListsEqual(
+          mutations,
+          calculateShadowViewMutations(
+              *currentRootNode,
+              *nextRootNode,
+              /* allowIncrementalDiffing */ false)));
+
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
       {
@@ -278,6 +304,15 @@ static void testShadowNodeTreeLifeCycleExtensiveFlatteningUnflattening(
       auto mutations =
           calculateShadowViewMutations(*currentRootNode, *nextRootNode);
 
+      // Incremental diffing must produce exactly the same mutations as the
+      // full diff.
+      EXPECT_TRUE(areMutationListsEqual(
+          mutations,
+          calculateShadowViewMutations(
+              *currentRootNode,
+              *nextRootNode,
+              /* allowIncrementalDiffing */ false)));
+
       // Make sure that in a single frame, a DELETE for a
       // view is not followed by a CREATE for the same view.
       {
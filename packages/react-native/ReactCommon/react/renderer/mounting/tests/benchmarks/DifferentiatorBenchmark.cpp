@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/utils/ContextContainer.h>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+auto componentDescriptorParameters = ComponentDescriptorParameters{
+    .eventDispatcher = eventDispatcher,
+    .contextContainer = contextContainer};
+auto viewComponentDescriptor =
+    ViewComponentDescriptor{componentDescriptorParameters};
+auto rootComponentDescriptor =
+    RootComponentDescriptor{componentDescriptorParameters};
+
+static Props::Shared viewPropsFromDynamic(const folly::dynamic& dynamic) {
+  ContextContainer contextContainer{};
+  PropsParserContext parserContext{-1, contextContainer};
+  return viewComponentDescriptor.cloneProps(
+      parserContext, nullptr, RawProps{dynamic});
+}
+
+static std::shared_ptr<const ShadowNode> createViewShadowNode(
+    Tag tag,
+    const Props::Shared& props,
+    std::vector<std::shared_ptr<const ShadowNode>> children = {}) {
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          .props = props,
+          .children = std::make_shared<
+              const std::vector<std::shared_ptr<const ShadowNode>>>(
+              std::move(children))},
+      viewComponentDescriptor.createFamily(
+          {.tag = tag, .surfaceId = 1, .instanceHandle = nullptr}));
+}
+
+/*
+ * Builds a list-like tree: the root contains a container with `rowCount`
+ * rows, each row consists of a flattened wrapper and two concrete leaves.
+ * Returns the root and the deepest leaf of the middle row.
+ */
+static std::pair<std::shared_ptr<const ShadowNode>, const ShadowNodeFamily*>
+buildListTree(int rowCount) {
+  auto concreteProps =
+      viewPropsFromDynamic(folly::dynamic::object("collapsable", false));
+  auto flattenedProps = viewPropsFromDynamic(folly::dynamic::object());
+
+  Tag tag = 2;
+  const ShadowNodeFamily* leafFamily = nullptr;
+  auto rows = std::vector<std::shared_ptr<const ShadowNode>>{};
+  rows.reserve(rowCount);
+  for (int i = 0; i < rowCount; i++) {
+    auto leaf = createViewShadowNode(tag++, concreteProps);
+    if (i == rowCount / 2) {
+      leafFamily = &leaf->getFamily();
+    }
+    auto wrapper = createViewShadowNode(tag++, flattenedProps, {leaf});
+    rows.push_back(createViewShadowNode(
+        tag++,
+        concreteProps,
+        {wrapper, createViewShadowNode(tag++, concreteProps)}));
+  }
+
+  auto container = createViewShadowNode(tag++, concreteProps, std::move(rows));
+  auto root = rootComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          .props = RootShadowNode::defaultSharedProps(),
+          .children = std::make_shared<
+              const std::vector<std::shared_ptr<const ShadowNode>>>(
+              std::vector<std::shared_ptr<const ShadowNode>>{container})},
+      rootComponentDescriptor.createFamily(
+          {.tag = 1, .surfaceId = 1, .instanceHandle = nullptr}));
+  return {root, leafFamily};
+}
+
+static void diffSingleLeafUpdate(
+    benchmark::State& state,
+    bool allowIncrementalDiffing) {
+  auto [oldRoot, leafFamily] = buildListTree(static_cast<int>(state.range(0)));
+  auto updatedProps = viewPropsFromDynamic(
+      folly::dynamic::object("collapsable", false)("nativeID", "updated"));
+  auto newRoot = oldRoot->cloneTree(
+      *leafFamily, [&](const ShadowNode& oldShadowNode) {
+        return oldShadowNode.clone({.props = updatedProps});
+      });
+
+  // Both modes must agree before their speed is worth comparing.
+  auto incrementalMutations =
+      calculateShadowViewMutations(*oldRoot, *newRoot, true);
+  auto fullMutations = calculateShadowViewMutations(*oldRoot, *newRoot, false);
+  if (incrementalMutations.size() != fullMutations.size() ||
+      incrementalMutations.size() != 1) {
+    state.SkipWithError("Mutation lists differ between diffing modes");
+    return;
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(calculateShadowViewMutations(
+        *oldRoot, *newRoot, allowIncrementalDiffing));
+  }
+}
+
+static void diffSingleLeafUpdateFull(benchmark::State& state) {
+  diffSingleLeafUpdate(state, false);
+}
+BENCHMARK(diffSingleLeafUpdateFull)->Arg(100)->Arg(1000)->Arg(5000);
+
+static void diffSingleLeafUpdateIncremental(benchmark::State& state) {
+  diffSingleLeafUpdate(state, true);
+}
+BENCHMARK(diffSingleLeafUpdateIncremental)->Arg(100)->Arg(1000)->Arg(5000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
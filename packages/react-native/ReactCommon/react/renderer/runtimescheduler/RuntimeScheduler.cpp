@@ -133,4 +133,10 @@ void RuntimeScheduler::setIntersectionObserverDelegate(
       intersectionObserverDelegate);
 }
 
+void RuntimeScheduler::setFrameDeadline(
+    HighResTimeStamp frameDeadline,
+    HighResDuration frameInterval) noexcept {
+  return runtimeSchedulerImpl_->setFrameDeadline(frameDeadline, frameInterval);
+}
+
 } // namespace facebook::react
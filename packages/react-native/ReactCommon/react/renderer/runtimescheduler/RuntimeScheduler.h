@@ -51,6 +51,7 @@ class RuntimeSchedulerBase {
   virtual void setEventTimingDelegate(RuntimeSchedulerEventTimingDelegate *eventTimingDelegate) = 0;
   virtual void setIntersectionObserverDelegate(
       RuntimeSchedulerIntersectionObserverDelegate *intersectionObserverDelegate) = 0;
+  virtual void setFrameDeadline(HighResTimeStamp frameDeadline, HighResDuration frameInterval) noexcept = 0;
 };
 
 // This is a proxy for RuntimeScheduler implementation, which will be selected
@@ -156,6 +157,19 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
   void setIntersectionObserverDelegate(
       RuntimeSchedulerIntersectionObserverDelegate *intersectionObserverDelegate) override;
 
+  /*
+   * Informs the scheduler about the deadline of the frame being produced by
+   * the host platform (e.g. the next vsync) and the interval between frames.
+   * While a frame interval is set, tasks are asked to yield (by
+   * `getShouldYield`) once the deadline of the frame they started in has
+   * passed, and tasks which don't yield for a whole frame are reported as long
+   * tasks. A zero interval disables the frame budget (the default).
+   * Ignored unless the `enableFrameDeadlineScheduling` feature flag is on.
+   *
+   * Can be called from any thread.
+   */
+  void setFrameDeadline(HighResTimeStamp frameDeadline, HighResDuration frameInterval) noexcept override;
+
  private:
   // Actual implementation, stored as a unique pointer to simplify memory
   // management.
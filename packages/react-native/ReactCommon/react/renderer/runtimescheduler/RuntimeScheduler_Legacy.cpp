@@ -211,6 +211,12 @@ void RuntimeScheduler_Legacy::setIntersectionObserverDelegate(
   // No-op in the legacy scheduler
 }
 
+void RuntimeScheduler_Legacy::setFrameDeadline(
+    HighResTimeStamp /*frameDeadline*/,
+    HighResDuration /*frameInterval*/) noexcept {
+  // No-op in the legacy scheduler
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Legacy::scheduleWorkLoopIfNecessary() {
@@ -126,6 +126,8 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
   void setIntersectionObserverDelegate(
       RuntimeSchedulerIntersectionObserverDelegate *intersectionObserverDelegate) override;
 
+  void setFrameDeadline(HighResTimeStamp frameDeadline, HighResDuration frameInterval) noexcept override;
+
  private:
   std::priority_queue<std::shared_ptr<Task>, std::vector<std::shared_ptr<Task>>, TaskPriorityComparer> taskQueue_;
 
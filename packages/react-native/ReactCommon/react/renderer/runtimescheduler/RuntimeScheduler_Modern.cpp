@@ -40,7 +40,9 @@ RuntimeScheduler_Modern::RuntimeScheduler_Modern(
     RuntimeSchedulerTaskErrorHandler onTaskError)
     : runtimeExecutor_(std::move(runtimeExecutor)),
       now_(std::move(now)),
-      onTaskError_(std::move(onTaskError)) {}
+      onTaskError_(std::move(onTaskError)),
+      frameDeadlinesEnabled_(
+          ReactNativeFeatureFlags::enableFrameDeadlineScheduling()) {}
 
 void RuntimeScheduler_Modern::scheduleWork(RawCallback&& callback) noexcept {
   TraceSection s("RuntimeScheduler::scheduleWork");
@@ -51,8 +53,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
     SchedulerPriority priority,
     jsi::Function&& callback) noexcept {
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = makePooledTask(priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
@@ -63,8 +64,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
     SchedulerPriority priority,
     RawCallback&& callback) noexcept {
   auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
-  auto task =
-      std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  auto task = makePooledTask(priority, std::move(callback), expirationTime);
 
   scheduleTask(task);
 
@@ -83,7 +83,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
 
   auto timeout = getResolvedTimeoutForIdleTask(customTimeout);
   auto expirationTime = now_() + timeout;
-  auto task = std::make_shared<Task>(
+  auto task = makePooledTask(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
 
   scheduleTask(task);
@@ -102,7 +102,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
       "RawCallback");
 
   auto expirationTime = now_() + getResolvedTimeoutForIdleTask(customTimeout);
-  auto task = std::make_shared<Task>(
+  auto task = makePooledTask(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
 
   scheduleTask(task);
@@ -111,7 +111,13 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
 }
 
 bool RuntimeScheduler_Modern::getShouldYield() noexcept {
-  markYieldingOpportunity(now_());
+  auto currentTime = now_();
+  markYieldingOpportunity(currentTime);
+
+  if (frameDeadlinesEnabled_ &&
+      currentTime >= currentTaskFrameDeadline_.load()) {
+    return true;
+  }
 
   std::shared_lock lock(schedulingMutex_);
 
@@ -121,6 +127,13 @@ bool RuntimeScheduler_Modern::getShouldYield() noexcept {
 
 void RuntimeScheduler_Modern::cancelTask(Task& task) noexcept {
   task.callback.reset();
+
+  // The task being executed stays in the queue, it is removed by `selectTask`
+  // unless it provides a continuation.
+  std::unique_lock lock(schedulingMutex_);
+  if (&task != currentTask_) {
+    taskQueue_.remove(task);
+  }
 }
 
 SchedulerPriority RuntimeScheduler_Modern::getCurrentPriorityLevel()
@@ -215,6 +228,17 @@ void RuntimeScheduler_Modern::setIntersectionObserverDelegate(
   intersectionObserverDelegate_ = intersectionObserverDelegate;
 }
 
+void RuntimeScheduler_Modern::setFrameDeadline(
+    HighResTimeStamp frameDeadline,
+    HighResDuration frameInterval) noexcept {
+  if (!frameDeadlinesEnabled_) {
+    return;
+  }
+
+  std::lock_guard lock(frameTimingMutex_);
+  frameTiming_ = {.deadline = frameDeadline, .interval = frameInterval};
+}
+
 #pragma mark - Private
 
 void RuntimeScheduler_Modern::scheduleTask(std::shared_ptr<Task> task) {
@@ -307,6 +331,9 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   auto taskStartTime = now_();
   lastYieldingOpportunity_ = taskStartTime;
   longestPeriodWithoutYieldingOpportunity_ = HighResDuration::zero();
+  if (frameDeadlinesEnabled_) {
+    currentTaskFrameDeadline_ = getFrameDeadlineForTask(taskStartTime);
+  }
 
   auto didUserCallbackTimeout = task.expirationTime <= taskStartTime;
   executeTask(runtime, task, didUserCallbackTimeout);
@@ -318,6 +345,10 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   markYieldingOpportunity(taskEndTime);
   reportLongTasks(task, taskStartTime, taskEndTime);
 
+  if (frameDeadlinesEnabled_) {
+    currentTaskFrameDeadline_ = HighResTimeStamp::max();
+  }
+
   // "Update the rendering" step.
   updateRendering(taskEndTime);
 
@@ -442,13 +473,50 @@ void RuntimeScheduler_Modern::reportLongTasks(
     return;
   }
 
-  if (longestPeriodWithoutYieldingOpportunity_ >=
-      LONG_TASK_DURATION_THRESHOLD) {
+  // With a frame budget, not yielding for a whole frame means that the frame
+  // has been missed.
+  auto threshold = LONG_TASK_DURATION_THRESHOLD;
+  if (frameDeadlinesEnabled_) {
+    auto frameInterval = getFrameTiming().interval;
+    if (frameInterval > HighResDuration::zero() && frameInterval < threshold) {
+      threshold = frameInterval;
+    }
+  }
+
+  if (longestPeriodWithoutYieldingOpportunity_ >= threshold) {
     auto duration = endTime - startTime;
     reporter->reportLongTask(startTime, duration);
   }
 }
 
+RuntimeScheduler_Modern::FrameTiming RuntimeScheduler_Modern::getFrameTiming()
+    const {
+  std::lock_guard lock(frameTimingMutex_);
+  return frameTiming_;
+}
+
+HighResTimeStamp RuntimeScheduler_Modern::getFrameDeadlineForTask(
+    HighResTimeStamp taskStartTime) const {
+  auto [frameDeadline, frameInterval] = getFrameTiming();
+  if (frameInterval <= HighResDuration::zero()) {
+    return HighResTimeStamp::max();
+  }
+
+  if (frameDeadline > taskStartTime) {
+    return frameDeadline;
+  }
+
+  // The host platform hasn't reported the current frame (yet), assuming that
+  // frames keep coming at the same interval.
+  auto frameIntervalNanoseconds = frameInterval.toNanoseconds();
+  auto elapsedFrames = (taskStartTime - frameDeadline).toNanoseconds() /
+          frameIntervalNanoseconds +
+      1;
+  return frameDeadline +
+      HighResDuration::fromNanoseconds(
+          elapsedFrames * frameIntervalNanoseconds);
+}
+
 void RuntimeScheduler_Modern::markYieldingOpportunity(
     HighResTimeStamp currentTime) {
   auto currentPeriod = currentTime - lastYieldingOpportunity_;
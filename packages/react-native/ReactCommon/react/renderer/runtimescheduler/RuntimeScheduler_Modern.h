@@ -11,8 +11,10 @@
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/Task.h>
+#include <react/renderer/runtimescheduler/TaskPriorityQueue.h>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 
@@ -143,10 +145,41 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void setIntersectionObserverDelegate(
       RuntimeSchedulerIntersectionObserverDelegate *intersectionObserverDelegate) override;
 
+  /*
+   * Sets the frame budget tasks are given to run before `getShouldYield`
+   * returns true. See `RuntimeScheduler::setFrameDeadline`.
+   */
+  void setFrameDeadline(HighResTimeStamp frameDeadline, HighResDuration frameInterval) noexcept override;
+
  private:
   std::atomic<uint_fast8_t> syncTaskRequests_{0};
 
-  std::priority_queue<std::shared_ptr<Task>, std::vector<std::shared_ptr<Task>>, TaskPriorityComparer> taskQueue_;
+  /*
+   * The latest frame deadline and frame interval reported by the host
+   * platform. A zero interval means that the frame budget is disabled.
+   */
+  struct FrameTiming {
+    HighResTimeStamp deadline{HighResTimeStamp::max()};
+    HighResDuration interval{HighResDuration::zero()};
+  };
+
+  /*
+   * The deadline and the interval are published together, so readers never
+   * combine the deadline of a frame with the interval of another one.
+   */
+  FrameTiming getFrameTiming() const;
+
+  FrameTiming frameTiming_;
+  mutable std::mutex frameTimingMutex_;
+
+  /*
+   * The deadline of the frame the task being executed started in.
+   */
+  std::atomic<HighResTimeStamp> currentTaskFrameDeadline_{HighResTimeStamp::max()};
+
+  HighResTimeStamp getFrameDeadlineForTask(HighResTimeStamp taskStartTime) const;
+
+  TaskPriorityQueue taskQueue_;
 
   Task *currentTask_{};
   HighResTimeStamp lastYieldingOpportunity_;
@@ -211,6 +244,12 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   RuntimeSchedulerIntersectionObserverDelegate *intersectionObserverDelegate_{nullptr};
 
   RuntimeSchedulerTaskErrorHandler onTaskError_;
+
+  /*
+   * Whether frame deadlines reported by the host platform are used (see
+   * `enableFrameDeadlineScheduling`). Otherwise `setFrameDeadline` is a no-op.
+   */
+  const bool frameDeadlinesEnabled_;
 };
 
 } // namespace facebook::react
@@ -7,6 +7,9 @@
 
 #include "Task.h"
 #include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
 
 namespace facebook::react {
 
@@ -17,6 +20,87 @@ inline uint64_t getNextId() noexcept {
   return nextId++;
 }
 
+/*
+ * Free list of memory blocks big enough for a task together with the control
+ * block of its `std::shared_ptr`. Tasks are created and destroyed on
+ * different threads, hence the mutex.
+ */
+class TaskPool {
+ public:
+  static constexpr size_t kBlockSize = 192;
+  static constexpr size_t kMaxFreeBlockCount = 1024;
+
+  static TaskPool& shared() {
+    // Leaked intentionally: tasks may outlive static destructors.
+    static auto* pool = new TaskPool();
+    return *pool;
+  }
+
+  void* allocate() {
+    {
+      std::lock_guard lock(mutex_);
+      if (!freeBlocks_.empty()) {
+        auto* block = freeBlocks_.back();
+        freeBlocks_.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(kBlockSize);
+  }
+
+  void deallocate(void* block) {
+    {
+      std::lock_guard lock(mutex_);
+      if (freeBlocks_.size() < kMaxFreeBlockCount) {
+        freeBlocks_.push_back(block);
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<void*> freeBlocks_;
+};
+
+template <typename T>
+struct TaskPoolAllocator {
+  using value_type = T;
+
+  static constexpr bool kFitsInBlock = sizeof(T) <= TaskPool::kBlockSize &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  TaskPoolAllocator() = default;
+
+  template <typename U>
+  TaskPoolAllocator(const TaskPoolAllocator<U>& /*other*/) {}
+
+  T* allocate(size_t count) {
+    if constexpr (kFitsInBlock) {
+      if (count == 1) {
+        return static_cast<T*>(TaskPool::shared().allocate());
+      }
+    }
+    return std::allocator<T>{}.allocate(count);
+  }
+
+  void deallocate(T* pointer, size_t count) {
+    if constexpr (kFitsInBlock) {
+      if (count == 1) {
+        TaskPool::shared().deallocate(pointer);
+        return;
+      }
+    }
+    std::allocator<T>{}.deallocate(pointer, count);
+  }
+
+  template <typename U>
+  bool operator==(const TaskPoolAllocator<U>& /*other*/) const {
+    return true;
+  }
+};
+
 } // namespace
 
 Task::Task(
@@ -37,6 +121,22 @@ Task::Task(
       expirationTime(expirationTime),
       id(getNextId()) {}
 
+std::shared_ptr<Task> makePooledTask(
+    SchedulerPriority priority,
+    jsi::Function&& callback,
+    HighResTimeStamp expirationTime) {
+  return std::allocate_shared<Task>(
+      TaskPoolAllocator<Task>{}, priority, std::move(callback), expirationTime);
+}
+
+std::shared_ptr<Task> makePooledTask(
+    SchedulerPriority priority,
+    RawCallback&& callback,
+    HighResTimeStamp expirationTime) {
+  return std::allocate_shared<Task>(
+      TaskPoolAllocator<Task>{}, priority, std::move(callback), expirationTime);
+}
+
 jsi::Value Task::execute(jsi::Runtime& runtime, bool didUserCallbackTimeout) {
   auto result = jsi::Value::undefined();
   // Canceled task doesn't have a callback.
@@ -12,6 +12,7 @@
 #include <react/timing/primitives.h>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <variant>
 
@@ -20,6 +21,7 @@ namespace facebook::react {
 class RuntimeScheduler_Legacy;
 class RuntimeScheduler_Modern;
 class TaskPriorityComparer;
+class TaskPriorityQueue;
 
 using RawCallback = std::function<void(jsi::Runtime &)>;
 
@@ -32,15 +34,30 @@ struct Task final : public jsi::NativeState {
   friend RuntimeScheduler_Legacy;
   friend RuntimeScheduler_Modern;
   friend TaskPriorityComparer;
+  friend TaskPriorityQueue;
+
+  static constexpr size_t kNotInQueue = SIZE_MAX;
 
   SchedulerPriority priority;
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   HighResTimeStamp expirationTime;
   uint64_t id;
+  // Position of the task in the `TaskPriorityQueue` it belongs to.
+  size_t heapIndex{kNotInQueue};
 
   jsi::Value execute(jsi::Runtime &runtime, bool didUserCallbackTimeout);
 };
 
+/*
+ * Create tasks in memory which is reused across tasks, sparing a heap
+ * allocation for every scheduled task.
+ */
+std::shared_ptr<Task>
+makePooledTask(SchedulerPriority priority, jsi::Function &&callback, HighResTimeStamp expirationTime);
+
+std::shared_ptr<Task>
+makePooledTask(SchedulerPriority priority, RawCallback &&callback, HighResTimeStamp expirationTime);
+
 class TaskPriorityComparer {
  public:
   inline bool operator()(const std::shared_ptr<Task> &lhs, const std::shared_ptr<Task> &rhs)
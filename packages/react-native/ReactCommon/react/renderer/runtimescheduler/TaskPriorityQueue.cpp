@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TaskPriorityQueue.h"
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+void TaskPriorityQueue::push(std::shared_ptr<Task> task) {
+  react_native_assert(
+      task->heapIndex == Task::kNotInQueue &&
+      "The task is already in a queue.");
+
+  heap_.push_back(nullptr);
+  place(heap_.size() - 1, std::move(task));
+  siftUp(heap_.size() - 1);
+}
+
+void TaskPriorityQueue::pop() {
+  removeAt(0);
+}
+
+bool TaskPriorityQueue::remove(Task& task) {
+  auto index = task.heapIndex;
+  if (index >= heap_.size() || heap_[index].get() != &task) {
+    return false;
+  }
+
+  removeAt(index);
+  return true;
+}
+
+bool TaskPriorityQueue::precedes(const Task& lhs, const Task& rhs) {
+  if (lhs.expirationTime != rhs.expirationTime) {
+    return lhs.expirationTime < rhs.expirationTime;
+  }
+  return lhs.id < rhs.id;
+}
+
+void TaskPriorityQueue::removeAt(size_t index) {
+  heap_[index]->heapIndex = Task::kNotInQueue;
+
+  auto last = std::move(heap_.back());
+  heap_.pop_back();
+  if (index == heap_.size()) {
+    return;
+  }
+
+  // Moving the last task into the gap, and restoring the heap property in
+  // whichever direction it is violated.
+  auto movesUp = index > 0 && precedes(*last, *heap_[(index - 1) / kArity]);
+  place(index, std::move(last));
+  if (movesUp) {
+    siftUp(index);
+  } else {
+    siftDown(index);
+  }
+}
+
+void TaskPriorityQueue::siftUp(size_t index) {
+  auto task = std::move(heap_[index]);
+  while (index > 0) {
+    auto parentIndex = (index - 1) / kArity;
+    if (!precedes(*task, *heap_[parentIndex])) {
+      break;
+    }
+    place(index, std::move(heap_[parentIndex]));
+    index = parentIndex;
+  }
+  place(index, std::move(task));
+}
+
+void TaskPriorityQueue::siftDown(size_t index) {
+  auto task = std::move(heap_[index]);
+  auto size = heap_.size();
+  while (true) {
+    auto firstChildIndex = index * kArity + 1;
+    if (firstChildIndex >= size) {
+      break;
+    }
+
+    auto minChildIndex = firstChildIndex;
+    auto lastChildIndex = std::min(firstChildIndex + kArity, size);
+    for (auto childIndex = firstChildIndex + 1; childIndex < lastChildIndex;
+         childIndex++) {
+      if (precedes(*heap_[childIndex], *heap_[minChildIndex])) {
+        minChildIndex = childIndex;
+      }
+    }
+
+    if (!precedes(*heap_[minChildIndex], *task)) {
+      break;
+    }
+    place(index, std::move(heap_[minChildIndex]));
+    index = minChildIndex;
+  }
+  place(index, std::move(task));
+}
+
+void TaskPriorityQueue::place(size_t index, std::shared_ptr<Task> task) {
+  task->heapIndex = index;
+  heap_[index] = std::move(task);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/runtimescheduler/Task.h>
+
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Priority queue of tasks ordered by expiration time (and by creation order
+ * for equal expiration times).
+ *
+ * Implemented as an indexed 4-ary heap: every task stores its position in the
+ * heap, which allows removing any task in O(log n). A 4-ary heap is shallower
+ * than a binary one and keeps the children of a node next to each other.
+ * A task can be in at most one queue at a time.
+ *
+ * Not thread-safe.
+ */
+class TaskPriorityQueue final {
+ public:
+  bool empty() const
+  {
+    return heap_.empty();
+  }
+
+  size_t size() const
+  {
+    return heap_.size();
+  }
+
+  /*
+   * Returns the task with the earliest expiration time.
+   * Must not be called on an empty queue.
+   */
+  const std::shared_ptr<Task> &top() const
+  {
+    return heap_.front();
+  }
+
+  void push(std::shared_ptr<Task> task);
+
+  /*
+   * Removes the task with the earliest expiration time.
+   * Must not be called on an empty queue.
+   */
+  void pop();
+
+  /*
+   * Removes the given task from the queue. Returns `false` if the task is not
+   * in the queue.
+   */
+  bool remove(Task &task);
+
+ private:
+  static constexpr size_t kArity = 4;
+
+  static bool precedes(const Task &lhs, const Task &rhs);
+
+  void removeAt(size_t index);
+  void siftUp(size_t index);
+  void siftDown(size_t index);
+  void place(size_t index, std::shared_ptr<Task> task);
+
+  std::vector<std::shared_ptr<Task>> heap_;
+};
+
+} // namespace facebook::react
@@ -12,11 +12,14 @@
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/performance/timeline/PerformanceEntryReporter.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <memory>
 #include <semaphore>
 #include <thread>
 #include <variant>
+#include <vector>
 
 #include "StubClock.h"
 #include "StubErrorUtils.h"
@@ -31,15 +34,23 @@ static bool forcedBatchRenderingUpdatesInEventLoop = false;
 class RuntimeSchedulerTestFeatureFlags
     : public ReactNativeFeatureFlagsDefaults {
  public:
-  explicit RuntimeSchedulerTestFeatureFlags(bool enableEventLoop)
-      : enableEventLoop_(enableEventLoop) {}
+  explicit RuntimeSchedulerTestFeatureFlags(
+      bool enableEventLoop,
+      bool enableFrameDeadlineScheduling = true)
+      : enableEventLoop_(enableEventLoop),
+        enableFrameDeadlineScheduling_(enableFrameDeadlineScheduling) {}
 
   bool enableBridgelessArchitecture() override {
     return enableEventLoop_;
   }
 
+  bool enableFrameDeadlineScheduling() override {
+    return enableFrameDeadlineScheduling_;
+  }
+
  private:
   bool enableEventLoop_;
+  bool enableFrameDeadlineScheduling_;
 };
 
 class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
@@ -58,7 +69,17 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
         facebook::hermes::makeHermesRuntime(runtimeConfigBuilder.build());
     stubErrorUtils_ = StubErrorUtils::createAndInstallIfNeeded(*runtime_);
     stubQueue_ = std::make_unique<StubQueue>();
+    stubClock_ = std::make_unique<StubClock>(StubClock());
+    performanceEntryReporter_ = std::make_unique<PerformanceEntryReporter>();
 
+    createRuntimeScheduler();
+  }
+
+  void TearDown() override {
+    ReactNativeFeatureFlags::dangerouslyReset();
+  }
+
+  void createRuntimeScheduler() {
     RuntimeExecutor runtimeExecutor =
         [this](
             std::function<void(facebook::jsi::Runtime & runtime)>&& callback) {
@@ -67,14 +88,10 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
           });
         };
 
-    stubClock_ = std::make_unique<StubClock>(StubClock());
-
     auto stubNow = [this]() -> HighResTimeStamp {
       return stubClock_->getNow();
     };
 
-    performanceEntryReporter_ = std::make_unique<PerformanceEntryReporter>();
-
     runtimeScheduler_ =
         std::make_unique<RuntimeScheduler>(runtimeExecutor, stubNow);
 
@@ -82,10 +99,6 @@ class RuntimeSchedulerTest : public testing::TestWithParam<bool> {
         performanceEntryReporter_.get());
   }
 
-  void TearDown() override {
-    ReactNativeFeatureFlags::dangerouslyReset();
-  }
-
   jsi::Function createHostFunctionFromLambda(
       std::function<jsi::Value(bool)> callback) {
     return jsi::Function::createFromHostFunction(
@@ -412,6 +425,53 @@ TEST_P(RuntimeSchedulerTest, cancelTask) {
   EXPECT_EQ(stubQueue_->size(), 0);
 }
 
+TEST_P(RuntimeSchedulerTest, cancelManyTasks) {
+  constexpr int kTaskCount = 300;
+  constexpr std::array<SchedulerPriority, 3> kPriorities{
+      SchedulerPriority::UserBlockingPriority,
+      SchedulerPriority::NormalPriority,
+      SchedulerPriority::LowPriority};
+
+  auto executedTasks = std::vector<int>{};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  // Expiration time and index of every task.
+  auto expirationTimes = std::vector<std::pair<HighResTimeStamp, int>>{};
+
+  for (int i = 0; i < kTaskCount; i++) {
+    auto priority = kPriorities[i % kPriorities.size()];
+    auto callback =
+        createHostFunctionFromLambda([&executedTasks, i](bool /*unused*/) {
+          executedTasks.push_back(i);
+          return jsi::Value::undefined();
+        });
+    tasks.push_back(
+        runtimeScheduler_->scheduleTask(priority, std::move(callback)));
+    expirationTimes.emplace_back(
+        stubClock_->getNow() + timeoutForSchedulerPriority(priority), i);
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(1ms));
+  }
+
+  // Cancelling tasks from the top, from the bottom and from the middle of the
+  // queue, and cancelling some of them twice.
+  auto expectedTasks = std::vector<int>{};
+  std::sort(expirationTimes.begin(), expirationTimes.end());
+  for (const auto& [expirationTime, i] : expirationTimes) {
+    if (i % 5 == 0 || i % 7 == 0) {
+      runtimeScheduler_->cancelTask(*tasks[i]);
+    } else {
+      expectedTasks.push_back(i);
+    }
+  }
+  for (int i = 0; i < kTaskCount; i += 10) {
+    runtimeScheduler_->cancelTask(*tasks[i]);
+  }
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(executedTasks, expectedTasks);
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
 TEST_P(RuntimeSchedulerTest, continuationTask) {
   bool didRunTask = false;
   bool didContinuationTask = false;
@@ -1355,6 +1415,148 @@ TEST_P(RuntimeSchedulerTest, reportsLongTasksWithYielding) {
       entry);
 }
 
+TEST_P(RuntimeSchedulerTest, yieldsAtFrameDeadline) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  auto startTime = stubClock_->getNow();
+  runtimeScheduler_->setFrameDeadline(
+      startTime + HighResDuration::fromChrono(16ms),
+      HighResDuration::fromChrono(16ms));
+
+  auto shouldYieldValues = std::vector<bool>{};
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(10ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(6ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback1));
+  stubQueue_->tick();
+
+  EXPECT_EQ(shouldYieldValues, (std::vector<bool>{false, false, true}));
+
+  // A task starting after the last reported deadline gets the budget of the
+  // frame it starts in.
+  shouldYieldValues.clear();
+  stubClock_->setTimePoint(startTime + HighResDuration::fromChrono(20ms));
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(10ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(2ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback2));
+  stubQueue_->tick();
+
+  EXPECT_EQ(shouldYieldValues, (std::vector<bool>{false, true}));
+
+  // A zero interval disables the frame budget.
+  shouldYieldValues.clear();
+  runtimeScheduler_->setFrameDeadline(startTime, HighResDuration::zero());
+  auto callback3 = createHostFunctionFromLambda([&](bool /* unused */) {
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(100ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback3));
+  stubQueue_->tick();
+
+  EXPECT_EQ(shouldYieldValues, (std::vector<bool>{false}));
+}
+
+TEST_P(RuntimeSchedulerTest, reportsMissedFramesAsLongTasks) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  auto startTime = stubClock_->getNow();
+  runtimeScheduler_->setFrameDeadline(
+      startTime + HighResDuration::fromChrono(16ms),
+      HighResDuration::fromChrono(16ms));
+
+  // Yields in time, the task is longer than a frame but no frame is missed.
+  auto callback1 = createHostFunctionFromLambda([&](bool /* unused */) {
+    for (int i = 0; i < 8; i++) {
+      stubClock_->advanceTimeBy(HighResDuration::fromChrono(5ms));
+      runtimeScheduler_->getShouldYield();
+    }
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback1));
+  stubQueue_->tick();
+
+  EXPECT_EQ(performanceEntryReporter_->getEntries().size(), 0);
+
+  // Doesn't yield for longer than a frame.
+  auto callback2StartTime = stubClock_->getNow();
+  auto callback2 = createHostFunctionFromLambda([&](bool /* unused */) {
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(20ms));
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback2));
+  stubQueue_->tick();
+
+  auto pendingEntries = performanceEntryReporter_->getEntries();
+  ASSERT_EQ(pendingEntries.size(), 1);
+  std::visit(
+      [callback2StartTime](const auto& entryDetails) {
+        EXPECT_EQ(entryDetails.entryType, PerformanceEntryType::LONGTASK);
+        EXPECT_EQ(entryDetails.startTime, callback2StartTime);
+        EXPECT_EQ(entryDetails.duration, HighResDuration::fromMilliseconds(20));
+      },
+      pendingEntries[0]);
+}
+
+TEST_P(RuntimeSchedulerTest, ignoresFrameDeadlinesWhenDisabled) {
+  // Only for event loop
+  if (!GetParam()) {
+    return;
+  }
+
+  ReactNativeFeatureFlags::dangerouslyForceOverride(
+      std::make_unique<RuntimeSchedulerTestFeatureFlags>(
+          GetParam(), /* enableFrameDeadlineScheduling */ false));
+  createRuntimeScheduler();
+
+  auto startTime = stubClock_->getNow();
+  runtimeScheduler_->setFrameDeadline(
+      startTime + HighResDuration::fromChrono(16ms),
+      HighResDuration::fromChrono(16ms));
+
+  auto shouldYieldValues = std::vector<bool>{};
+  auto callback = createHostFunctionFromLambda([&](bool /* unused */) {
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(20ms));
+    shouldYieldValues.push_back(runtimeScheduler_->getShouldYield());
+    stubClock_->advanceTimeBy(HighResDuration::fromChrono(20ms));
+    return jsi::Value::undefined();
+  });
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority, std::move(callback));
+  stubQueue_->tick();
+
+  // No yielding at the frame deadline, and no long task shorter than 50ms.
+  EXPECT_EQ(shouldYieldValues, (std::vector<bool>{false}));
+  EXPECT_EQ(performanceEntryReporter_->getEntries().size(), 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     UseModernRuntimeScheduler,
     RuntimeSchedulerTest,
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/TaskPriorityQueue.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+static const auto kStartTime = HighResTimeStamp::now();
+
+static std::shared_ptr<Task> createTask(int64_t expirationTimeMs) {
+  return makePooledTask(
+      SchedulerPriority::NormalPriority,
+      [](jsi::Runtime& /*runtime*/) {},
+      kStartTime + HighResDuration::fromMilliseconds(expirationTimeMs));
+}
+
+TEST(TaskPriorityQueueTest, popsTasksByExpirationTime) {
+  auto taskQueue = TaskPriorityQueue{};
+  auto task1 = createTask(30);
+  auto task2 = createTask(10);
+  auto task3 = createTask(20);
+  auto task4 = createTask(10);
+  taskQueue.push(task1);
+  taskQueue.push(task2);
+  taskQueue.push(task3);
+  taskQueue.push(task4);
+
+  EXPECT_EQ(taskQueue.size(), 4);
+  // Tasks with equal expiration times are popped in the creation order.
+  EXPECT_EQ(taskQueue.top(), task2);
+  taskQueue.pop();
+  EXPECT_EQ(taskQueue.top(), task4);
+  taskQueue.pop();
+  EXPECT_EQ(taskQueue.top(), task3);
+  taskQueue.pop();
+  EXPECT_EQ(taskQueue.top(), task1);
+  taskQueue.pop();
+  EXPECT_TRUE(taskQueue.empty());
+}
+
+TEST(TaskPriorityQueueTest, removesTasks) {
+  auto taskQueue = TaskPriorityQueue{};
+  auto task1 = createTask(10);
+  auto task2 = createTask(20);
+  auto task3 = createTask(30);
+  auto otherTask = createTask(5);
+  taskQueue.push(task1);
+  taskQueue.push(task2);
+  taskQueue.push(task3);
+
+  EXPECT_TRUE(taskQueue.remove(*task1));
+  EXPECT_FALSE(taskQueue.remove(*task1));
+  EXPECT_FALSE(taskQueue.remove(*otherTask));
+  EXPECT_EQ(taskQueue.size(), 2);
+  EXPECT_EQ(taskQueue.top(), task2);
+
+  // A removed task can be pushed again.
+  taskQueue.push(task1);
+  EXPECT_EQ(taskQueue.top(), task1);
+  taskQueue.pop();
+  taskQueue.pop();
+  EXPECT_TRUE(taskQueue.remove(*task3));
+  EXPECT_TRUE(taskQueue.empty());
+}
+
+TEST(TaskPriorityQueueTest, matchesSortedOrderAfterRandomRemovals) {
+  auto random = std::mt19937{42};
+  auto taskQueue = TaskPriorityQueue{};
+  // Expiration time and creation order of every task in the queue.
+  auto expectedTasks =
+      std::vector<std::pair<std::pair<int64_t, int>, std::shared_ptr<Task>>>{};
+
+  for (int i = 0; i < 5000; i++) {
+    if (random() % 3 != 0 || expectedTasks.empty()) {
+      auto expirationTimeMs = static_cast<int64_t>(random() % 500);
+      auto task = createTask(expirationTimeMs);
+      taskQueue.push(task);
+      expectedTasks.push_back({{expirationTimeMs, i}, std::move(task)});
+    } else {
+      auto index = random() % expectedTasks.size();
+      EXPECT_TRUE(taskQueue.remove(*expectedTasks[index].second));
+      expectedTasks.erase(
+          expectedTasks.begin() + static_cast<ptrdiff_t>(index));
+    }
+    ASSERT_EQ(taskQueue.size(), expectedTasks.size());
+  }
+
+  std::sort(
+      expectedTasks.begin(),
+      expectedTasks.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  for (const auto& [order, task] : expectedTasks) {
+    ASSERT_EQ(taskQueue.top(), task);
+    taskQueue.pop();
+  }
+  EXPECT_TRUE(taskQueue.empty());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler_Modern.h>
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr size_t kPendingTaskCount = 1000;
+constexpr std::array<SchedulerPriority, 4> kPriorities{
+    SchedulerPriority::UserBlockingPriority,
+    SchedulerPriority::NormalPriority,
+    SchedulerPriority::LowPriority,
+    SchedulerPriority::IdlePriority};
+
+/*
+ * The event loop is never run, so the scheduled tasks stay in the queue until
+ * they are cancelled.
+ */
+static std::unique_ptr<RuntimeScheduler_Modern> createRuntimeScheduler() {
+  return std::make_unique<RuntimeScheduler_Modern>(
+      [](std::function<void(jsi::Runtime&)>&& /*callback*/) {},
+      HighResTimeStamp::now,
+      [](jsi::Runtime& /*runtime*/, jsi::JSError& /*error*/) {});
+}
+
+static std::shared_ptr<Task> scheduleNoopTask(
+    RuntimeScheduler_Modern& runtimeScheduler,
+    SchedulerPriority priority) {
+  return runtimeScheduler.scheduleTask(
+      priority, [](jsi::Runtime& /*runtime*/) {});
+}
+
+/*
+ * Keeps `kPendingTaskCount` tasks in the queue, replacing a random one of
+ * them in every iteration, as happens when React reschedules its work.
+ */
+static void scheduleAndCancelTaskChurn(benchmark::State& state) {
+  auto runtimeScheduler = createRuntimeScheduler();
+  auto random = std::mt19937{42};
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  for (size_t i = 0; i < kPendingTaskCount; i++) {
+    tasks.push_back(scheduleNoopTask(
+        *runtimeScheduler, kPriorities[i % kPriorities.size()]));
+  }
+
+  for (auto _ : state) {
+    auto& task = tasks[random() % tasks.size()];
+    runtimeScheduler->cancelTask(*task);
+    task = scheduleNoopTask(
+        *runtimeScheduler, kPriorities[random() % kPriorities.size()]);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(scheduleAndCancelTaskChurn);
+
+static void scheduleAndCancelTaskBatch(benchmark::State& state) {
+  auto tasks = std::vector<std::shared_ptr<Task>>{};
+  tasks.reserve(kPendingTaskCount);
+
+  for (auto _ : state) {
+    auto runtimeScheduler = createRuntimeScheduler();
+    for (size_t i = 0; i < kPendingTaskCount; i++) {
+      tasks.push_back(scheduleNoopTask(
+          *runtimeScheduler, kPriorities[i % kPriorities.size()]));
+    }
+    for (const auto& task : tasks) {
+      runtimeScheduler->cancelTask(*task);
+    }
+    tasks.clear();
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(kPendingTaskCount));
+}
+BENCHMARK(scheduleAndCancelTaskBatch);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
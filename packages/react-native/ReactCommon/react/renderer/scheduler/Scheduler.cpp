@@ -116,6 +116,15 @@ Scheduler::Scheduler(
   uiManager->setDelegate(this);
   uiManager->setComponentDescriptorRegistry(componentDescriptorRegistry_);
 
+  if (ReactNativeFeatureFlags::enableBackgroundCommits() &&
+      schedulerToolbox.backgroundExecutor) {
+    uiManager->setBackgroundCommitExecutor(schedulerToolbox.backgroundExecutor);
+  }
+
+  if (ReactNativeFeatureFlags::enableBackgroundDiffing()) {
+    diffExecutor_ = schedulerToolbox.backgroundExecutor;
+  }
+
   auto bindingsExecutor =
       schedulerToolbox.bridgelessBindingsExecutor.has_value()
       ? schedulerToolbox.bridgelessBindingsExecutor.value()
@@ -356,6 +365,10 @@ void Scheduler::uiManagerShouldRemoveEventListener(
 }
 
 void Scheduler::uiManagerDidStartSurface(const ShadowTree& shadowTree) {
+  if (diffExecutor_) {
+    shadowTree.getMountingCoordinator()->setDiffExecutor(diffExecutor_);
+  }
+
   std::shared_lock lock(onSurfaceStartCallbackMutex_);
   if (onSurfaceStartCallback_) {
     onSurfaceStartCallback_(shadowTree);
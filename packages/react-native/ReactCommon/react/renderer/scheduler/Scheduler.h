@@ -146,6 +146,12 @@ class Scheduler final : public UIManagerDelegate {
 
   RuntimeScheduler *runtimeScheduler_{nullptr};
 
+  /*
+   * Calculates the mutations of new revisions ahead of mounting, if enabled
+   * (see `enableBackgroundDiffing`).
+   */
+  BackgroundExecutor diffExecutor_;
+
   mutable std::shared_mutex onSurfaceStartCallbackMutex_;
   OnSurfaceStartCallback onSurfaceStartCallback_;
 };
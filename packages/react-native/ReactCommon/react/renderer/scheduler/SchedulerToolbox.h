@@ -54,6 +54,14 @@ struct SchedulerToolbox final {
    */
   EventBeat::Factory eventBeatFactory;
 
+  /*
+   * Runs work off the JavaScript and main threads. Optional: features which
+   * need it (`enableBackgroundCommits` and `enableBackgroundDiffing`) are off
+   * without it.
+   * Callbacks must run one at a time.
+   */
+  BackgroundExecutor backgroundExecutor;
+
   /*
    * A list of `UIManagerCommitHook`s that should be registered in `UIManager`.
    */
@@ -10,6 +10,7 @@
 #include <cxxreact/TraceSection.h>
 #include <react/debug/react_native_assert.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
 #include <react/renderer/uimanager/UIManager.h>
 
 namespace facebook::react {
@@ -96,6 +97,11 @@ void SurfaceHandler::stop() const noexcept {
   if (shadowTree) {
     shadowTree->commitEmptyTree();
   }
+
+  // Returns the memory of the surface's shadow nodes which are not referenced
+  // anymore (e.g. by the mounting layer) to the system.
+  shadowTree = nullptr;
+  ShadowNodeMemoryPool::shared().trim();
 }
 
 void SurfaceHandler::setDisplayMode(DisplayMode displayMode) const noexcept {
@@ -19,11 +19,16 @@ void SurfaceTelemetry::incorporate(
   commitTime_ += telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
   diffTime_ += telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
   mountTime_ += telemetry.getMountEndTime() - telemetry.getMountStartTime();
+  diffWaitTime_ += telemetry.getDiffWaitTime();
 
   numberOfTransactions_++;
   numberOfMutations_ += numberOfMutations;
   numberOfTextMeasurements_ += telemetry.getNumberOfTextMeasurements();
   lastRevisionNumber_ = telemetry.getRevisionNumber();
+  if (telemetry.isDiffedAhead()) {
+    numberOfTransactionsDiffedAhead_++;
+  }
+  numberOfCoalescedRevisions_ += telemetry.getNumberOfCoalescedRevisions();
 
   while (recentTransactionTelemetries_.size() >=
          kMaxNumberOfRecordedCommitTelemetries) {
@@ -53,6 +58,10 @@ TelemetryDuration SurfaceTelemetry::getMountTime() const {
   return mountTime_;
 }
 
+TelemetryDuration SurfaceTelemetry::getDiffWaitTime() const {
+  return diffWaitTime_;
+}
+
 int SurfaceTelemetry::getNumberOfTransactions() const {
   return numberOfTransactions_;
 }
@@ -69,6 +78,14 @@ int SurfaceTelemetry::getLastRevisionNumber() const {
   return lastRevisionNumber_;
 }
 
+int SurfaceTelemetry::getNumberOfTransactionsDiffedAhead() const {
+  return numberOfTransactionsDiffedAhead_;
+}
+
+int SurfaceTelemetry::getNumberOfCoalescedRevisions() const {
+  return numberOfCoalescedRevisions_;
+}
+
 std::vector<TransactionTelemetry>
 SurfaceTelemetry::getRecentTransactionTelemetries() const {
   auto result = std::vector<TransactionTelemetry>{};
@@ -31,10 +31,18 @@ class SurfaceTelemetry final {
   TelemetryDuration getDiffTime() const;
   TelemetryDuration getMountTime() const;
 
+  /*
+   * Time the mounting thread waited for mutations which were calculated
+   * ahead of mounting (see `MountingCoordinator::setDiffExecutor`).
+   */
+  TelemetryDuration getDiffWaitTime() const;
+
   int getNumberOfTransactions() const;
   int getNumberOfMutations() const;
   int getNumberOfTextMeasurements() const;
   int getLastRevisionNumber() const;
+  int getNumberOfTransactionsDiffedAhead() const;
+  int getNumberOfCoalescedRevisions() const;
 
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
@@ -50,11 +58,14 @@ class SurfaceTelemetry final {
   TelemetryDuration textMeasureTime_{};
   TelemetryDuration diffTime_{};
   TelemetryDuration mountTime_{};
+  TelemetryDuration diffWaitTime_{};
 
   int numberOfTransactions_{};
   int numberOfMutations_{};
   int numberOfTextMeasurements_{};
   int lastRevisionNumber_{};
+  int numberOfTransactionsDiffedAhead_{};
+  int numberOfCoalescedRevisions_{};
 
   std::vector<TransactionTelemetry> recentTransactionTelemetries_{};
 };
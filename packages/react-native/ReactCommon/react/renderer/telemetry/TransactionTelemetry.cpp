@@ -78,6 +78,10 @@ void TransactionTelemetry::didMeasureText() {
   lastTextMeasureStartTime_ = kTelemetryUndefinedTimePoint;
 }
 
+void TransactionTelemetry::didReuseTextMeasurement() {
+  numberOfReusedTextMeasurements_++;
+}
+
 void TransactionTelemetry::didLayout() {
   react_native_assert(layoutStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ == kTelemetryUndefinedTimePoint);
@@ -105,6 +109,24 @@ void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setShadowNodeAllocationCounts(
+    int numberOfAllocations,
+    int numberOfSystemAllocations) {
+  numberOfShadowNodeAllocations_ = numberOfAllocations;
+  numberOfShadowNodeSystemAllocations_ = numberOfSystemAllocations;
+}
+
+void TransactionTelemetry::didDiffAhead(TelemetryDuration waitTime) {
+  react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
+  isDiffedAhead_ = true;
+  diffWaitTime_ = waitTime;
+}
+
+void TransactionTelemetry::setNumberOfCoalescedRevisions(
+    int numberOfCoalescedRevisions) {
+  numberOfCoalescedRevisions_ = numberOfCoalescedRevisions;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -161,10 +183,34 @@ int TransactionTelemetry::getNumberOfTextMeasurements() const {
   return numberOfTextMeasurements_;
 }
 
+int TransactionTelemetry::getNumberOfReusedTextMeasurements() const {
+  return numberOfReusedTextMeasurements_;
+}
+
 int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getNumberOfShadowNodeAllocations() const {
+  return numberOfShadowNodeAllocations_;
+}
+
+int TransactionTelemetry::getNumberOfShadowNodeSystemAllocations() const {
+  return numberOfShadowNodeSystemAllocations_;
+}
+
+bool TransactionTelemetry::isDiffedAhead() const {
+  return isDiffedAhead_;
+}
+
+TelemetryDuration TransactionTelemetry::getDiffWaitTime() const {
+  return diffWaitTime_;
+}
+
+int TransactionTelemetry::getNumberOfCoalescedRevisions() const {
+  return numberOfCoalescedRevisions_;
+}
+
 int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
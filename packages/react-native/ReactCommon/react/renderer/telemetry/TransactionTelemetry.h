@@ -42,6 +42,7 @@ class TransactionTelemetry final {
   void willLayout();
   void willMeasureText();
   void didMeasureText();
+  void didReuseTextMeasurement();
   void didLayout();
   void didLayout(int affectedLayoutNodesCount);
   void willMount();
@@ -49,6 +50,27 @@ class TransactionTelemetry final {
 
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * Records how many shadow node, children list and props allocations were
+   * performed by the committing thread since its previous commit (including
+   * the clones preceding the transaction), and how many of them had to reach
+   * the global allocator (see `ShadowNodeMemoryPool`).
+   */
+  void setShadowNodeAllocationCounts(int numberOfAllocations, int numberOfSystemAllocations);
+
+  /*
+   * Records that the mutations were calculated ahead of mounting on a
+   * background executor (see `MountingCoordinator::setDiffExecutor`), and how
+   * long the thread pulling the transaction waited for them.
+   */
+  void didDiffAhead(TelemetryDuration waitTime);
+
+  /*
+   * Records how many revisions were committed after the previous transaction
+   * and superseded by a newer one before being mounted.
+   */
+  void setNumberOfCoalescedRevisions(int numberOfCoalescedRevisions);
+
   /*
    * Reading
    */
@@ -63,7 +85,13 @@ class TransactionTelemetry final {
 
   TelemetryDuration getTextMeasureTime() const;
   int getNumberOfTextMeasurements() const;
+  int getNumberOfReusedTextMeasurements() const;
   int getRevisionNumber() const;
+  int getNumberOfShadowNodeAllocations() const;
+  int getNumberOfShadowNodeSystemAllocations() const;
+  bool isDiffedAhead() const;
+  TelemetryDuration getDiffWaitTime() const;
+  int getNumberOfCoalescedRevisions() const;
 
   int getAffectedLayoutNodesCount() const;
 
@@ -81,7 +109,13 @@ class TransactionTelemetry final {
   TelemetryDuration textMeasureTime_{0};
 
   int numberOfTextMeasurements_{0};
+  int numberOfReusedTextMeasurements_{0};
   int revisionNumber_{0};
+  int numberOfShadowNodeAllocations_{0};
+  int numberOfShadowNodeSystemAllocations_{0};
+  bool isDiffedAhead_{false};
+  TelemetryDuration diffWaitTime_{0};
+  int numberOfCoalescedRevisions_{0};
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PersistentTextMeasureCache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint32_t kFileMagic = 0x4D544E52; // "RNTM"
+constexpr uint32_t kFileVersion = 1;
+
+// Number of pending entries which triggers appending them to the file.
+constexpr size_t kPendingEntriesFlushThreshold = 256;
+
+struct FileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t fontConfigurationFingerprint;
+  float fontScale;
+  uint32_t reserved;
+};
+
+struct FileRecord {
+  uint64_t hash;
+  uint64_t fingerprint;
+  float width;
+  float height;
+};
+
+static_assert(sizeof(FileHeader) == 24);
+static_assert(sizeof(FileRecord) == 24);
+
+/*
+ * 64-bit FNV-1a. Unlike `std::hash`, the result does not depend on the
+ * standard library, and it is independent of the layout-wise hash, which
+ * makes collisions of persisted keys practically impossible.
+ */
+class Fingerprint {
+ public:
+  void add(std::string_view bytes) {
+    for (auto byte : bytes) {
+      value_ ^= static_cast<uint8_t>(byte);
+      value_ *= 0x100000001B3ull;
+    }
+    // Separating consecutive strings.
+    value_ ^= 0xFF;
+    value_ *= 0x100000001B3ull;
+  }
+
+  void add(Float value) {
+    auto floatValue = static_cast<float>(value);
+    add(std::string_view{
+        reinterpret_cast<const char*>(&floatValue), sizeof(floatValue)});
+  }
+
+  uint64_t value() const {
+    return value_;
+  }
+
+ private:
+  uint64_t value_{0xCBF29CE484222325ull};
+};
+
+/*
+ * Writes the records to the file, after the header if it is given (which
+ * truncates the file). Returns whether all writes succeeded.
+ */
+bool writeFile(
+    const std::string& filePath,
+    const std::optional<FileHeader>& header,
+    const std::vector<FileRecord>& records) {
+  auto* file = fopen(filePath.c_str(), header.has_value() ? "wb" : "ab");
+  if (file == nullptr) {
+    return false;
+  }
+
+  auto succeeded = true;
+  if (header.has_value()) {
+    succeeded = fwrite(&*header, sizeof(FileHeader), 1, file) == 1;
+  }
+  if (succeeded && !records.empty()) {
+    succeeded = fwrite(
+                    records.data(), sizeof(FileRecord), records.size(), file) ==
+        records.size();
+  }
+
+  return fclose(file) == 0 && succeeded;
+}
+
+} // namespace
+
+PersistentTextMeasureCache::PersistentTextMeasureCache(
+    std::string filePath,
+    uint64_t fontConfigurationFingerprint,
+    Float fontScale,
+    FlushExecutor flushExecutor)
+    : state_(
+          std::make_shared<State>(
+              std::move(filePath), fontConfigurationFingerprint, fontScale)),
+      flushExecutor_(std::move(flushExecutor)) {
+  load();
+}
+
+PersistentTextMeasureCache::State::State(
+    std::string filePath,
+    uint64_t fontConfigurationFingerprint,
+    Float fontScale)
+    : filePath(std::move(filePath)),
+      fontConfigurationFingerprint(fontConfigurationFingerprint),
+      fontScale(fontScale) {}
+
+PersistentTextMeasureCache::~PersistentTextMeasureCache() {
+  flush(*state_);
+}
+
+PersistentTextMeasureCache::EntryKey
+PersistentTextMeasureCache::entryKeyFromCacheKey(
+    const TextMeasureCacheKey& key) {
+  auto fingerprint = Fingerprint{};
+  for (const auto& fragment : key.attributedString.getFragments()) {
+    fingerprint.add(fragment.string);
+    fingerprint.add(fragment.textAttributes.fontFamily);
+    fingerprint.add(fragment.textAttributes.fontSize);
+  }
+  fingerprint.add(key.layoutConstraints.minimumSize.width);
+  fingerprint.add(key.layoutConstraints.minimumSize.height);
+  fingerprint.add(key.layoutConstraints.maximumSize.width);
+  fingerprint.add(key.layoutConstraints.maximumSize.height);
+
+  return EntryKey{
+      .hash = static_cast<uint64_t>(std::hash<TextMeasureCacheKey>{}(key)),
+      .fingerprint = fingerprint.value()};
+}
+
+void PersistentTextMeasureCache::load() const {
+  // Called from the constructor, before the state is shared.
+  auto& state = *state_;
+
+  auto fileDescriptor = open(state.filePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fileDescriptor < 0) {
+    return;
+  }
+
+  struct stat fileStat {};
+  if (fstat(fileDescriptor, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < sizeof(FileHeader)) {
+    close(fileDescriptor);
+    return;
+  }
+
+  auto fileSize = static_cast<size_t>(fileStat.st_size);
+  auto* data =
+      mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  close(fileDescriptor);
+  if (data == MAP_FAILED) {
+    return;
+  }
+
+  const auto* bytes = static_cast<const std::byte*>(data);
+
+  auto header = FileHeader{};
+  std::memcpy(&header, bytes, sizeof(header));
+
+  // A file written for other fonts or another font scale is discarded and
+  // recreated on the next flush.
+  if (header.magic == kFileMagic && header.version == kFileVersion &&
+      header.fontConfigurationFingerprint ==
+          state.fontConfigurationFingerprint &&
+      header.fontScale == static_cast<float>(state.fontScale)) {
+    // A partially written trailing record (if the app was terminated in the
+    // middle of a write) is ignored.
+    auto recordCount = (fileSize - sizeof(FileHeader)) / sizeof(FileRecord);
+    if (recordCount <= kMaxEntryCount) {
+      state.entries.reserve(recordCount);
+      for (size_t index = 0; index < recordCount; index++) {
+        auto record = FileRecord{};
+        std::memcpy(
+            &record,
+            bytes + sizeof(FileHeader) + index * sizeof(FileRecord),
+            sizeof(record));
+        state.entries.insert_or_assign(
+            EntryKey{.hash = record.hash, .fingerprint = record.fingerprint},
+            Size{.width = record.width, .height = record.height});
+      }
+      state.shouldRecreateFile =
+          recordCount * sizeof(FileRecord) + sizeof(FileHeader) != fileSize;
+    }
+  }
+
+  munmap(data, fileSize);
+
+  if (state.shouldRecreateFile) {
+    // Whatever was loaded is rewritten in full.
+    for (const auto& [entryKey, size] : state.entries) {
+      state.pendingEntries.push_back(Entry{.key = entryKey, .size = size});
+    }
+  }
+}
+
+std::optional<TextMeasurement> PersistentTextMeasureCache::find(
+    const TextMeasureCacheKey& key) const {
+  auto entryKey = entryKeyFromCacheKey(key);
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  auto it = state_->entries.find(entryKey);
+  if (it == state_->entries.end()) {
+    return std::nullopt;
+  }
+  return TextMeasurement{.size = it->second, .attachments = {}};
+}
+
+void PersistentTextMeasureCache::store(
+    const TextMeasureCacheKey& key,
+    const TextMeasurement& measurement) const {
+  if (!measurement.attachments.empty()) {
+    // Attachment frames are not persisted.
+    return;
+  }
+
+  auto entryKey = entryKeyFromCacheKey(key);
+
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->entries.size() >= kMaxEntryCount) {
+      return;
+    }
+
+    auto [it, inserted] = state_->entries.emplace(entryKey, measurement.size);
+    if (!inserted) {
+      return;
+    }
+
+    state_->pendingEntries.push_back(
+        Entry{.key = entryKey, .size = measurement.size});
+    if (state_->pendingEntries.size() < kPendingEntriesFlushThreshold ||
+        state_->isFlushScheduled) {
+      return;
+    }
+    state_->isFlushScheduled = true;
+  }
+
+  scheduleFlush();
+}
+
+void PersistentTextMeasureCache::flush() const {
+  flush(*state_);
+}
+
+void PersistentTextMeasureCache::scheduleFlush() const {
+  if (!flushExecutor_) {
+    flush(*state_);
+    return;
+  }
+
+  flushExecutor_([state = state_]() { flush(*state); });
+}
+
+void PersistentTextMeasureCache::flush(State& state) {
+  std::lock_guard<std::mutex> fileLock(state.fileMutex);
+
+  auto header = std::optional<FileHeader>{};
+  auto records = std::vector<FileRecord>{};
+  auto generation = uint64_t{};
+
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.isFlushScheduled = false;
+    if (state.pendingEntries.empty() && !state.shouldRecreateFile) {
+      return;
+    }
+
+    if (state.shouldRecreateFile) {
+      header = FileHeader{
+          .magic = kFileMagic,
+          .version = kFileVersion,
+          .fontConfigurationFingerprint = state.fontConfigurationFingerprint,
+          .fontScale = static_cast<float>(state.fontScale),
+          .reserved = 0};
+    }
+
+    // When the file is recreated, all entries are pending.
+    records.reserve(state.pendingEntries.size());
+    for (const auto& entry : state.pendingEntries) {
+      records.push_back(
+          FileRecord{
+              .hash = entry.key.hash,
+              .fingerprint = entry.key.fingerprint,
+              .width = static_cast<float>(entry.size.width),
+              .height = static_cast<float>(entry.size.height)});
+    }
+    state.pendingEntries.clear();
+    generation = state.generation;
+  }
+
+  // The file is written without holding `mutex`, so that measuring text is
+  // never blocked on disk I/O.
+  auto succeeded = writeFile(state.filePath, header, records);
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.generation != generation) {
+    // All entries were discarded in the meantime; the file is recreated on
+    // the next flush anyway.
+    return;
+  }
+
+  if (succeeded) {
+    state.shouldRecreateFile = false;
+  } else {
+    // The file may be corrupted now; starting over on the next flush.
+    state.shouldRecreateFile = true;
+    state.pendingEntries.clear();
+    state.entries.clear();
+    state.generation++;
+  }
+}
+
+void PersistentTextMeasureCache::setFontScale(Float fontScale) const {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->fontScale == fontScale) {
+      return;
+    }
+
+    state_->fontScale = fontScale;
+    state_->entries.clear();
+    state_->pendingEntries.clear();
+    state_->shouldRecreateFile = true;
+    state_->generation++;
+    if (state_->isFlushScheduled) {
+      return;
+    }
+    state_->isFlushScheduled = true;
+  }
+
+  // Recreating the file with the new font scale.
+  scheduleFlush();
+}
+
+size_t PersistentTextMeasureCache::size() const {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->entries.size();
+}
+
+} // namespace facebook::react
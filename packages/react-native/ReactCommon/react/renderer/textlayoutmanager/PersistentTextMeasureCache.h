@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+namespace facebook::react {
+
+/*
+ * Text measurement cache persisted in a file across app launches.
+ *
+ * Entries are keyed by the layout-wise hash of `TextMeasureCacheKey` (see
+ * `textAttributesHashLayoutWise`) combined with an independent fingerprint of
+ * the measured strings, and store the measured size. Measurements with
+ * attachments are not persisted.
+ *
+ * The file is memory-mapped and loaded once at construction. New entries are
+ * appended to the file in batches (and on `flush()`), so the file never has to
+ * be rewritten as a whole. Batches are written on the flush executor (if any),
+ * outside of the lock which `find` and `store` take. The file is discarded if its format version, the
+ * font configuration fingerprint (which must identify the set of available
+ * fonts and the build of the text stack) or the font scale does not match.
+ *
+ * Platform `TextLayoutManager`s use an instance registered in
+ * `ContextContainer` under `PersistentTextMeasureCache::ContextContainerKey`
+ * (as `std::shared_ptr<PersistentTextMeasureCache>`) as a second-level cache
+ * behind `TextMeasureCache`. The Android and iOS hosts register one if the
+ * `enablePersistentTextMeasureCache` feature flag is enabled, and update its
+ * font scale when the system font scale changes.
+ *
+ * The class is thread-safe.
+ */
+class PersistentTextMeasureCache final {
+ public:
+  static constexpr const char *ContextContainerKey = "PersistentTextMeasureCache";
+
+  /*
+   * Runs the given task on a background thread.
+   */
+  using FlushExecutor = std::function<void(std::function<void()> &&task)>;
+
+  /*
+   * Maximum number of entries kept in the cache; further entries are not
+   * persisted.
+   */
+  static constexpr size_t kMaxEntryCount = 16 * 1024;
+
+  /*
+   * Without `flushExecutor`, batches are written on the thread which stores the
+   * last entry of the batch.
+   */
+  PersistentTextMeasureCache(std::string filePath, uint64_t fontConfigurationFingerprint, Float fontScale, FlushExecutor flushExecutor = {});
+
+  /*
+   * Writes pending entries to the file.
+   */
+  ~PersistentTextMeasureCache();
+
+  PersistentTextMeasureCache(const PersistentTextMeasureCache &) = delete;
+  PersistentTextMeasureCache &operator=(const PersistentTextMeasureCache &) = delete;
+
+  /*
+   * Returns a previously stored measurement for the given key.
+   */
+  std::optional<TextMeasurement> find(const TextMeasureCacheKey &key) const;
+
+  /*
+   * Stores the measurement for the given key. The entry is written to the file
+   * with the next batch.
+   */
+  void store(const TextMeasureCacheKey &key, const TextMeasurement &measurement) const;
+
+  /*
+   * Writes all pending entries to the file on the calling thread.
+   */
+  void flush() const;
+
+  /*
+   * Drops all entries (in memory and on disk) if the font scale changed.
+   */
+  void setFontScale(Float fontScale) const;
+
+  /*
+   * Returns the number of entries in the cache.
+   */
+  size_t size() const;
+
+ private:
+  struct EntryKey {
+    uint64_t hash;
+    uint64_t fingerprint;
+
+    bool operator==(const EntryKey &rhs) const = default;
+  };
+
+  struct EntryKeyHash {
+    size_t operator()(const EntryKey &entryKey) const
+    {
+      return static_cast<size_t>(entryKey.hash ^ entryKey.fingerprint);
+    }
+  };
+
+  struct Entry {
+    EntryKey key;
+    Size size;
+  };
+
+  /*
+   * The state is shared with the flushes scheduled on the flush executor,
+   * which may outlive the cache.
+   */
+  struct State {
+    State(std::string filePath, uint64_t fontConfigurationFingerprint, Float fontScale);
+
+    const std::string filePath;
+    const uint64_t fontConfigurationFingerprint;
+
+    /*
+     * Serializes writing to the file. Taken before `mutex`.
+     */
+    std::mutex fileMutex;
+
+    std::mutex mutex;
+    Float fontScale;
+    std::unordered_map<EntryKey, Size, EntryKeyHash> entries;
+    std::vector<Entry> pendingEntries;
+
+    /*
+     * Whether the file has to be recreated (with a new header) on the next
+     * flush instead of being appended to.
+     */
+    bool shouldRecreateFile{true};
+
+    /*
+     * Whether a flush was handed to the flush executor and hasn't started yet.
+     */
+    bool isFlushScheduled{false};
+
+    /*
+     * Incremented whenever all entries are discarded, so that a flush which
+     * was writing at that moment doesn't mark the file as up to date.
+     */
+    uint64_t generation{0};
+  };
+
+  static EntryKey entryKeyFromCacheKey(const TextMeasureCacheKey &key);
+  static void flush(State &state);
+
+  void load() const;
+  void scheduleFlush() const;
+
+  const std::shared_ptr<State> state_;
+  const FlushExecutor flushExecutor_;
+};
+
+} // namespace facebook::react
@@ -158,6 +158,11 @@ TextLayoutManager::TextLayoutManager(
     const std::shared_ptr<const ContextContainer>& contextContainer)
     : contextContainer_(std::move(contextContainer)),
       textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      persistentTextMeasureCache_(
+          contextContainer_
+              ->find<std::shared_ptr<PersistentTextMeasureCache>>(
+                  PersistentTextMeasureCache::ContextContainerKey)
+              .value_or(nullptr)),
       lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
       preparedTextCache_(
           static_cast<size_t>(
@@ -170,8 +175,11 @@ TextMeasurement TextLayoutManager::measure(
     const LayoutConstraints& layoutConstraints) const {
   auto& attributedString = attributedStringBox.getValue();
 
+  auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+  auto measuredText = false;
+
   auto measureText = [&]() {
-    auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+    measuredText = true;
     if (telemetry != nullptr) {
       telemetry->willMeasureText();
     }
@@ -190,15 +198,35 @@ TextMeasurement TextLayoutManager::measure(
     return measurement;
   };
 
+  auto measureTextPersistently = [&]() {
+    auto key = TextMeasureCacheKey{
+        .attributedString = attributedString,
+        .paragraphAttributes = paragraphAttributes,
+        .layoutConstraints = layoutConstraints};
+
+    if (persistentTextMeasureCache_ == nullptr) {
+      return textMeasureCache_.get(key, std::move(measureText));
+    }
+
+    return textMeasureCache_.get(key, [&]() {
+      if (auto measurement = persistentTextMeasureCache_->find(key)) {
+        return *measurement;
+      }
+      auto measurement = measureText();
+      persistentTextMeasureCache_->store(key, measurement);
+      return measurement;
+    });
+  };
+
   auto measurement =
       (ReactNativeFeatureFlags::disableTextLayoutManagerCacheAndroid() ||
        ReactNativeFeatureFlags::enablePreparedTextLayout())
       ? measureText()
-      : textMeasureCache_.get(
-            {.attributedString = attributedString,
-             .paragraphAttributes = paragraphAttributes,
-             .layoutConstraints = layoutConstraints},
-            std::move(measureText));
+      : measureTextPersistently();
+
+  if (!measuredText && telemetry != nullptr) {
+    telemetry->didReuseTextMeasurement();
+  }
 
   measurement.size = layoutConstraints.clamp(measurement.size);
   return measurement;
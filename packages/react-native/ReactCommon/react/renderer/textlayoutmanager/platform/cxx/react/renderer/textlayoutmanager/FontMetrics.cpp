@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontMetrics.h"
+
+#include <folly/json.h>
+#include <glog/logging.h>
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace facebook::react {
+
+namespace {
+
+void fillAsciiAdvances(FontMetrics& fontMetrics) {
+  fontMetrics.asciiAdvances.fill(fontMetrics.defaultAdvance);
+  for (size_t character = 0; character < ' '; character++) {
+    fontMetrics.asciiAdvances[character] = 0;
+  }
+  fontMetrics.asciiAdvances[0x7F] = 0;
+}
+
+Float getMetric(const folly::dynamic& data, const char* name, Float fallback) {
+  auto it = data.find(name);
+  if (it == data.items().end() || !it->second.isNumber()) {
+    return fallback;
+  }
+  return static_cast<Float>(it->second.asDouble());
+}
+
+FontMetrics parseFontMetrics(const folly::dynamic& data) {
+  auto fontMetrics = FontMetrics{};
+  fontMetrics.ascender = getMetric(data, "ascender", fontMetrics.ascender);
+  fontMetrics.descender = getMetric(data, "descender", fontMetrics.descender);
+  fontMetrics.capHeight = getMetric(data, "capHeight", fontMetrics.capHeight);
+  fontMetrics.xHeight = getMetric(data, "xHeight", fontMetrics.xHeight);
+  fontMetrics.lineGap = getMetric(data, "lineGap", fontMetrics.lineGap);
+  fontMetrics.defaultAdvance =
+      getMetric(data, "defaultAdvance", fontMetrics.defaultAdvance);
+  fillAsciiAdvances(fontMetrics);
+
+  auto advances = data.find("advances");
+  if (advances == data.items().end() || !advances->second.isObject()) {
+    return fontMetrics;
+  }
+  for (const auto& [key, value] : advances->second.items()) {
+    if (!key.isString() || !value.isNumber()) {
+      continue;
+    }
+    auto string = key.getString();
+    auto offset = size_t{0};
+    auto character = decodeUtf8Character(string, offset);
+    if (string.empty() || offset != string.size()) {
+      LOG(ERROR) << "FontMetricsTable: advance key \"" << string
+                 << "\" is not a single character";
+      continue;
+    }
+    auto advance = static_cast<Float>(value.asDouble());
+    if (character < fontMetrics.asciiAdvances.size()) {
+      fontMetrics.asciiAdvances[character] = advance;
+    } else {
+      fontMetrics.advances[character] = advance;
+    }
+  }
+  return fontMetrics;
+}
+
+} // namespace
+
+FontMetricsTable::FontMetricsTable() {
+  fillAsciiAdvances(builtInFontMetrics_);
+  builtInFontMetrics_.asciiAdvances[' '] = 0.25;
+}
+
+FontMetricsTable::FontMetricsTable(const folly::dynamic& data)
+    : FontMetricsTable() {
+  if (!data.isObject()) {
+    LOG(ERROR) << "FontMetricsTable: data is not an object";
+    return;
+  }
+
+  if (auto it = data.find("defaultFamily");
+      it != data.items().end() && it->second.isString()) {
+    defaultFamily_ = it->second.getString();
+  }
+
+  auto fonts = data.find("fonts");
+  if (fonts == data.items().end() || !fonts->second.isArray()) {
+    return;
+  }
+  for (const auto& font : fonts->second) {
+    const auto* family = font.isObject() ? font.get_ptr("family") : nullptr;
+    if (family == nullptr || !family->isString()) {
+      LOG(ERROR) << "FontMetricsTable: font without a family";
+      continue;
+    }
+    auto weight = static_cast<int>(getMetric(
+        font, "weight", static_cast<Float>(FontWeight::Regular)));
+    fonts_[family->getString()].emplace_back(weight, parseFontMetrics(font));
+  }
+}
+
+std::shared_ptr<const FontMetricsTable> FontMetricsTable::loadFromFile(
+    const std::string& filePath) {
+  auto file = std::ifstream{filePath};
+  if (!file) {
+    LOG(ERROR) << "FontMetricsTable: can't read " << filePath;
+    return std::make_shared<const FontMetricsTable>();
+  }
+
+  auto contents = std::stringstream{};
+  contents << file.rdbuf();
+  try {
+    return std::make_shared<const FontMetricsTable>(
+        folly::parseJson(contents.str()));
+  } catch (const std::exception& exception) {
+    LOG(ERROR) << "FontMetricsTable: can't parse " << filePath << ": "
+               << exception.what();
+    return std::make_shared<const FontMetricsTable>();
+  }
+}
+
+const FontMetrics& FontMetricsTable::getFontMetrics(
+    const std::string& fontFamily,
+    FontWeight fontWeight) const {
+  auto weight = static_cast<int>(fontWeight);
+  if (auto fontMetrics = findFontMetrics(fontFamily, weight)) {
+    return *fontMetrics;
+  }
+  if (auto fontMetrics = findFontMetrics(defaultFamily_, weight)) {
+    return *fontMetrics;
+  }
+  return builtInFontMetrics_;
+}
+
+const FontMetrics* FontMetricsTable::findFontMetrics(
+    const std::string& fontFamily,
+    int weight) const {
+  auto it = fonts_.find(fontFamily);
+  if (it == fonts_.end()) {
+    return nullptr;
+  }
+
+  const FontMetrics* nearestFontMetrics = nullptr;
+  auto nearestDistance = 0;
+  for (const auto& [fontWeight, fontMetrics] : it->second) {
+    auto distance = std::abs(fontWeight - weight);
+    if (nearestFontMetrics == nullptr || distance < nearestDistance) {
+      nearestFontMetrics = &fontMetrics;
+      nearestDistance = distance;
+    }
+  }
+  return nearestFontMetrics;
+}
+
+} // namespace facebook::react
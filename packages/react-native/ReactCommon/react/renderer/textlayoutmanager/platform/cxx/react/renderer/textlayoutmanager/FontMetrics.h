@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <react/renderer/attributedstring/primitives.h>
+#include <react/renderer/graphics/Float.h>
+
+namespace facebook::react {
+
+/*
+ * Metrics of a single font (a family in a weight), in ems.
+ */
+struct FontMetrics {
+  Float ascender{0.93};
+  Float descender{-0.24};
+  Float capHeight{0.71};
+  Float xHeight{0.53};
+  Float lineGap{0};
+
+  /*
+   * The advance of the characters which have no advance of their own.
+   */
+  Float defaultAdvance{0.55};
+
+  Float getAdvance(char32_t character) const
+  {
+    if (character < asciiAdvances.size()) {
+      return asciiAdvances[character];
+    }
+    if (auto it = advances.find(character); it != advances.end()) {
+      return it->second;
+    }
+    return defaultAdvance;
+  }
+
+  /*
+   * The height of a line of text in the font, in ems.
+   */
+  Float getLineHeight() const
+  {
+    return ascender - descender + lineGap;
+  }
+
+  /*
+   * Advances of ASCII characters, which are looked up without hashing, and
+   * of other characters.
+   */
+  std::array<Float, 128> asciiAdvances{};
+  std::unordered_map<char32_t, Float> advances;
+};
+
+/*
+ * Font metrics used by the cxx `TextLayoutManager` to lay out text without a
+ * platform text stack, so that text can be measured deterministically in
+ * headless environments.
+ *
+ * The table is described by a JSON object of the form:
+ *
+ *   {
+ *     "defaultFamily": "Roboto",
+ *     "fonts": [
+ *       {
+ *         "family": "Roboto",
+ *         "weight": 400,
+ *         "ascender": 0.927,
+ *         "descender": -0.244,
+ *         "capHeight": 0.711,
+ *         "xHeight": 0.528,
+ *         "lineGap": 0,
+ *         "defaultAdvance": 0.55,
+ *         "advances": {"a": 0.543, "b": 0.561, " ": 0.248}
+ *       }
+ *     ]
+ *   }
+ *
+ * where all the metrics are in ems, the keys of "advances" are single UTF-8
+ * encoded characters, and every field but "family" is optional. Fonts are
+ * matched by family and then by the nearest weight. Unknown families use
+ * "defaultFamily" (or built-in metrics if the table has no such family).
+ *
+ * `TextLayoutManager` uses an instance registered in `ContextContainer` under
+ * `FontMetricsTable::ContextContainerKey` (as
+ * `std::shared_ptr<const FontMetricsTable>`), or built-in metrics otherwise.
+ */
+class FontMetricsTable final {
+ public:
+  static constexpr const char *ContextContainerKey = "FontMetricsTable";
+
+  /*
+   * Creates a table with built-in metrics only.
+   */
+  FontMetricsTable();
+
+  explicit FontMetricsTable(const folly::dynamic &data);
+
+  /*
+   * Loads the table from a JSON file. Returns a table with built-in metrics
+   * only if the file can't be read or parsed.
+   */
+  static std::shared_ptr<const FontMetricsTable> loadFromFile(const std::string &filePath);
+
+  const FontMetrics &getFontMetrics(const std::string &fontFamily, FontWeight fontWeight) const;
+
+ private:
+  using FontMetricsByWeight = std::vector<std::pair<int, FontMetrics>>;
+
+  const FontMetrics *findFontMetrics(const std::string &fontFamily, int weight) const;
+
+  std::unordered_map<std::string, FontMetricsByWeight> fonts_;
+  std::string defaultFamily_;
+  FontMetrics builtInFontMetrics_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextLayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+enum class GlyphKind {
+  Regular,
+  Whitespace,
+  LineBreak,
+  // Ideographs and attachments, which lines can break before and after.
+  Standalone,
+  // Characters which can't be separated from the preceding one.
+  Combining,
+};
+
+struct Glyph {
+  std::string_view text;
+  Float advance;
+  GlyphKind kind;
+  size_t fragmentIndex;
+};
+
+/*
+ * The vertical metrics of a fragment, in points.
+ */
+struct FragmentStyle {
+  Float ascender;
+  Float descender;
+  Float capHeight;
+  Float xHeight;
+  Float lineHeight;
+};
+
+struct LineRange {
+  size_t begin;
+  size_t end;
+};
+
+bool isWhitespace(char32_t character) {
+  return character == ' ' || character == '\t' || character == '\r' ||
+      character == 0x3000;
+}
+
+bool isLineBreak(char32_t character) {
+  return character == '\n' || character == 0x2028 || character == 0x2029;
+}
+
+bool isIdeographic(char32_t character) {
+  return (character >= 0x2E80 && character <= 0x9FFF) ||
+      (character >= 0xF900 && character <= 0xFAFF) ||
+      (character >= 0xFF00 && character <= 0xFFEF) ||
+      (character >= 0x20000 && character <= 0x3FFFF);
+}
+
+bool isCombining(char32_t character) {
+  return (character >= 0x0300 && character <= 0x036F) || character == 0x200D ||
+      (character >= 0xFE00 && character <= 0xFE0F) ||
+      (character >= 0x1F3FB && character <= 0x1F3FF);
+}
+
+GlyphKind glyphKind(char32_t character) {
+  if (isLineBreak(character)) {
+    return GlyphKind::LineBreak;
+  } else if (isWhitespace(character)) {
+    return GlyphKind::Whitespace;
+  } else if (isCombining(character)) {
+    return GlyphKind::Combining;
+  } else if (isIdeographic(character)) {
+    return GlyphKind::Standalone;
+  }
+  return GlyphKind::Regular;
+}
+
+Float fontSizeOf(const TextAttributes& textAttributes) {
+  auto fontSize = !std::isnan(textAttributes.fontSize)
+      ? textAttributes.fontSize
+      : TextAttributes::defaultTextAttributes().fontSize;
+  if (textAttributes.allowFontScaling.value_or(true) &&
+      !std::isnan(textAttributes.fontSizeMultiplier)) {
+    fontSize *= textAttributes.fontSizeMultiplier;
+  }
+  return fontSize;
+}
+
+/*
+ * Splits the fragments into glyphs (one per character or attachment) and
+ * computes the vertical metrics of each fragment.
+ */
+void shapeFragments(
+    const AttributedString::Fragments& fragments,
+    const FontMetricsTable& fontMetricsTable,
+    std::vector<Glyph>& glyphs,
+    std::vector<FragmentStyle>& styles) {
+  for (size_t fragmentIndex = 0; fragmentIndex < fragments.size();
+       fragmentIndex++) {
+    const auto& fragment = fragments[fragmentIndex];
+    const auto& textAttributes = fragment.textAttributes;
+    const auto& fontMetrics = fontMetricsTable.getFontMetrics(
+        textAttributes.fontFamily,
+        textAttributes.fontWeight.value_or(FontWeight::Regular));
+    auto fontSize = fontSizeOf(textAttributes);
+    auto lineHeight = !std::isnan(textAttributes.lineHeight)
+        ? textAttributes.lineHeight
+        : fontMetrics.getLineHeight() * fontSize;
+    auto letterSpacing = !std::isnan(textAttributes.letterSpacing)
+        ? textAttributes.letterSpacing
+        : 0;
+
+    if (fragment.isAttachment()) {
+      auto size = fragment.parentShadowView.layoutMetrics.frame.size;
+      glyphs.push_back(
+          Glyph{
+              .text = fragment.string,
+              .advance = size.width,
+              .kind = GlyphKind::Standalone,
+              .fragmentIndex = fragmentIndex});
+      styles.push_back(
+          FragmentStyle{
+              .ascender = size.height,
+              .descender = 0,
+              .capHeight = size.height,
+              .xHeight = size.height,
+              .lineHeight = size.height});
+      continue;
+    }
+
+    styles.push_back(
+        FragmentStyle{
+            .ascender = fontMetrics.ascender * fontSize,
+            .descender = fontMetrics.descender * fontSize,
+            .capHeight = fontMetrics.capHeight * fontSize,
+            .xHeight = fontMetrics.xHeight * fontSize,
+            .lineHeight = lineHeight});
+
+    auto string = std::string_view{fragment.string};
+    auto offset = size_t{0};
+    while (offset < string.size()) {
+      auto begin = offset;
+      auto character = decodeUtf8Character(string, offset);
+      auto kind = glyphKind(character);
+      auto advance = kind == GlyphKind::LineBreak
+          ? Float{0}
+          : fontMetrics.getAdvance(character) * fontSize + letterSpacing;
+      glyphs.push_back(
+          Glyph{
+              .text = string.substr(begin, offset - begin),
+              .advance = advance,
+              .kind = kind,
+              .fragmentIndex = fragmentIndex});
+    }
+  }
+}
+
+/*
+ * Breaks the glyphs into lines no wider than `maximumWidth` (unless a single
+ * character is wider).
+ */
+std::vector<LineRange> breakLines(
+    const std::vector<Glyph>& glyphs,
+    Float maximumWidth) {
+  auto lines = std::vector<LineRange>{};
+  auto lineBegin = size_t{0};
+  auto lineWidth = Float{0};
+  auto i = size_t{0};
+  while (i < glyphs.size()) {
+    if (glyphs[i].kind == GlyphKind::LineBreak) {
+      lines.push_back(LineRange{.begin = lineBegin, .end = i + 1});
+      lineBegin = i + 1;
+      lineWidth = 0;
+      i++;
+      continue;
+    }
+
+    // The next word and the whitespace after it.
+    auto wordEnd = i + 1;
+    if (glyphs[i].kind == GlyphKind::Regular ||
+        glyphs[i].kind == GlyphKind::Combining) {
+      while (wordEnd < glyphs.size() &&
+             (glyphs[wordEnd].kind == GlyphKind::Regular ||
+              glyphs[wordEnd].kind == GlyphKind::Combining)) {
+        wordEnd++;
+      }
+    } else {
+      while (wordEnd < glyphs.size() &&
+             glyphs[wordEnd].kind == GlyphKind::Combining) {
+        wordEnd++;
+      }
+    }
+    auto segmentEnd = wordEnd;
+    while (segmentEnd < glyphs.size() &&
+           glyphs[segmentEnd].kind == GlyphKind::Whitespace) {
+      segmentEnd++;
+    }
+
+    auto wordWidth = Float{0};
+    for (auto j = i; j < wordEnd; j++) {
+      wordWidth += glyphs[j].advance;
+    }
+    auto whitespaceWidth = Float{0};
+    for (auto j = wordEnd; j < segmentEnd; j++) {
+      whitespaceWidth += glyphs[j].advance;
+    }
+
+    if (lineBegin < i && lineWidth + wordWidth > maximumWidth) {
+      lines.push_back(LineRange{.begin = lineBegin, .end = i});
+      lineBegin = i;
+      lineWidth = 0;
+    }
+
+    if (lineBegin == i && wordWidth > maximumWidth) {
+      // The word doesn't fit on a line of its own, so it's broken between
+      // characters.
+      for (auto j = i; j < wordEnd; j++) {
+        if (j > lineBegin && glyphs[j].kind != GlyphKind::Combining &&
+            lineWidth + glyphs[j].advance > maximumWidth) {
+          lines.push_back(LineRange{.begin = lineBegin, .end = j});
+          lineBegin = j;
+          lineWidth = 0;
+        }
+        lineWidth += glyphs[j].advance;
+      }
+      lineWidth += whitespaceWidth;
+    } else {
+      lineWidth += wordWidth + whitespaceWidth;
+    }
+    i = segmentEnd;
+  }
+
+  if (lineBegin < glyphs.size() ||
+      (!glyphs.empty() && glyphs.back().kind == GlyphKind::LineBreak)) {
+    lines.push_back(LineRange{.begin = lineBegin, .end = glyphs.size()});
+  }
+  return lines;
+}
+
+} // namespace
+
+char32_t decodeUtf8Character(std::string_view string, size_t& offset) {
+  auto byte = static_cast<unsigned char>(string[offset]);
+  if (byte < 0x80) {
+    offset++;
+    return byte;
+  }
+
+  auto length = size_t{0};
+  auto character = char32_t{0};
+  if ((byte & 0xE0) == 0xC0) {
+    length = 2;
+    character = byte & 0x1F;
+  } else if ((byte & 0xF0) == 0xE0) {
+    length = 3;
+    character = byte & 0x0F;
+  } else if ((byte & 0xF8) == 0xF0) {
+    length = 4;
+    character = byte & 0x07;
+  } else {
+    offset++;
+    return kReplacementCharacter;
+  }
+
+  if (offset + length > string.size()) {
+    offset++;
+    return kReplacementCharacter;
+  }
+  for (size_t i = 1; i < length; i++) {
+    auto continuation = static_cast<unsigned char>(string[offset + i]);
+    if ((continuation & 0xC0) != 0x80) {
+      offset++;
+      return kReplacementCharacter;
+    }
+    character = (character << 6) | (continuation & 0x3F);
+  }
+  offset += length;
+  return character;
+}
+
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    const FontMetricsTable& fontMetricsTable,
+    Float maximumWidth,
+    Float minimumWidth) {
+  const auto& fragments = attributedString.getFragments();
+
+  auto glyphs = std::vector<Glyph>{};
+  auto styles = std::vector<FragmentStyle>{};
+  styles.reserve(fragments.size());
+  shapeFragments(fragments, fontMetricsTable, glyphs, styles);
+
+  auto lineRanges = breakLines(glyphs, maximumWidth);
+  auto numberOfLines = lineRanges.size();
+  if (paragraphAttributes.maximumNumberOfLines > 0) {
+    numberOfLines = std::min(
+        numberOfLines,
+        static_cast<size_t>(paragraphAttributes.maximumNumberOfLines));
+  }
+
+  auto layout = TextLayout{};
+  layout.lines.reserve(numberOfLines);
+
+  // The widths of the lines, without trailing whitespace, and the positions
+  // of the attachments within them.
+  auto lineWidths = std::vector<Float>(numberOfLines);
+  auto attachmentPositions = std::vector<std::pair<size_t, Point>>{};
+  auto top = Float{0};
+  for (size_t lineIndex = 0; lineIndex < numberOfLines; lineIndex++) {
+    auto [begin, end] = lineRanges[lineIndex];
+
+    auto text = std::string{};
+    auto x = Float{0};
+    auto width = Float{0};
+    auto ascender = Float{0};
+    auto descender = Float{0};
+    auto capHeight = Float{0};
+    auto xHeight = Float{0};
+    auto height = Float{0};
+    for (auto i = begin; i < end; i++) {
+      const auto& glyph = glyphs[i];
+      const auto& style = styles[glyph.fragmentIndex];
+      text.append(glyph.text);
+      ascender = std::max(ascender, style.ascender);
+      descender = std::min(descender, style.descender);
+      capHeight = std::max(capHeight, style.capHeight);
+      xHeight = std::max(xHeight, style.xHeight);
+      height = std::max(height, style.lineHeight);
+      if (fragments[glyph.fragmentIndex].isAttachment()) {
+        attachmentPositions.emplace_back(lineIndex, Point{.x = x, .y = top});
+      }
+      x += glyph.advance;
+      if (glyph.kind != GlyphKind::Whitespace &&
+          glyph.kind != GlyphKind::LineBreak) {
+        width = x;
+      }
+    }
+    if (begin == end && !glyphs.empty()) {
+      // The empty line after a trailing line break.
+      const auto& style = styles[glyphs.back().fragmentIndex];
+      ascender = style.ascender;
+      descender = style.descender;
+      capHeight = style.capHeight;
+      xHeight = style.xHeight;
+      height = style.lineHeight;
+    }
+    height = std::max(height, ascender - descender);
+
+    lineWidths[lineIndex] = width;
+    layout.size.width = std::max(layout.size.width, width);
+    layout.lines.emplace_back(
+        std::move(text),
+        Rect{
+            .origin = {.x = 0, .y = top},
+            .size = {.width = width, .height = height}},
+        -descender,
+        capHeight,
+        ascender,
+        xHeight);
+    top += height;
+  }
+  layout.size.height = top;
+
+  // Aligning the lines within the width the text is measured at (see
+  // `LayoutConstraints::clamp`), so that they stay within its frame.
+  auto alignment = fragments.empty()
+      ? TextAlignment::Natural
+      : fragments.front().textAttributes.alignment.value_or(
+            TextAlignment::Natural);
+  auto alignmentWidth =
+      std::max(minimumWidth, std::min(maximumWidth, layout.size.width));
+  for (size_t lineIndex = 0; lineIndex < numberOfLines; lineIndex++) {
+    auto& frame = layout.lines[lineIndex].frame;
+    if (alignment == TextAlignment::Center) {
+      frame.origin.x = (alignmentWidth - lineWidths[lineIndex]) / 2;
+    } else if (alignment == TextAlignment::Right) {
+      frame.origin.x = alignmentWidth - lineWidths[lineIndex];
+    }
+  }
+
+  // Placing the attachments on the baselines of their lines.
+  auto nextAttachmentPosition = attachmentPositions.begin();
+  for (const auto& fragment : fragments) {
+    if (!fragment.isAttachment()) {
+      continue;
+    }
+    if (nextAttachmentPosition == attachmentPositions.end()) {
+      layout.attachments.push_back(
+          TextMeasurement::Attachment{.frame = Rect{}, .isClipped = true});
+      continue;
+    }
+    auto [lineIndex, position] = *nextAttachmentPosition++;
+    const auto& line = layout.lines[lineIndex];
+    auto size = fragment.parentShadowView.layoutMetrics.frame.size;
+    auto baseline = line.frame.origin.y +
+        (line.frame.size.height - (line.ascender + line.descender)) / 2 +
+        line.ascender;
+    layout.attachments.push_back(
+        TextMeasurement::Attachment{
+            .frame =
+                {.origin =
+                     {.x = line.frame.origin.x + position.x,
+                      .y = baseline - size.height},
+                 .size = size},
+            .isClipped = false});
+  }
+
+  return layout;
+}
+
+} // namespace facebook::react
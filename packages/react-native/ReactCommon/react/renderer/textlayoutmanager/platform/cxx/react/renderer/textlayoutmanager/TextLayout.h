@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/graphics/Size.h>
+#include <react/renderer/textlayoutmanager/FontMetrics.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+namespace facebook::react {
+
+/*
+ * Text laid out into lines.
+ */
+struct TextLayout {
+  LinesMeasurements lines;
+  TextMeasurement::Attachments attachments;
+  Size size;
+};
+
+/*
+ * Lays out `attributedString` into lines no wider than `maximumWidth`, using
+ * the advances and vertical metrics of `fontMetricsTable`.
+ *
+ * Lines are broken greedily: after whitespace, around ideographs and
+ * attachments, and at hard line breaks. Words wider than a line are broken
+ * between characters. Trailing whitespace doesn't count towards the width of a
+ * line. Only the first `paragraphAttributes.maximumNumberOfLines` lines are
+ * kept (if it's positive); attachments on the other lines are clipped.
+ *
+ * Lines (and their attachments) are aligned within the width the text ends up
+ * measured at: the widest line, clamped between `minimumWidth` and
+ * `maximumWidth`.
+ */
+TextLayout layoutText(
+    const AttributedString &attributedString,
+    const ParagraphAttributes &paragraphAttributes,
+    const FontMetricsTable &fontMetricsTable,
+    Float maximumWidth,
+    Float minimumWidth = 0);
+
+/*
+ * Decodes the UTF-8 encoded character at `offset` in `string`, and moves
+ * `offset` past it. Malformed bytes are decoded one at a time as U+FFFD.
+ */
+char32_t decodeUtf8Character(std::string_view string, size_t &offset);
+
+} // namespace facebook::react
@@ -7,33 +7,91 @@
 
 #include "TextLayoutManager.h"
 
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+
 namespace facebook::react {
 
 TextLayoutManager::TextLayoutManager(
-    const std::shared_ptr<const ContextContainer>& /*contextContainer*/)
-    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+    const std::shared_ptr<const ContextContainer>& contextContainer)
+    : contextContainer_(contextContainer),
+      fontMetricsTable_(
+          contextContainer != nullptr
+              ? contextContainer
+                    ->find<std::shared_ptr<const FontMetricsTable>>(
+                        FontMetricsTable::ContextContainerKey)
+                    .value_or(nullptr)
+              : nullptr),
+      textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      persistentTextMeasureCache_(
+          contextContainer != nullptr
+              ? contextContainer
+                    ->find<std::shared_ptr<PersistentTextMeasureCache>>(
+                        PersistentTextMeasureCache::ContextContainerKey)
+                    .value_or(nullptr)
+              : nullptr) {
+  if (fontMetricsTable_ == nullptr) {
+    fontMetricsTable_ = std::make_shared<const FontMetricsTable>();
+  }
+}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
-    const ParagraphAttributes& /*paragraphAttributes*/,
+    const ParagraphAttributes& paragraphAttributes,
     const TextLayoutContext& /*layoutContext*/,
     const LayoutConstraints& layoutConstraints) const {
-  TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{
-              .frame =
-                  {.origin = {.x = 0, .y = 0},
-                   .size = {.width = 0, .height = 0}},
-              .isClipped = false});
+  auto& attributedString = attributedStringBox.getValue();
+
+  auto key = TextMeasureCacheKey{
+      .attributedString = attributedString,
+      .paragraphAttributes = paragraphAttributes,
+      .layoutConstraints = layoutConstraints};
+
+  return textMeasureCache_.get(key, [&]() {
+    if (persistentTextMeasureCache_ != nullptr) {
+      if (auto measurement = persistentTextMeasureCache_->find(key)) {
+        return *measurement;
+      }
     }
-  }
-  return TextMeasurement{
-      .size =
-          {.width = layoutConstraints.minimumSize.width,
-           .height = layoutConstraints.minimumSize.height},
-      .attachments = attachments};
+
+    auto layout = layoutText(
+        attributedString,
+        paragraphAttributes,
+        *fontMetricsTable_,
+        layoutConstraints.maximumSize.width,
+        layoutConstraints.minimumSize.width);
+    auto measurement = TextMeasurement{
+        .size = layoutConstraints.clamp(layout.size),
+        .attachments = std::move(layout.attachments)};
+
+    if (persistentTextMeasureCache_ != nullptr) {
+      persistentTextMeasureCache_->store(key, measurement);
+    }
+    return measurement;
+  });
+}
+
+LinesMeasurements TextLayoutManager::measureLines(
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  react_native_assert(
+      attributedStringBox.getMode() == AttributedStringBox::Mode::Value);
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return lineMeasureCache_.get(
+      {.attributedString = attributedString,
+       .paragraphAttributes = paragraphAttributes,
+       .size = size},
+      [&]() {
+        return layoutText(
+                   attributedString,
+                   paragraphAttributes,
+                   *fontMetricsTable_,
+                   size.width,
+                   size.width)
+            .lines;
+      });
 }
 
 } // namespace facebook::react
@@ -10,6 +10,8 @@
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/FontMetrics.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
@@ -22,6 +24,9 @@ class TextLayoutManager;
 /*
  * Cross platform facade for text measurement (e.g. Android-specific
  * TextLayoutManager)
+ *
+ * Lays out text with the font metrics of a `FontMetricsTable`, which gives
+ * deterministic measurements where there's no platform text stack.
  */
 class TextLayoutManager {
  public:
@@ -49,9 +54,20 @@ class TextLayoutManager {
       const TextLayoutContext &layoutContext,
       const LayoutConstraints &layoutConstraints) const;
 
+  /*
+   * Measures lines of `attributedString` laid out within `size`.
+   */
+  LinesMeasurements measureLines(
+      const AttributedStringBox &attributedStringBox,
+      const ParagraphAttributes &paragraphAttributes,
+      const Size &size) const;
+
  protected:
   std::shared_ptr<const ContextContainer> contextContainer_;
+  std::shared_ptr<const FontMetricsTable> fontMetricsTable_;
   TextMeasureCache textMeasureCache_;
+  LineMeasureCache lineMeasureCache_;
+  std::shared_ptr<PersistentTextMeasureCache> persistentTextMeasureCache_;
 };
 
 } // namespace facebook::react
@@ -10,6 +10,7 @@
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
@@ -65,6 +66,7 @@ class TextLayoutManager {
   std::shared_ptr<const ContextContainer> contextContainer_;
   std::shared_ptr<void> nativeTextLayoutManager_;
   TextMeasureCache textMeasureCache_;
+  std::shared_ptr<PersistentTextMeasureCache> persistentTextMeasureCache_;
   LineMeasureCache lineMeasureCache_;
 };
 
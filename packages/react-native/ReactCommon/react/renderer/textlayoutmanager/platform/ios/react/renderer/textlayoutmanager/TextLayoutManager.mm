@@ -14,9 +14,15 @@
 
 namespace facebook::react {
 
-TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> & /*contextContainer*/)
+TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> &contextContainer)
 {
   nativeTextLayoutManager_ = wrapManagedObject([RCTTextLayoutManager new]);
+  if (contextContainer != nullptr) {
+    persistentTextMeasureCache_ = contextContainer
+                                      ->find<std::shared_ptr<PersistentTextMeasureCache>>(
+                                          PersistentTextMeasureCache::ContextContainerKey)
+                                      .value_or(nullptr);
+  }
 }
 
 std::shared_ptr<void> TextLayoutManager::getNativeTextLayoutManager() const
@@ -39,27 +45,38 @@ TextMeasurement TextLayoutManager::measure(
     case AttributedStringBox::Mode::Value: {
       auto attributedString = ensurePlaceholderIfEmpty_DO_NOT_USE(attributedStringBox.getValue());
 
-      measurement = textMeasureCache_.get(
-          {.attributedString = attributedString,
-           .paragraphAttributes = paragraphAttributes,
-           .layoutConstraints = layoutConstraints},
-          [&]() {
-            auto telemetry = TransactionTelemetry::threadLocalTelemetry();
-            if (telemetry) {
-              telemetry->willMeasureText();
-            }
-
-            auto measurement = [textLayoutManager measureAttributedString:attributedString
-                                                      paragraphAttributes:paragraphAttributes
-                                                            layoutContext:layoutContext
-                                                        layoutConstraints:layoutConstraints];
+      auto key = TextMeasureCacheKey{
+          .attributedString = attributedString,
+          .paragraphAttributes = paragraphAttributes,
+          .layoutConstraints = layoutConstraints};
+
+      measurement = textMeasureCache_.get(key, [&]() {
+        if (persistentTextMeasureCache_ != nullptr) {
+          if (auto measurement = persistentTextMeasureCache_->find(key)) {
+            return *measurement;
+          }
+        }
+
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry) {
+          telemetry->willMeasureText();
+        }
 
-            if (telemetry) {
-              telemetry->didMeasureText();
-            }
+        auto measurement = [textLayoutManager measureAttributedString:attributedString
+                                                  paragraphAttributes:paragraphAttributes
+                                                        layoutContext:layoutContext
+                                                    layoutConstraints:layoutConstraints];
 
-            return measurement;
-          });
+        if (telemetry) {
+          telemetry->didMeasureText();
+        }
+
+        if (persistentTextMeasureCache_ != nullptr) {
+          persistentTextMeasureCache_->store(key, measurement);
+        }
+
+        return measurement;
+      });
       break;
     }
 
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
+
+using namespace facebook::react;
+
+namespace {
+
+std::string temporaryFilePath(const std::string& name) {
+  auto path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove(path);
+  return path.string();
+}
+
+TextMeasureCacheKey cacheKeyForString(const std::string& string) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  fragment.textAttributes.fontSize = 14;
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(std::move(fragment));
+  return TextMeasureCacheKey{
+      .attributedString = attributedString,
+      .paragraphAttributes = {},
+      .layoutConstraints = {.maximumSize = {.width = 320, .height = 1000}}};
+}
+
+TextMeasurement measurementWithSize(Float width, Float height) {
+  return TextMeasurement{
+      .size = {.width = width, .height = height}, .attachments = {}};
+}
+
+} // namespace
+
+TEST(PersistentTextMeasureCacheTest, entriesSurviveReloading) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_reload");
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("Hello"), measurementWithSize(40, 17));
+    cache.store(cacheKeyForString("World"), measurementWithSize(42, 17));
+    EXPECT_EQ(cache.size(), 2);
+  }
+
+  auto cache = PersistentTextMeasureCache{path, 1, 1};
+  EXPECT_EQ(cache.size(), 2);
+
+  auto measurement = cache.find(cacheKeyForString("Hello"));
+  ASSERT_TRUE(measurement.has_value());
+  EXPECT_EQ(measurement->size.width, 40);
+  EXPECT_EQ(measurement->size.height, 17);
+
+  EXPECT_FALSE(cache.find(cacheKeyForString("Missing")).has_value());
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, entriesAreAppendedIncrementally) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_append");
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("First"), measurementWithSize(30, 17));
+  }
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("Second"), measurementWithSize(50, 17));
+    cache.flush();
+  }
+
+  auto cache = PersistentTextMeasureCache{path, 1, 1};
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_TRUE(cache.find(cacheKeyForString("First")).has_value());
+  EXPECT_TRUE(cache.find(cacheKeyForString("Second")).has_value());
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, batchesAreWrittenOnFlushExecutor) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_executor");
+
+  auto tasks = std::vector<std::function<void()>>{};
+  auto flushExecutor = [&](std::function<void()>&& task) {
+    tasks.push_back(std::move(task));
+  };
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1, flushExecutor};
+    // A full batch (of 256 entries) schedules a single flush.
+    for (int index = 0; index < 300; index++) {
+      cache.store(
+          cacheKeyForString(std::to_string(index)),
+          measurementWithSize(index, 17));
+    }
+    ASSERT_EQ(tasks.size(), 1);
+    EXPECT_FALSE(std::filesystem::exists(path));
+
+    tasks.front()();
+    EXPECT_EQ(PersistentTextMeasureCache(path, 1, 1).size(), 300);
+
+    cache.store(cacheKeyForString("Hello"), measurementWithSize(40, 17));
+    cache.setFontScale(1.5);
+    ASSERT_EQ(tasks.size(), 2);
+  }
+
+  // The flush scheduled by the destroyed cache still runs safely.
+  tasks.back()();
+
+  EXPECT_EQ(PersistentTextMeasureCache(path, 1, 1.5).size(), 0);
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, fontConfigurationChangeDiscardsEntries) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_fonts");
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("Hello"), measurementWithSize(40, 17));
+  }
+
+  auto cache = PersistentTextMeasureCache{path, 2, 1};
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.find(cacheKeyForString("Hello")).has_value());
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, fontScaleChangeDiscardsEntries) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_scale");
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("Hello"), measurementWithSize(40, 17));
+    cache.setFontScale(1.5);
+    EXPECT_EQ(cache.size(), 0);
+    cache.store(cacheKeyForString("World"), measurementWithSize(63, 25));
+  }
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1.5};
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_TRUE(cache.find(cacheKeyForString("World")).has_value());
+  }
+
+  EXPECT_EQ(PersistentTextMeasureCache(path, 1, 1).size(), 0);
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, truncatedFileKeepsCompleteRecords) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_truncated");
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    cache.store(cacheKeyForString("Hello"), measurementWithSize(40, 17));
+    cache.store(cacheKeyForString("World"), measurementWithSize(42, 17));
+  }
+
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+  {
+    auto cache = PersistentTextMeasureCache{path, 1, 1};
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_TRUE(cache.find(cacheKeyForString("Hello")).has_value());
+  }
+
+  // The file is rewritten without the partial record.
+  auto cache = PersistentTextMeasureCache{path, 1, 1};
+  EXPECT_EQ(cache.size(), 1);
+  cache.store(cacheKeyForString("World"), measurementWithSize(42, 17));
+  cache.flush();
+  EXPECT_EQ(PersistentTextMeasureCache(path, 1, 1).size(), 2);
+
+  std::filesystem::remove(path);
+}
+
+TEST(PersistentTextMeasureCacheTest, measurementsWithAttachmentsAreSkipped) {
+  auto path = temporaryFilePath("PersistentTextMeasureCacheTest_attachments");
+
+  auto cache = PersistentTextMeasureCache{path, 1, 1};
+  auto measurement = measurementWithSize(40, 17);
+  measurement.attachments.push_back({.frame = {}, .isClipped = false});
+  cache.store(cacheKeyForString("Hello"), measurement);
+  EXPECT_EQ(cache.size(), 0);
+
+  std::filesystem::remove(path);
+}
@@ -5,14 +5,245 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include <folly/dynamic.h>
 #include <gtest/gtest.h>
 
+#include <react/renderer/textlayoutmanager/TextLayout.h>
 #include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/utils/ContextContainer.h>
 
 using namespace facebook::react;
 
-TEST(TextLayoutManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+/*
+ * With a font size of 10, every character is 5 points wide (but "é", which is
+ * 10 points wide), and lines are 10 points high with the baseline at 8.
+ */
+std::shared_ptr<const FontMetricsTable> createFontMetricsTable() {
+  return std::make_shared<const FontMetricsTable>(
+      folly::dynamic::object("defaultFamily", "Test")(
+          "fonts",
+          folly::dynamic::array(
+              folly::dynamic::object("family", "Test")("weight", 400)(
+                  "ascender", 0.8)("descender", -0.2)("capHeight", 0.7)(
+                  "xHeight", 0.5)("defaultAdvance", 0.5)(
+                  "advances", folly::dynamic::object("é", 1.0)))));
+}
+
+AttributedString::Fragment textFragment(const std::string& string) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = string;
+  fragment.textAttributes.fontSize = 10;
+  return fragment;
+}
+
+AttributedString::Fragment attachmentFragment(Float width, Float height) {
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = AttributedString::Fragment::AttachmentCharacter();
+  fragment.textAttributes.fontSize = 10;
+  fragment.parentShadowView.layoutMetrics.frame.size = {
+      .width = width, .height = height};
+  return fragment;
+}
+
+AttributedString attributedStringWithFragments(
+    std::vector<AttributedString::Fragment> fragments) {
+  auto attributedString = AttributedString{};
+  for (auto& fragment : fragments) {
+    attributedString.appendFragment(std::move(fragment));
+  }
+  return attributedString;
+}
+
+TextLayout layout(
+    const AttributedString& attributedString,
+    Float maximumWidth,
+    int maximumNumberOfLines = 0,
+    Float minimumWidth = 0) {
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = maximumNumberOfLines;
+  return layoutText(
+      attributedString,
+      paragraphAttributes,
+      *createFontMetricsTable(),
+      maximumWidth,
+      minimumWidth);
+}
+
+} // namespace
+
+TEST(TextLayoutManagerTest, linesBreakAfterWhitespace) {
+  auto textLayout = layout(
+      attributedStringWithFragments({textFragment("aaaa bbbb cccc")}), 50);
+
+  ASSERT_EQ(textLayout.lines.size(), 2);
+  EXPECT_EQ(textLayout.lines[0].text, "aaaa bbbb ");
+  EXPECT_EQ(textLayout.lines[0].frame.size.width, 45);
+  EXPECT_EQ(textLayout.lines[1].text, "cccc");
+  EXPECT_EQ(textLayout.lines[1].frame.origin.y, 10);
+  EXPECT_EQ(textLayout.lines[1].frame.size.width, 20);
+  EXPECT_FLOAT_EQ(textLayout.lines[0].ascender, 8);
+  EXPECT_FLOAT_EQ(textLayout.lines[0].descender, 2);
+  EXPECT_EQ(textLayout.size.width, 45);
+  EXPECT_EQ(textLayout.size.height, 20);
+}
+
+TEST(TextLayoutManagerTest, longWordsBreakBetweenCharacters) {
+  auto textLayout = layout(
+      attributedStringWithFragments({textFragment("aaaaaaaaaaaa")}), 25);
+
+  ASSERT_EQ(textLayout.lines.size(), 3);
+  EXPECT_EQ(textLayout.lines[0].text, "aaaaa");
+  EXPECT_EQ(textLayout.lines[1].text, "aaaaa");
+  EXPECT_EQ(textLayout.lines[2].text, "aa");
+  EXPECT_EQ(textLayout.size.width, 25);
+}
+
+TEST(TextLayoutManagerTest, lineBreaksStartNewLines) {
+  auto textLayout =
+      layout(attributedStringWithFragments({textFragment("ab\ncd\n")}), 100);
+
+  ASSERT_EQ(textLayout.lines.size(), 3);
+  EXPECT_EQ(textLayout.lines[0].text, "ab\n");
+  EXPECT_EQ(textLayout.lines[1].text, "cd\n");
+  EXPECT_EQ(textLayout.lines[2].text, "");
+  EXPECT_EQ(textLayout.size.height, 30);
+}
+
+TEST(TextLayoutManagerTest, numberOfLinesLimitsLines) {
+  auto textLayout = layout(
+      attributedStringWithFragments({textFragment("aaaa bbbb cccc")}), 50, 1);
+
+  ASSERT_EQ(textLayout.lines.size(), 1);
+  EXPECT_EQ(textLayout.size.width, 45);
+  EXPECT_EQ(textLayout.size.height, 10);
+}
+
+TEST(TextLayoutManagerTest, linesAreAlignedWithinMeasuredWidth) {
+  // The text is measured at the width of its widest line, and the lines are
+  // aligned within it.
+  auto fragment = textFragment("aaaa bbbb cccc");
+  fragment.textAttributes.alignment = TextAlignment::Center;
+  auto textLayout = layout(attributedStringWithFragments({fragment}), 50);
+
+  ASSERT_EQ(textLayout.lines.size(), 2);
+  EXPECT_EQ(textLayout.lines[0].frame.origin.x, 0);
+  EXPECT_EQ(textLayout.lines[1].frame.origin.x, 12.5);
+  EXPECT_EQ(textLayout.size.width, 45);
+
+  fragment.textAttributes.alignment = TextAlignment::Right;
+  textLayout = layout(attributedStringWithFragments({fragment}), 50);
+
+  ASSERT_EQ(textLayout.lines.size(), 2);
+  EXPECT_EQ(textLayout.lines[0].frame.origin.x, 0);
+  EXPECT_EQ(textLayout.lines[1].frame.origin.x, 25);
+
+  // Unless the minimum width is wider.
+  textLayout = layout(attributedStringWithFragments({fragment}), 50, 0, 50);
+
+  ASSERT_EQ(textLayout.lines.size(), 2);
+  EXPECT_EQ(textLayout.lines[0].frame.origin.x, 5);
+  EXPECT_EQ(textLayout.lines[1].frame.origin.x, 30);
+
+  // Without a maximum width, the lines are aligned within the widest one.
+  fragment.string = "aaaa\nbb";
+  textLayout = layout(
+      attributedStringWithFragments({fragment}),
+      std::numeric_limits<Float>::infinity());
+
+  ASSERT_EQ(textLayout.lines.size(), 2);
+  EXPECT_EQ(textLayout.lines[0].frame.origin.x, 0);
+  EXPECT_EQ(textLayout.lines[1].frame.origin.x, 10);
+}
+
+TEST(TextLayoutManagerTest, alignedAttachmentsStayWithinMeasuredWidth) {
+  auto fragment = textFragment("aa");
+  fragment.textAttributes.alignment = TextAlignment::Right;
+  auto textLayout = layout(
+      attributedStringWithFragments({fragment, attachmentFragment(20, 10)}),
+      100);
+
+  ASSERT_EQ(textLayout.attachments.size(), 1);
+  EXPECT_EQ(textLayout.size.width, 30);
+  EXPECT_EQ(textLayout.attachments[0].frame.origin.x, 10);
+  EXPECT_LE(
+      textLayout.attachments[0].frame.origin.x +
+          textLayout.attachments[0].frame.size.width,
+      textLayout.size.width);
+}
+
+TEST(TextLayoutManagerTest, letterSpacingWidensCharacters) {
+  auto fragment = textFragment("ab");
+  fragment.textAttributes.letterSpacing = 1;
+  auto textLayout = layout(attributedStringWithFragments({fragment}), 100);
+
+  EXPECT_EQ(textLayout.size.width, 12);
+}
+
+TEST(TextLayoutManagerTest, charactersAreDecodedFromUtf8) {
+  auto textLayout =
+      layout(attributedStringWithFragments({textFragment("éa")}), 100);
+
+  ASSERT_EQ(textLayout.lines.size(), 1);
+  EXPECT_EQ(textLayout.lines[0].text, "éa");
+  EXPECT_EQ(textLayout.size.width, 15);
+}
+
+TEST(TextLayoutManagerTest, attachmentsSitOnTheBaseline) {
+  auto textLayout = layout(
+      attributedStringWithFragments(
+          {textFragment("aa"), attachmentFragment(20, 30), textFragment("bb")}),
+      100);
+
+  ASSERT_EQ(textLayout.lines.size(), 1);
+  EXPECT_EQ(textLayout.lines[0].frame.size.height, 32);
+  ASSERT_EQ(textLayout.attachments.size(), 1);
+  EXPECT_FALSE(textLayout.attachments[0].isClipped);
+  EXPECT_EQ(textLayout.attachments[0].frame.origin.x, 10);
+  EXPECT_EQ(textLayout.attachments[0].frame.origin.y, 0);
+  EXPECT_EQ(textLayout.attachments[0].frame.size.width, 20);
+  EXPECT_EQ(textLayout.size.width, 40);
+}
+
+TEST(TextLayoutManagerTest, attachmentsOnTruncatedLinesAreClipped) {
+  auto textLayout = layout(
+      attributedStringWithFragments(
+          {textFragment("aaaa"), attachmentFragment(20, 10)}),
+      25,
+      1);
+
+  ASSERT_EQ(textLayout.lines.size(), 1);
+  ASSERT_EQ(textLayout.attachments.size(), 1);
+  EXPECT_TRUE(textLayout.attachments[0].isClipped);
+}
+
+TEST(TextLayoutManagerTest, measureUsesFontMetricsFromContextContainer) {
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      FontMetricsTable::ContextContainerKey, createFontMetricsTable());
+  auto textLayoutManager = TextLayoutManager{contextContainer};
+  auto attributedString =
+      attributedStringWithFragments({textFragment("aaaa bbbb cccc")});
+
+  auto measurement = textLayoutManager.measure(
+      AttributedStringBox{attributedString},
+      {},
+      {},
+      {.minimumSize = {.width = 0, .height = 0},
+       .maximumSize = {.width = 50, .height = 1000}});
+  EXPECT_EQ(measurement.size.width, 45);
+  EXPECT_EQ(measurement.size.height, 20);
+
+  auto lines = textLayoutManager.measureLines(
+      AttributedStringBox{attributedString},
+      {},
+      {.width = 50, .height = 1000});
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[1].text, "cccc");
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/utils/ContextContainer.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kStringCount = 2000;
+
+static std::vector<AttributedStringBox> createAttributedStrings() {
+  auto attributedStrings = std::vector<AttributedStringBox>{};
+  attributedStrings.reserve(kStringCount);
+  for (int i = 0; i < kStringCount; i++) {
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = "Item number " + std::to_string(i) +
+        " with a label long enough to be wrapped over several lines";
+    fragment.textAttributes.fontSize = 14;
+    auto attributedString = AttributedString{};
+    attributedString.appendFragment(std::move(fragment));
+    attributedStrings.emplace_back(attributedString);
+  }
+  return attributedStrings;
+}
+
+auto attributedStrings = createAttributedStrings();
+auto cacheFilePath =
+    (std::filesystem::temp_directory_path() / "TextLayoutManagerBenchmark")
+        .string();
+
+/*
+ * Simulates the first screen of an app launch: a new `TextLayoutManager`
+ * measures every string once.
+ */
+static void measureOnColdStart(
+    const std::shared_ptr<const ContextContainer>& contextContainer) {
+  auto layoutConstraints =
+      LayoutConstraints{.maximumSize = {.width = 320, .height = 10000}};
+
+  auto textLayoutManager = TextLayoutManager{contextContainer};
+  for (const auto& attributedString : attributedStrings) {
+    benchmark::DoNotOptimize(textLayoutManager.measure(
+        attributedString, {}, {}, layoutConstraints));
+  }
+}
+
+static void coldStartWithoutPersistentCache(benchmark::State& state) {
+  for (auto _ : state) {
+    measureOnColdStart(std::make_shared<const ContextContainer>());
+  }
+
+  state.SetItemsProcessed(state.iterations() * kStringCount);
+}
+BENCHMARK(coldStartWithoutPersistentCache);
+
+static void coldStartWithPersistentCache(benchmark::State& state) {
+  std::filesystem::remove(cacheFilePath);
+
+  // Populating the cache file as a previous launch would.
+  {
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        PersistentTextMeasureCache::ContextContainerKey,
+        std::make_shared<PersistentTextMeasureCache>(cacheFilePath, 1, 1));
+    measureOnColdStart(contextContainer);
+  }
+
+  for (auto _ : state) {
+    // Loading the file is a part of the launch.
+    auto contextContainer = std::make_shared<ContextContainer>();
+    contextContainer->insert(
+        PersistentTextMeasureCache::ContextContainerKey,
+        std::make_shared<PersistentTextMeasureCache>(cacheFilePath, 1, 1));
+    measureOnColdStart(contextContainer);
+  }
+
+  state.SetItemsProcessed(state.iterations() * kStringCount);
+  std::filesystem::remove(cacheFilePath);
+}
+BENCHMARK(coldStartWithPersistentCache);
+
+static void measureLinesOnColdStart(benchmark::State& state) {
+  auto size = Size{.width = 320, .height = 10000};
+  for (auto _ : state) {
+    auto textLayoutManager =
+        TextLayoutManager{std::make_shared<const ContextContainer>()};
+    for (const auto& attributedString : attributedStrings) {
+      benchmark::DoNotOptimize(
+          textLayoutManager.measureLines(attributedString, {}, size));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kStringCount);
+}
+BENCHMARK(measureLinesOnColdStart);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -188,6 +188,33 @@ void UIManager::completeSurface(
     ShadowTree::CommitOptions commitOptions) {
   TraceSection s("UIManager::completeSurface", "surfaceId", surfaceId);
 
+  if (commitPipeline_) {
+    // The captured revision is stale now, the next read from JavaScript waits
+    // for this commit and captures its result.
+    lazyShadowTreeRevisionConsistencyManager_->invalidateCurrentRevision(
+        surfaceId);
+    commitPipeline_->enqueue(
+        surfaceId, [this, surfaceId, rootChildren, commitOptions]() {
+          commitSurface(surfaceId, rootChildren, commitOptions);
+        });
+    return;
+  }
+
+  auto rootShadowNode = commitSurface(surfaceId, rootChildren, commitOptions);
+  if (rootShadowNode) {
+    // It's safe to update the visible revision of the shadow tree immediately
+    // after we commit a specific one.
+    lazyShadowTreeRevisionConsistencyManager_->updateCurrentRevision(
+        surfaceId, std::move(rootShadowNode));
+  }
+}
+
+RootShadowNode::Shared UIManager::commitSurface(
+    SurfaceId surfaceId,
+    const ShadowNode::UnsharedListOfShared& rootChildren,
+    const ShadowTree::CommitOptions& commitOptions) const {
+  auto rootShadowNode = RootShadowNode::Shared{};
+
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
     auto result = shadowTree.commit(
         [&](const RootShadowNode& oldRootShadowNode) {
@@ -201,10 +228,7 @@ void UIManager::completeSurface(
         commitOptions);
 
     if (result == ShadowTree::CommitStatus::Succeeded) {
-      // It's safe to update the visible revision of the shadow tree immediately
-      // after we commit a specific one.
-      lazyShadowTreeRevisionConsistencyManager_->updateCurrentRevision(
-          surfaceId, shadowTree.getCurrentRevision().rootShadowNode);
+      rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
 
       if (ReactNativeFeatureFlags::useSharedAnimatedBackend()) {
         if (auto animationBackend = animationBackend_.lock()) {
@@ -213,6 +237,29 @@ void UIManager::completeSurface(
       }
     }
   });
+
+  return rootShadowNode;
+}
+
+void UIManager::setBackgroundCommitExecutor(
+    BackgroundExecutor backgroundExecutor) {
+  if (!backgroundExecutor) {
+    commitPipeline_ = nullptr;
+    lazyShadowTreeRevisionConsistencyManager_->setWillResolveRevisionCallback(
+        nullptr);
+    return;
+  }
+
+  commitPipeline_ =
+      std::make_unique<UIManagerCommitPipeline>(std::move(backgroundExecutor));
+  lazyShadowTreeRevisionConsistencyManager_->setWillResolveRevisionCallback(
+      [this](SurfaceId surfaceId) { flushBackgroundCommits(surfaceId); });
+}
+
+void UIManager::flushBackgroundCommits(SurfaceId surfaceId) const {
+  if (commitPipeline_) {
+    commitPipeline_->flush(surfaceId);
+  }
 }
 
 void UIManager::setIsJSResponder(
@@ -274,6 +321,9 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   // Stop any ongoing animations.
   stopSurfaceForAnimationDelegate(surfaceId);
 
+  // Letting the scheduled commits of the surface finish first.
+  flushBackgroundCommits(surfaceId);
+
   // Waiting for all concurrent commits to be finished and unregistering the
   // `ShadowTree`.
   auto shadowTree = getShadowTreeRegistry().remove(surfaceId);
@@ -295,6 +345,8 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
 
 std::shared_ptr<const ShadowNode> UIManager::getNewestCloneOfShadowNode(
     const ShadowNode& shadowNode) const {
+  flushBackgroundCommits(shadowNode.getSurfaceId());
+
   auto ancestorShadowNode = std::shared_ptr<const ShadowNode>{};
   shadowTreeRegistry_.visit(
       shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
@@ -338,8 +390,20 @@ ShadowTreeRevisionProvider* UIManager::getShadowTreeRevisionProvider() {
 std::shared_ptr<const ShadowNode> UIManager::findNodeAtPoint(
     const std::shared_ptr<const ShadowNode>& node,
     Point point) const {
+  auto newestCloneOfShadowNode = getNewestCloneOfShadowNode(*node);
+  if (!newestCloneOfShadowNode) {
+    return nullptr;
+  }
+
+  std::unique_lock lock(hitTestIndexMutex_);
+  // The index stays valid for as long as the node it was built for is alive
+  // and is still the newest clone, because its subtree can't change.
+  if (hitTestIndexNode_.lock() != newestCloneOfShadowNode) {
+    hitTestIndex_.clear();
+    hitTestIndexNode_ = newestCloneOfShadowNode;
+  }
   return LayoutableShadowNode::findNodeAtPoint(
-      getNewestCloneOfShadowNode(*node), point);
+      newestCloneOfShadowNode, point, &hitTestIndex_);
 }
 
 LayoutMetrics UIManager::getRelativeLayoutMetrics(
@@ -353,6 +417,7 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
   auto owningAncestorShadowNode = std::shared_ptr<const ShadowNode>{};
 
   if (ancestorShadowNode == nullptr) {
+    flushBackgroundCommits(shadowNode.getSurfaceId());
     shadowTreeRegistry_.visit(
         shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
           owningAncestorShadowNode =
@@ -449,6 +514,8 @@ void UIManager::setNativeProps_DEPRECATED(
         std::make_unique<folly::dynamic>((folly::dynamic)rawProps);
   }
 
+  flushBackgroundCommits(family.getSurfaceId());
+
   shadowTreeRegistry_.visit(
       family.getSurfaceId(), [&](const ShadowTree& shadowTree) {
         // The lambda passed to `commit` may be executed multiple times.
@@ -501,53 +568,18 @@ void UIManager::configureNextLayoutAnimation(
   }
 }
 
-static std::shared_ptr<const ShadowNode> findShadowNodeByTagRecursively(
-    std::shared_ptr<const ShadowNode> parentShadowNode,
-    Tag tag) {
-  if (parentShadowNode->getTag() == tag) {
-    return parentShadowNode;
-  }
-
-  for (const std::shared_ptr<const ShadowNode>& shadowNode :
-       parentShadowNode->getChildren()) {
-    auto result = findShadowNodeByTagRecursively(shadowNode, tag);
-    if (result) {
-      return result;
-    }
-  }
-
-  return nullptr;
-}
-
 std::shared_ptr<const ShadowNode> UIManager::findShadowNodeByTag_DEPRECATED(
     Tag tag) const {
+  if (commitPipeline_) {
+    commitPipeline_->flush();
+  }
+
   auto shadowNode = std::shared_ptr<const ShadowNode>{};
 
   shadowTreeRegistry_.enumerate([&](const ShadowTree& shadowTree, bool& stop) {
-    const RootShadowNode* rootShadowNode = nullptr;
-    // The public interface of `ShadowTree` discourages accessing a stored
-    // pointer to a root node because of the possible data race.
-    // To work around this, we ask for a commit and immediately cancel it
-    // returning `nullptr` instead of a new shadow tree.
-    // We don't want to add a way to access a stored pointer to a root node
-    // because this `findShadowNodeByTag` is deprecated. It is only added
-    // to make migration to the new architecture easier.
-    shadowTree.tryCommit(
-        [&](const RootShadowNode& oldRootShadowNode) {
-          rootShadowNode = &oldRootShadowNode;
-          return nullptr;
-        },
-        {/* default commit options */});
-
-    if (rootShadowNode != nullptr) {
-      const auto& children = rootShadowNode->getChildren();
-      if (!children.empty()) {
-        const auto& child = children.front();
-        shadowNode = findShadowNodeByTagRecursively(child, tag);
-        if (shadowNode) {
-          stop = true;
-        }
-      }
+    shadowNode = shadowTree.findNodeByTag(tag);
+    if (shadowNode) {
+      stop = true;
     }
   });
 
@@ -11,10 +11,12 @@
 #include <jsi/jsi.h>
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <mutex>
 #include <shared_mutex>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
+#include <react/renderer/core/HitTestIndex.h>
 #include <react/renderer/core/InstanceHandle.h>
 #include <react/renderer/core/RawValue.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -25,6 +27,7 @@
 #include <react/renderer/mounting/ShadowTreeRegistry.h>
 #include <react/renderer/uimanager/UIManagerAnimationBackend.h>
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
+#include <react/renderer/uimanager/UIManagerCommitPipeline.h>
 #include <react/renderer/uimanager/UIManagerDelegate.h>
 #include <react/renderer/uimanager/UIManagerNativeAnimatedDelegate.h>
 #include <react/renderer/uimanager/consistency/LazyShadowTreeRevisionConsistencyManager.h>
@@ -74,6 +77,17 @@ class UIManager final : public ShadowTreeDelegate {
 
   void setNativeAnimatedDelegate(std::weak_ptr<UIManagerNativeAnimatedDelegate> delegate);
 
+  /**
+   * Makes `completeSurface` commit on the given executor instead of on the
+   * calling thread, so layout, commit hooks and mounting of new trees happen
+   * off the JavaScript thread. Commits which are superseded by newer ones
+   * before they start are skipped. Reads of the shadow tree made by
+   * JavaScript wait for the commits scheduled before them, so JavaScript
+   * keeps observing its own commits.
+   * Must be called before any surface is started.
+   */
+  void setBackgroundCommitExecutor(BackgroundExecutor backgroundExecutor);
+
   void animationTick() const;
 
   void synchronouslyUpdateViewOnUIThread(Tag tag, const folly::dynamic &props);
@@ -229,6 +243,21 @@ class UIManager final : public ShadowTreeDelegate {
       const ShadowNode &shadowNode,
       const std::shared_ptr<const ShadowNode> &ancestorShadowNode) const;
 
+  /*
+   * Commits the given children as the new children of the root of the
+   * surface. Returns the new root, or `nullptr` if the commit didn't succeed.
+   */
+  RootShadowNode::Shared commitSurface(
+      SurfaceId surfaceId,
+      const ShadowNode::UnsharedListOfShared &rootChildren,
+      const ShadowTree::CommitOptions &commitOptions) const;
+
+  /*
+   * Waits for the background commits of the surface scheduled so far.
+   * No-op if commits aren't done in the background.
+   */
+  void flushBackgroundCommits(SurfaceId surfaceId) const;
+
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   UIManagerDelegate *delegate_{};
   UIManagerAnimationDelegate *animationDelegate_{nullptr};
@@ -249,6 +278,16 @@ class UIManager final : public ShadowTreeDelegate {
   std::unique_ptr<LazyShadowTreeRevisionConsistencyManager> lazyShadowTreeRevisionConsistencyManager_;
 
   std::weak_ptr<UIManagerAnimationBackend> animationBackend_;
+
+  // Index of the hit areas of the subtree of the node `findNodeAtPoint` was
+  // last called with; reused for as long as that node is the newest clone.
+  mutable std::mutex hitTestIndexMutex_;
+  mutable std::weak_ptr<const ShadowNode> hitTestIndexNode_;
+  mutable HitTestIndex hitTestIndex_;
+
+  // Declared last, so that it's destroyed (and the running commits finish)
+  // before the rest of the members.
+  std::unique_ptr<UIManagerCommitPipeline> commitPipeline_;
 };
 
 } // namespace facebook::react
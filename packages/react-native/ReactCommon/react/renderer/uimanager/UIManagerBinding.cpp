@@ -15,8 +15,12 @@
 #include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/dom/DOM.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
+#include <react/renderer/uimanager/UIManagerCommandBuffer.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
@@ -149,6 +153,10 @@ void UIManagerBinding::dispatchEventToJS(
 
 void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
+  propertyNames_.clear();
+  for (auto& property : properties_) {
+    property = jsi::Value::undefined();
+  }
 }
 
 static void validateArgumentCount(
@@ -164,11 +172,101 @@ static void validateArgumentCount(
   }
 }
 
+// Names of the properties exposed to JavaScript; the index of a name is the
+// ID of the property.
+static constexpr std::array<std::string_view, UIManagerBinding::PropertyCount>
+    kPropertyNames = {
+        "createNode",
+        "setIsJSResponder",
+        "findNodeAtPoint",
+        "cloneNodeWithNewChildren",
+        "cloneNodeWithNewProps",
+        "cloneNodeWithNewChildrenAndProps",
+        "appendChild",
+        "createChildSet",
+        "appendChildToSet",
+        "completeRoot",
+        "registerEventHandler",
+        "getRelativeLayoutMetrics",
+        "dispatchCommand",
+        "setNativeProps",
+        "measureLayout",
+        "measure",
+        "measureInWindow",
+        "sendAccessibilityEvent",
+        "configureNextLayoutAnimation",
+        "unstable_getCurrentEventPriority",
+        "unstable_DefaultEventPriority",
+        "unstable_DiscreteEventPriority",
+        "unstable_ContinuousEventPriority",
+        "unstable_IdleEventPriority",
+        "findShadowNodeByTag_DEPRECATED",
+        "getBoundingClientRect",
+        "compareDocumentPosition",
+        "executeCommandBuffer",
+};
+
+// `PropertyCount` is declared in the header; an initializer list shorter than
+// it leaves trailing names empty.
+static constexpr bool hasAllPropertyNames() {
+  for (auto name : kPropertyNames) {
+    if (name.empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(
+    hasAllPropertyNames(),
+    "UIManagerBinding::PropertyCount must match the size of kPropertyNames");
+
+static std::optional<size_t> propertyIdFromName(std::string_view name) {
+  static const auto propertyIds = []() {
+    auto propertyIds = std::unordered_map<std::string_view, size_t>{};
+    for (size_t id = 0; id < kPropertyNames.size(); id++) {
+      propertyIds.emplace(kPropertyNames[id], id);
+    }
+    return propertyIds;
+  }();
+
+  auto it = propertyIds.find(name);
+  if (it == propertyIds.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
 jsi::Value UIManagerBinding::get(
     jsi::Runtime& runtime,
     const jsi::PropNameID& name) {
+  // Names which were looked up before are matched by identity, which spares
+  // the conversion to UTF-8 and the hash lookup.
+  for (const auto& [propertyName, propertyId] : propertyNames_) {
+    if (jsi::PropNameID::compare(runtime, propertyName, name)) {
+      return {runtime, properties_[propertyId]};
+    }
+  }
+
   auto methodName = name.utf8(runtime);
 
+  auto propertyId = propertyIdFromName(methodName);
+  if (!propertyId) {
+    return jsi::Value::undefined();
+  }
+
+  auto& property = properties_[*propertyId];
+  if (property.isUndefined()) {
+    property = createProperty(runtime, name, methodName);
+  }
+  propertyNames_.emplace_back(jsi::PropNameID{runtime, name}, *propertyId);
+  return {runtime, property};
+}
+
+jsi::Value UIManagerBinding::createProperty(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& name,
+    const std::string& methodName) {
   // Convert shared_ptr<UIManager> to a raw ptr
   // Why? Because:
   // 1) UIManagerBinding strongly retains UIManager. The JS VM
@@ -471,6 +569,27 @@ jsi::Value UIManagerBinding::get(
         });
   }
 
+  // Semantic: Executes a sequence of `createNode`, `clone*`, `appendChild*`,
+  // `createChildSet` and `completeRoot` operations encoded in a command buffer
+  // (see `UIManagerCommand`) with a single call.
+  if (methodName == "executeCommandBuffer") {
+    auto paramCount = 2;
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        paramCount,
+        [uiManager, methodName, paramCount](
+            jsi::Runtime& runtime,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* arguments,
+            size_t count) -> jsi::Value {
+          validateArgumentCount(runtime, methodName, paramCount, count);
+
+          return executeUIManagerCommandBuffer(
+              runtime, *uiManager, arguments[0], arguments[1]);
+        });
+  }
+
   if (methodName == "registerEventHandler") {
     auto paramCount = 1;
     return jsi::Function::createFromHostFunction(
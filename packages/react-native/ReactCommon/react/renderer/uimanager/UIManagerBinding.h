@@ -14,6 +14,10 @@
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <array>
+#include <utility>
+#include <vector>
+
 namespace facebook::react {
 
 /*
@@ -53,16 +57,25 @@ class UIManagerBinding : public jsi::HostObject {
    * Invalidates the binding and underlying UIManager.
    * Allows to save some resources and prevents UIManager's delegate to be
    * called.
+   * Releases the cached properties, so it must be called on the JavaScript
+   * thread.
    * Calling public methods of this class after calling this method is UB.
-   * Can be called on any thread.
    */
   void invalidate() const;
 
   /*
    * `jsi::HostObject` specific overloads.
+   * Every property is created once and then served from a cache indexed by
+   * the ID of the property. Names seen before are resolved to the ID by
+   * comparing `PropNameID`s, without converting them to UTF-8.
    */
   jsi::Value get(jsi::Runtime &runtime, const jsi::PropNameID &name) override;
 
+  /*
+   * Number of properties exposed to JavaScript.
+   */
+  static constexpr size_t PropertyCount = 28;
+
   UIManager &getUIManager();
   PointerEventsProcessor &getPointerEventsProcessor();
 
@@ -78,7 +91,15 @@ class UIManagerBinding : public jsi::HostObject {
       ReactEventPriority priority,
       const EventPayload &payload) const;
 
+  /*
+   * Creates the value (a host function or a constant) of the property with
+   * given name. Returns `undefined` for unknown names.
+   */
+  jsi::Value createProperty(jsi::Runtime &runtime, const jsi::PropNameID &name, const std::string &methodName);
+
   std::shared_ptr<UIManager> uiManager_;
+  mutable std::array<jsi::Value, PropertyCount> properties_;
+  mutable std::vector<std::pair<jsi::PropNameID, size_t>> propertyNames_;
   std::unique_ptr<jsi::Function> eventHandler_;
   mutable PointerEventsProcessor pointerEventsProcessor_;
   mutable ReactEventPriority currentEventPriority_;
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "UIManagerCommandBuffer.h"
+
+#include <react/renderer/uimanager/primitives.h>
+
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+enum class OperandKind {
+  Integer,
+  Value,
+  Node,
+  ChildSet,
+  // A child set register or -1.
+  OptionalChildSet,
+};
+
+struct CommandLayout {
+  size_t operandCount;
+  std::array<OperandKind, 5> operandKinds;
+  bool producesNode;
+  bool producesChildSet;
+};
+
+std::optional<CommandLayout> getCommandLayout(UIManagerCommand command) {
+  constexpr auto integer = OperandKind::Integer;
+  constexpr auto value = OperandKind::Value;
+  constexpr auto node = OperandKind::Node;
+  constexpr auto childSet = OperandKind::ChildSet;
+  constexpr auto optionalChildSet = OperandKind::OptionalChildSet;
+
+  switch (command) {
+    case UIManagerCommand::LoadNode:
+      return CommandLayout{1, {value}, true, false};
+    case UIManagerCommand::CreateNode:
+      return CommandLayout{
+          5, {integer, value, integer, value, value}, true, false};
+    case UIManagerCommand::CloneNodeWithNewChildren:
+      return CommandLayout{2, {node, optionalChildSet}, true, false};
+    case UIManagerCommand::CloneNodeWithNewProps:
+      return CommandLayout{2, {node, value}, true, false};
+    case UIManagerCommand::CloneNodeWithNewChildrenAndProps:
+      return CommandLayout{3, {node, optionalChildSet, value}, true, false};
+    case UIManagerCommand::AppendChild:
+      return CommandLayout{2, {node, node}, false, false};
+    case UIManagerCommand::CreateChildSet:
+      return CommandLayout{0, {}, false, true};
+    case UIManagerCommand::AppendChildToSet:
+      return CommandLayout{2, {childSet, node}, false, false};
+    case UIManagerCommand::CompleteRoot:
+      return CommandLayout{2, {integer, childSet}, false, false};
+  }
+  return std::nullopt;
+}
+
+[[noreturn]] void failDecoding(const std::string& message, size_t position) {
+  throw std::invalid_argument(
+      message + " (at position " + std::to_string(position) + ")");
+}
+
+class CommandBufferExecutor {
+ public:
+  CommandBufferExecutor(
+      jsi::Runtime& runtime,
+      UIManager& uiManager,
+      jsi::Array values)
+      : runtime_(runtime),
+        uiManager_(uiManager),
+        values_(std::move(values)) {}
+
+  jsi::Value execute(
+      const std::vector<UIManagerCommandInstruction>& instructions) {
+    for (const auto& instruction : instructions) {
+      const auto& operands = instruction.operands;
+      switch (instruction.command) {
+        case UIManagerCommand::LoadNode: {
+          nodes_.push_back(Bridging<std::shared_ptr<const ShadowNode>>::fromJs(
+              runtime_, value(operands[0])));
+          loadedNodes_.push_back(true);
+          break;
+        }
+
+        case UIManagerCommand::CreateNode: {
+          auto tag = static_cast<Tag>(operands[0]);
+          auto componentName = stringFromValue(runtime_, value(operands[1]));
+          auto surfaceId = static_cast<SurfaceId>(operands[2]);
+          auto props = value(operands[3]);
+          auto instanceHandle = instanceHandleFromValue(
+              runtime_, value(operands[4]), jsi::Value(tag));
+          pushNode(uiManager_.createNode(
+              tag,
+              componentName,
+              surfaceId,
+              RawProps(runtime_, props),
+              std::move(instanceHandle)));
+          break;
+        }
+
+        case UIManagerCommand::CloneNodeWithNewChildren: {
+          const auto& node = nodes_[operands[0]];
+          auto children = optionalChildSetRegister(operands[1]);
+          pushNode(uiManager_.cloneNode(*node, children, RawProps()));
+          break;
+        }
+
+        case UIManagerCommand::CloneNodeWithNewProps: {
+          const auto& node = nodes_[operands[0]];
+          auto props = value(operands[1]);
+          pushNode(
+              uiManager_.cloneNode(*node, nullptr, RawProps(runtime_, props)));
+          break;
+        }
+
+        case UIManagerCommand::CloneNodeWithNewChildrenAndProps: {
+          const auto& node = nodes_[operands[0]];
+          auto children = optionalChildSetRegister(operands[1]);
+          auto props = value(operands[2]);
+          pushNode(
+              uiManager_.cloneNode(*node, children, RawProps(runtime_, props)));
+          break;
+        }
+
+        case UIManagerCommand::AppendChild: {
+          uiManager_.appendChild(nodes_[operands[0]], nodes_[operands[1]]);
+          break;
+        }
+
+        case UIManagerCommand::CreateChildSet: {
+          childSets_.push_back(
+              std::make_shared<std::vector<std::shared_ptr<const ShadowNode>>>());
+          break;
+        }
+
+        case UIManagerCommand::AppendChildToSet: {
+          childSets_[operands[0]]->push_back(nodes_[operands[1]]);
+          break;
+        }
+
+        case UIManagerCommand::CompleteRoot: {
+          auto surfaceId = static_cast<SurfaceId>(operands[0]);
+          uiManager_.completeSurface(
+              surfaceId,
+              childSets_[operands[1]],
+              {.enableStateReconciliation = true,
+               .mountSynchronously = false,
+               .source = ShadowTree::CommitSource::React});
+          break;
+        }
+      }
+    }
+
+    auto result = jsi::Array(runtime_, nodes_.size());
+    for (size_t i = 0; i < nodes_.size(); i++) {
+      if (!loadedNodes_[i]) {
+        result.setValueAtIndex(
+            runtime_, i, valueFromShadowNode(runtime_, nodes_[i], true));
+      }
+    }
+    return result;
+  }
+
+ private:
+  // Indices are validated by `decodeUIManagerCommandBuffer`.
+  jsi::Value value(int32_t index) {
+    return values_.getValueAtIndex(runtime_, index);
+  }
+
+  ShadowNode::SharedListOfShared optionalChildSetRegister(int32_t index) const {
+    if (index == -1) {
+      return ShadowNode::emptySharedShadowNodeSharedList();
+    }
+    return childSets_[index];
+  }
+
+  void pushNode(std::shared_ptr<const ShadowNode> node) {
+    if (!node) {
+      throw jsi::JSError(
+          runtime_, "executeCommandBuffer: failed to create or clone a node");
+    }
+    nodes_.push_back(std::move(node));
+    loadedNodes_.push_back(false);
+  }
+
+  jsi::Runtime& runtime_;
+  UIManager& uiManager_;
+  jsi::Array values_;
+
+  std::vector<std::shared_ptr<const ShadowNode>> nodes_;
+  std::vector<bool> loadedNodes_;
+  std::vector<ShadowNode::UnsharedListOfShared> childSets_;
+};
+
+} // namespace
+
+std::vector<UIManagerCommandInstruction> decodeUIManagerCommandBuffer(
+    const uint8_t* data,
+    size_t size,
+    size_t valueCount) {
+  if (size % sizeof(int32_t) != 0) {
+    throw std::invalid_argument(
+        "the size of the command buffer is not a multiple of 4");
+  }
+
+  auto wordCount = size / sizeof(int32_t);
+  auto readWord = [&](size_t position) {
+    // The buffer is not guaranteed to be aligned.
+    int32_t word = 0;
+    std::memcpy(&word, data + position * sizeof(int32_t), sizeof(word));
+    return word;
+  };
+
+  auto instructions = std::vector<UIManagerCommandInstruction>{};
+  size_t nodeCount = 0;
+  size_t childSetCount = 0;
+  size_t position = 0;
+
+  while (position < wordCount) {
+    auto commandPosition = position;
+    auto command = static_cast<UIManagerCommand>(readWord(position++));
+
+    auto layout = getCommandLayout(command);
+    if (!layout) {
+      failDecoding(
+          "unknown command " + std::to_string(static_cast<int32_t>(command)),
+          commandPosition);
+    }
+    if (wordCount - position < layout->operandCount) {
+      failDecoding("unexpected end of the command buffer", wordCount);
+    }
+
+    auto instruction = UIManagerCommandInstruction{.command = command};
+    for (size_t i = 0; i < layout->operandCount; i++, position++) {
+      auto operand = readWord(position);
+      switch (layout->operandKinds[i]) {
+        case OperandKind::Integer:
+          break;
+        case OperandKind::Value:
+          if (operand < 0 || static_cast<size_t>(operand) >= valueCount) {
+            failDecoding(
+                "value index " + std::to_string(operand) + " is out of bounds",
+                position);
+          }
+          break;
+        case OperandKind::Node:
+          if (operand < 0 || static_cast<size_t>(operand) >= nodeCount) {
+            failDecoding(
+                "node register " + std::to_string(operand) +
+                    " is out of bounds",
+                position);
+          }
+          break;
+        case OperandKind::OptionalChildSet:
+          if (operand == -1) {
+            break;
+          }
+          [[fallthrough]];
+        case OperandKind::ChildSet:
+          if (operand < 0 || static_cast<size_t>(operand) >= childSetCount) {
+            failDecoding(
+                "child set register " + std::to_string(operand) +
+                    " is out of bounds",
+                position);
+          }
+          break;
+      }
+      instruction.operands[i] = operand;
+    }
+
+    if (layout->producesNode) {
+      nodeCount++;
+    }
+    if (layout->producesChildSet) {
+      childSetCount++;
+    }
+    instructions.push_back(instruction);
+  }
+
+  return instructions;
+}
+
+jsi::Value executeUIManagerCommandBuffer(
+    jsi::Runtime& runtime,
+    UIManager& uiManager,
+    const jsi::Value& commands,
+    const jsi::Value& values) {
+  auto commandsObject = commands.asObject(runtime);
+  if (!commandsObject.isArrayBuffer(runtime)) {
+    throw jsi::JSError(
+        runtime, "executeCommandBuffer: commands must be an ArrayBuffer");
+  }
+
+  auto commandBuffer = commandsObject.getArrayBuffer(runtime);
+  auto valuesArray = values.asObject(runtime).asArray(runtime);
+
+  auto instructions = std::vector<UIManagerCommandInstruction>{};
+  try {
+    instructions = decodeUIManagerCommandBuffer(
+        commandBuffer.data(runtime),
+        commandBuffer.size(runtime),
+        valuesArray.size(runtime));
+  } catch (const std::invalid_argument& error) {
+    throw jsi::JSError(
+        runtime, std::string("executeCommandBuffer: ") + error.what());
+  }
+
+  return CommandBufferExecutor(runtime, uiManager, std::move(valuesArray))
+      .execute(instructions);
+}
+
+} // namespace facebook::react
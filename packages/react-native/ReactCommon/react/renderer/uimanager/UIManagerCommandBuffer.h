@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Opcodes of the command buffer accepted by
+ * `nativeFabricUIManager.executeCommandBuffer(commands, values)`.
+ *
+ * `commands` is an `ArrayBuffer` of 32-bit integers: every command is an
+ * opcode followed by its operands. `values` is an array of JavaScript values
+ * (component names, props, instance handles and nodes created earlier)
+ * referred to by index. Commands producing a node store it in the next node
+ * register, commands producing a child set store it in the next child set
+ * register; registers are referred to by index as well.
+ *
+ * Keep in sync with the JavaScript side of the renderer.
+ */
+enum class UIManagerCommand : int32_t {
+  // [valueIndex] -> node: Loads a node passed in `values`.
+  LoadNode = 0,
+  // [tag, componentNameValueIndex, surfaceId, propsValueIndex,
+  // instanceHandleValueIndex] -> node
+  CreateNode = 1,
+  // [node, childSet] -> node: Clones the node with *same* props and *given*
+  // children (no children if `childSet` is -1).
+  CloneNodeWithNewChildren = 2,
+  // [node, propsValueIndex] -> node: Clones the node with *given* props and
+  // *same* children.
+  CloneNodeWithNewProps = 3,
+  // [node, childSet, propsValueIndex] -> node: Clones the node with *given*
+  // props and *given* children (no children if `childSet` is -1).
+  CloneNodeWithNewChildrenAndProps = 4,
+  // [parentNode, childNode]
+  AppendChild = 5,
+  // [] -> childSet
+  CreateChildSet = 6,
+  // [childSet, node]
+  AppendChildToSet = 7,
+  // [surfaceId, childSet]
+  CompleteRoot = 8,
+};
+
+/*
+ * A command of the command buffer with its operands.
+ */
+struct UIManagerCommandInstruction {
+  UIManagerCommand command;
+  std::array<int32_t, 5> operands{};
+};
+
+/*
+ * Decodes the command buffer `data` of `size` bytes and validates it: every
+ * command must be known and have all its operands, value indices must be
+ * lower than `valueCount`, and registers must be produced by preceding
+ * commands.
+ * Throws `std::invalid_argument` describing the first problem and its
+ * position if the buffer is malformed.
+ */
+std::vector<UIManagerCommandInstruction>
+decodeUIManagerCommandBuffer(const uint8_t *data, size_t size, size_t valueCount);
+
+/*
+ * Executes a command buffer (see `UIManagerCommand`) in a single call.
+ * Returns an array with an element for every node register: the nodes created
+ * or cloned by the commands, and `undefined` for nodes loaded from `values`.
+ * Throws `jsi::JSError` without executing anything if the buffer is malformed.
+ * Errors raised while executing a command (e.g. a value of the wrong type, or
+ * a failing `UIManager` call) propagate after the preceding commands already
+ * took effect.
+ */
+jsi::Value executeUIManagerCommandBuffer(
+    jsi::Runtime &runtime,
+    UIManager &uiManager,
+    const jsi::Value &commands,
+    const jsi::Value &values);
+
+} // namespace facebook::react
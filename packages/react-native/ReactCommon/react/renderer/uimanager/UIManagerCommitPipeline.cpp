@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "UIManagerCommitPipeline.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+UIManagerCommitPipeline::UIManagerCommitPipeline(Executor executor)
+    : executor_(std::move(executor)), state_(std::make_shared<State>()) {}
+
+UIManagerCommitPipeline::~UIManagerCommitPipeline() {
+  std::unique_lock lock(state_->mutex);
+  state_->isStopped = true;
+  state_->pendingCommits.clear();
+  state_->pendingSurfaceIds.clear();
+  state_->condition.wait(
+      lock, [&]() { return state_->runningSurfaceIds.empty(); });
+}
+
+void UIManagerCommitPipeline::enqueue(SurfaceId surfaceId, Commit commit)
+    const {
+  std::unique_lock lock(state_->mutex);
+  if (state_->isStopped) {
+    return;
+  }
+
+  auto [it, inserted] = state_->pendingCommits.try_emplace(surfaceId);
+  if (inserted) {
+    state_->pendingSurfaceIds.push_back(surfaceId);
+  } else {
+    state_->supersededCommitCount++;
+  }
+  it->second = std::move(commit);
+
+  scheduleDrainIfNeeded(state_, executor_, lock);
+}
+
+void UIManagerCommitPipeline::flush(SurfaceId surfaceId) const {
+  std::unique_lock lock(state_->mutex);
+  while (true) {
+    if (state_->runningSurfaceIds.contains(surfaceId)) {
+      state_->condition.wait(lock);
+      continue;
+    }
+
+    if (!state_->pendingCommits.contains(surfaceId)) {
+      return;
+    }
+
+    auto commit = takePendingCommit(*state_, surfaceId);
+    lock.unlock();
+    runCommit(state_, executor_, surfaceId, commit);
+    lock.lock();
+  }
+}
+
+void UIManagerCommitPipeline::flush() const {
+  std::unique_lock lock(state_->mutex);
+  while (true) {
+    auto it = std::find_if(
+        state_->pendingSurfaceIds.begin(),
+        state_->pendingSurfaceIds.end(),
+        [&](SurfaceId surfaceId) {
+          return !state_->runningSurfaceIds.contains(surfaceId);
+        });
+
+    if (it == state_->pendingSurfaceIds.end()) {
+      if (state_->runningSurfaceIds.empty()) {
+        return;
+      }
+      state_->condition.wait(lock);
+      continue;
+    }
+
+    auto surfaceId = *it;
+    auto commit = takePendingCommit(*state_, surfaceId);
+    lock.unlock();
+    runCommit(state_, executor_, surfaceId, commit);
+    lock.lock();
+  }
+}
+
+size_t UIManagerCommitPipeline::getSupersededCommitCount() const {
+  std::unique_lock lock(state_->mutex);
+  return state_->supersededCommitCount;
+}
+
+void UIManagerCommitPipeline::drain(
+    const std::shared_ptr<State>& state,
+    const Executor& executor) {
+  std::unique_lock lock(state->mutex);
+  while (true) {
+    // Surfaces with a running commit (started by `flush`) are skipped, their
+    // pending commits are picked up once the running ones finish.
+    auto it = std::find_if(
+        state->pendingSurfaceIds.begin(),
+        state->pendingSurfaceIds.end(),
+        [&](SurfaceId surfaceId) {
+          return !state->runningSurfaceIds.contains(surfaceId);
+        });
+
+    if (it == state->pendingSurfaceIds.end() || state->isStopped) {
+      state->isDrainScheduled = false;
+      return;
+    }
+
+    auto surfaceId = *it;
+    auto commit = takePendingCommit(*state, surfaceId);
+    lock.unlock();
+    try {
+      runCommit(state, executor, surfaceId, commit);
+    } catch (...) {
+      // The exception is left to the executor; the remaining commits run in
+      // a new drain.
+      lock.lock();
+      state->isDrainScheduled = false;
+      scheduleDrainIfNeeded(state, executor, lock);
+      throw;
+    }
+    lock.lock();
+  }
+}
+
+UIManagerCommitPipeline::Commit UIManagerCommitPipeline::takePendingCommit(
+    State& state,
+    SurfaceId surfaceId) {
+  auto it = state.pendingCommits.find(surfaceId);
+  auto commit = std::move(it->second);
+  state.pendingCommits.erase(it);
+  state.pendingSurfaceIds.erase(std::find(
+      state.pendingSurfaceIds.begin(),
+      state.pendingSurfaceIds.end(),
+      surfaceId));
+  state.runningSurfaceIds.insert(surfaceId);
+  return commit;
+}
+
+void UIManagerCommitPipeline::runCommit(
+    const std::shared_ptr<State>& state,
+    const Executor& executor,
+    SurfaceId surfaceId,
+    const Commit& commit) {
+  auto finish = [&]() {
+    std::unique_lock lock(state->mutex);
+    state->runningSurfaceIds.erase(surfaceId);
+    state->condition.notify_all();
+    scheduleDrainIfNeeded(state, executor, lock);
+  };
+
+  try {
+    commit();
+  } catch (...) {
+    finish();
+    throw;
+  }
+  finish();
+}
+
+void UIManagerCommitPipeline::scheduleDrainIfNeeded(
+    const std::shared_ptr<State>& state,
+    const Executor& executor,
+    std::unique_lock<std::mutex>& lock) {
+  if (state->isDrainScheduled || state->isStopped ||
+      state->pendingSurfaceIds.empty()) {
+    return;
+  }
+
+  state->isDrainScheduled = true;
+  lock.unlock();
+  executor([state, executor]() { drain(state, executor); });
+}
+
+} // namespace facebook::react
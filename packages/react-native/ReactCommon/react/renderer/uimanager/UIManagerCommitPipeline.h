@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace facebook::react {
+
+/*
+ * Runs the commits of surfaces on a background executor, so that layout,
+ * commit hooks and mounting don't block the thread which produced the new
+ * tree (usually the JavaScript thread).
+ *
+ * Commits of a surface run one at a time and in order. A commit which hasn't
+ * started yet when a newer one for the same surface is enqueued is superseded
+ * by the newer one and never runs. This is meant for commits which replace
+ * the whole tree (like the ones of `completeSurface`), where only the newest
+ * one matters.
+ *
+ * `flush` lets readers wait for the enqueued commits of a surface; commits
+ * which haven't started yet run on the calling thread.
+ *
+ * An exception thrown by a commit propagates to the executor (or to the
+ * caller of `flush`) and doesn't stop the pipeline: the following commits
+ * still run.
+ */
+class UIManagerCommitPipeline final {
+ public:
+  using Commit = std::function<void()>;
+  using Executor = std::function<void(std::function<void()> &&callback)>;
+
+  explicit UIManagerCommitPipeline(Executor executor);
+
+  /*
+   * Drops the commits which haven't started yet and waits for the running
+   * ones.
+   */
+  ~UIManagerCommitPipeline();
+
+  /*
+   * Not copyable, not movable.
+   */
+  UIManagerCommitPipeline(const UIManagerCommitPipeline &) = delete;
+  UIManagerCommitPipeline &operator=(const UIManagerCommitPipeline &) = delete;
+
+  /*
+   * Schedules the commit for the given surface, superseding the commit of
+   * the surface which hasn't started yet (if any).
+   * Can be called from any thread.
+   */
+  void enqueue(SurfaceId surfaceId, Commit commit) const;
+
+  /*
+   * Returns once all commits for the given surface (or for all surfaces)
+   * enqueued before the call have finished.
+   * Can be called from any thread, but not from within a commit.
+   */
+  void flush(SurfaceId surfaceId) const;
+  void flush() const;
+
+  /*
+   * Returns the number of commits which were superseded by newer ones.
+   */
+  size_t getSupersededCommitCount() const;
+
+ private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::unordered_map<SurfaceId, Commit> pendingCommits;
+    // Surfaces with pending commits, in the order of the commits.
+    std::deque<SurfaceId> pendingSurfaceIds;
+    std::unordered_set<SurfaceId> runningSurfaceIds;
+    bool isDrainScheduled{false};
+    bool isStopped{false};
+    size_t supersededCommitCount{0};
+  };
+
+  static void drain(const std::shared_ptr<State> &state, const Executor &executor);
+  static Commit takePendingCommit(State &state, SurfaceId surfaceId);
+  static void runCommit(
+      const std::shared_ptr<State> &state,
+      const Executor &executor,
+      SurfaceId surfaceId,
+      const Commit &commit);
+  static void scheduleDrainIfNeeded(
+      const std::shared_ptr<State> &state,
+      const Executor &executor,
+      std::unique_lock<std::mutex> &lock);
+
+  const Executor executor_;
+  const std::shared_ptr<State> state_;
+};
+
+} // namespace facebook::react
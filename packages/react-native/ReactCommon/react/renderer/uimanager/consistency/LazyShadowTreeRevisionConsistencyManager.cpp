@@ -28,6 +28,17 @@ void LazyShadowTreeRevisionConsistencyManager::updateCurrentRevision(
   }
 }
 
+void LazyShadowTreeRevisionConsistencyManager::invalidateCurrentRevision(
+    SurfaceId surfaceId) {
+  std::unique_lock lock(capturedRootShadowNodesForConsistencyMutex_);
+  capturedRootShadowNodesForConsistency_.erase(surfaceId);
+}
+
+void LazyShadowTreeRevisionConsistencyManager::setWillResolveRevisionCallback(
+    std::function<void(SurfaceId surfaceId)> callback) {
+  willResolveRevisionCallback_ = std::move(callback);
+}
+
 #pragma mark - ShadowTreeRevisionProvider
 
 RootShadowNode::Shared
@@ -47,6 +58,10 @@ LazyShadowTreeRevisionConsistencyManager::getCurrentRevision(
   // the access to the shadow tree registry as well.
   // If this was multi-threaded, we would need to protect it to avoid capturing
   // root shadow nodes concurrently.
+  if (willResolveRevisionCallback_) {
+    willResolveRevisionCallback_(surfaceId);
+  }
+
   RootShadowNode::Shared rootShadowNode;
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
     rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
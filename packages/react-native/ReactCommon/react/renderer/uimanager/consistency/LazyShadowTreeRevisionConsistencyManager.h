@@ -12,6 +12,7 @@
 #include <react/renderer/mounting/ShadowTreeRegistry.h>
 #include <react/renderer/uimanager/consistency/ShadowTreeRevisionProvider.h>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <shared_mutex>
 
@@ -30,6 +31,19 @@ class LazyShadowTreeRevisionConsistencyManager : public ShadowTreeRevisionConsis
 
   void updateCurrentRevision(SurfaceId surfaceId, RootShadowNode::Shared rootShadowNode);
 
+  /*
+   * Drops the revision captured for the surface, so that the next read
+   * resolves it again (e.g. after scheduling a commit which might not have
+   * finished yet).
+   */
+  void invalidateCurrentRevision(SurfaceId surfaceId);
+
+  /*
+   * Sets a function called before resolving the current revision of a surface
+   * from its shadow tree (e.g. to wait for scheduled commits).
+   */
+  void setWillResolveRevisionCallback(std::function<void(SurfaceId surfaceId)> callback);
+
 #pragma mark - ShadowTreeRevisionProvider
 
   RootShadowNode::Shared getCurrentRevision(SurfaceId surfaceId) override;
@@ -43,6 +57,7 @@ class LazyShadowTreeRevisionConsistencyManager : public ShadowTreeRevisionConsis
   std::mutex capturedRootShadowNodesForConsistencyMutex_;
   std::unordered_map<SurfaceId, RootShadowNode::Shared> capturedRootShadowNodesForConsistency_;
   ShadowTreeRegistry &shadowTreeRegistry_;
+  std::function<void(SurfaceId surfaceId)> willResolveRevisionCallback_;
   uint_fast32_t lockCount{0};
 };
 
@@ -393,4 +393,54 @@ TEST_F(LazyShadowTreeRevisionConsistencyManagerTest, testReentrance) {
       consistencyManager_.getCurrentRevision(0).get(), newRootShadowNode.get());
 }
 
+TEST_F(
+    LazyShadowTreeRevisionConsistencyManagerTest,
+    testInvalidateWithScheduledCommit) {
+  shadowTreeRegistry_.add(createShadowTree(0));
+
+  auto element = Element<RootShadowNode>();
+  auto builder = simpleComponentBuilder();
+  auto newRootShadowNode = builder.build(element);
+
+  // Simulates a commit which is scheduled and only runs once the revision is
+  // resolved.
+  auto isCommitScheduled = false;
+  consistencyManager_.setWillResolveRevisionCallback([&](SurfaceId surfaceId) {
+    if (!isCommitScheduled) {
+      return;
+    }
+    isCommitScheduled = false;
+    shadowTreeRegistry_.visit(
+        surfaceId, [newRootShadowNode](const ShadowTree& shadowTree) {
+          shadowTree.commit(
+              [&](const RootShadowNode& /*oldRootShadowNode*/) {
+                return newRootShadowNode;
+              },
+              {});
+        });
+  });
+
+  consistencyManager_.lockRevisions();
+
+  auto initialRootShadowNode = consistencyManager_.getCurrentRevision(0);
+  EXPECT_NE(initialRootShadowNode, nullptr);
+  EXPECT_NE(initialRootShadowNode.get(), newRootShadowNode.get());
+
+  isCommitScheduled = true;
+
+  // The captured revision is used until it's invalidated.
+  EXPECT_EQ(
+      consistencyManager_.getCurrentRevision(0).get(),
+      initialRootShadowNode.get());
+  EXPECT_TRUE(isCommitScheduled);
+
+  consistencyManager_.invalidateCurrentRevision(0);
+
+  EXPECT_EQ(
+      consistencyManager_.getCurrentRevision(0).get(), newRootShadowNode.get());
+  EXPECT_FALSE(isCommitScheduled);
+
+  consistencyManager_.unlockRevisions();
+}
+
 } // namespace facebook::react
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/uimanager/UIManagerCommandBuffer.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr auto LoadNode = static_cast<int32_t>(UIManagerCommand::LoadNode);
+constexpr auto CreateNode = static_cast<int32_t>(UIManagerCommand::CreateNode);
+constexpr auto CloneNodeWithNewChildren =
+    static_cast<int32_t>(UIManagerCommand::CloneNodeWithNewChildren);
+constexpr auto CloneNodeWithNewProps =
+    static_cast<int32_t>(UIManagerCommand::CloneNodeWithNewProps);
+constexpr auto AppendChild =
+    static_cast<int32_t>(UIManagerCommand::AppendChild);
+constexpr auto CreateChildSet =
+    static_cast<int32_t>(UIManagerCommand::CreateChildSet);
+constexpr auto AppendChildToSet =
+    static_cast<int32_t>(UIManagerCommand::AppendChildToSet);
+constexpr auto CompleteRoot =
+    static_cast<int32_t>(UIManagerCommand::CompleteRoot);
+
+std::vector<UIManagerCommandInstruction> decode(
+    const std::vector<int32_t>& words,
+    size_t valueCount) {
+  return decodeUIManagerCommandBuffer(
+      reinterpret_cast<const uint8_t*>(words.data()),
+      words.size() * sizeof(int32_t),
+      valueCount);
+}
+
+std::string decodingError(
+    const std::vector<int32_t>& words,
+    size_t valueCount) {
+  try {
+    decode(words, valueCount);
+  } catch (const std::invalid_argument& error) {
+    return error.what();
+  }
+  return "";
+}
+
+// Values: 0: "View", 1: props, 2: instance handle, 3: props, 4: an existing
+// node.
+const auto kValueCount = size_t{5};
+
+// Creates a node, clones an existing one with new props, appends the new node
+// to the clone and commits the clone.
+// clang-format off
+const auto kCommands = std::vector<int32_t>{
+    // node 0
+    CreateNode, 11, 0, 1, 1, 2,
+    // node 1
+    LoadNode, 4,
+    // node 2
+    CloneNodeWithNewProps, 1, 3,
+    AppendChild, 2, 0,
+    // child set 0
+    CreateChildSet,
+    AppendChildToSet, 0, 2,
+    CompleteRoot, 1, 0,
+};
+// clang-format on
+
+} // namespace
+
+TEST(UIManagerCommandBufferTest, decodesCommands) {
+  auto instructions = decode(kCommands, kValueCount);
+
+  ASSERT_EQ(instructions.size(), 7);
+
+  EXPECT_EQ(instructions[0].command, UIManagerCommand::CreateNode);
+  EXPECT_EQ(
+      instructions[0].operands, (std::array<int32_t, 5>{11, 0, 1, 1, 2}));
+  EXPECT_EQ(instructions[1].command, UIManagerCommand::LoadNode);
+  EXPECT_EQ(instructions[1].operands[0], 4);
+  EXPECT_EQ(instructions[2].command, UIManagerCommand::CloneNodeWithNewProps);
+  EXPECT_EQ(instructions[2].operands[0], 1);
+  EXPECT_EQ(instructions[2].operands[1], 3);
+  EXPECT_EQ(instructions[3].command, UIManagerCommand::AppendChild);
+  EXPECT_EQ(instructions[4].command, UIManagerCommand::CreateChildSet);
+  EXPECT_EQ(instructions[5].command, UIManagerCommand::AppendChildToSet);
+  EXPECT_EQ(instructions[6].command, UIManagerCommand::CompleteRoot);
+  EXPECT_EQ(instructions[6].operands[0], 1);
+  EXPECT_EQ(instructions[6].operands[1], 0);
+
+  EXPECT_TRUE(decode({}, 0).empty());
+}
+
+TEST(UIManagerCommandBufferTest, decodesUnalignedBuffers) {
+  auto bytes = std::vector<uint8_t>(kCommands.size() * sizeof(int32_t) + 1);
+  std::memcpy(
+      bytes.data() + 1, kCommands.data(), kCommands.size() * sizeof(int32_t));
+
+  auto instructions =
+      decodeUIManagerCommandBuffer(bytes.data() + 1, bytes.size() - 1, 5);
+  EXPECT_EQ(instructions.size(), 7);
+}
+
+TEST(UIManagerCommandBufferTest, rejectsTruncatedBuffers) {
+  auto commandStarts = std::vector<size_t>{0, 6, 8, 11, 14, 15, 18, 21};
+
+  for (size_t size = 1; size < kCommands.size(); size++) {
+    auto words =
+        std::vector<int32_t>(kCommands.begin(), kCommands.begin() + size);
+    auto isCommandBoundary =
+        std::find(commandStarts.begin(), commandStarts.end(), size) !=
+        commandStarts.end();
+
+    if (isCommandBoundary) {
+      EXPECT_NO_THROW(decode(words, kValueCount)) << "size " << size;
+    } else {
+      EXPECT_EQ(
+          decodingError(words, kValueCount),
+          "unexpected end of the command buffer (at position " +
+              std::to_string(size) + ")")
+          << "size " << size;
+    }
+  }
+
+  // Not a whole number of 32-bit words.
+  EXPECT_THROW(
+      decodeUIManagerCommandBuffer(
+          reinterpret_cast<const uint8_t*>(kCommands.data()),
+          kCommands.size() * sizeof(int32_t) - 1,
+          kValueCount),
+      std::invalid_argument);
+}
+
+TEST(UIManagerCommandBufferTest, rejectsMalformedBuffers) {
+  EXPECT_EQ(decodingError({42}, 0), "unknown command 42 (at position 0)");
+  EXPECT_EQ(
+      decodingError({CreateChildSet, -1}, 0),
+      "unknown command -1 (at position 1)");
+
+  // Value indices must be lower than the number of values.
+  EXPECT_EQ(
+      decodingError({LoadNode, 1}, 1),
+      "value index 1 is out of bounds (at position 1)");
+  EXPECT_EQ(
+      decodingError({LoadNode, -1}, 1),
+      "value index -1 is out of bounds (at position 1)");
+  EXPECT_EQ(
+      decodingError({CreateNode, 11, 0, 1, 5, 2}, kValueCount),
+      "value index 5 is out of bounds (at position 4)");
+
+  // Registers must be produced by preceding commands.
+  EXPECT_EQ(
+      decodingError({LoadNode, 0, AppendChild, 0, 1}, 1),
+      "node register 1 is out of bounds (at position 4)");
+  EXPECT_EQ(
+      decodingError({LoadNode, 0, CloneNodeWithNewProps, 1, 0}, 1),
+      "node register 1 is out of bounds (at position 3)");
+  EXPECT_EQ(
+      decodingError({LoadNode, 0, AppendChildToSet, 0, 0}, 1),
+      "child set register 0 is out of bounds (at position 3)");
+  EXPECT_EQ(
+      decodingError({CreateChildSet, CompleteRoot, 1, 1}, 0),
+      "child set register 1 is out of bounds (at position 3)");
+
+  // Only clones accept -1 for "no children".
+  EXPECT_NO_THROW(decode({LoadNode, 0, CloneNodeWithNewChildren, 0, -1}, 1));
+  EXPECT_EQ(
+      decodingError({LoadNode, 0, CloneNodeWithNewChildren, 0, -2}, 1),
+      "child set register -2 is out of bounds (at position 4)");
+  EXPECT_EQ(
+      decodingError({CompleteRoot, 1, -1}, 0),
+      "child set register -1 is out of bounds (at position 2)");
+}
+
+} // namespace facebook::react
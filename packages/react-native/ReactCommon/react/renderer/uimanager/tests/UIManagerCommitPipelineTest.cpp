@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/uimanager/UIManagerCommitPipeline.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+class ManualExecutor {
+ public:
+  UIManagerCommitPipeline::Executor asExecutor() {
+    return [this](std::function<void()>&& callback) {
+      callbacks_.push_back(std::move(callback));
+    };
+  }
+
+  size_t size() const {
+    return callbacks_.size();
+  }
+
+  void runAll() {
+    while (!callbacks_.empty()) {
+      auto callback = std::move(callbacks_.front());
+      callbacks_.erase(callbacks_.begin());
+      callback();
+    }
+  }
+
+ private:
+  std::vector<std::function<void()>> callbacks_;
+};
+
+TEST(UIManagerCommitPipelineTest, runsCommitsOnExecutorInOrder) {
+  auto executor = ManualExecutor{};
+  auto pipeline = UIManagerCommitPipeline{executor.asExecutor()};
+  auto log = std::vector<std::string>{};
+
+  pipeline.enqueue(1, [&]() { log.push_back("1a"); });
+  pipeline.enqueue(2, [&]() { log.push_back("2a"); });
+
+  EXPECT_TRUE(log.empty());
+  EXPECT_EQ(executor.size(), 1);
+
+  executor.runAll();
+
+  EXPECT_EQ(log, (std::vector<std::string>{"1a", "2a"}));
+
+  pipeline.enqueue(1, [&]() { log.push_back("1b"); });
+  executor.runAll();
+
+  EXPECT_EQ(log, (std::vector<std::string>{"1a", "2a", "1b"}));
+}
+
+TEST(UIManagerCommitPipelineTest, supersedesPendingCommits) {
+  auto executor = ManualExecutor{};
+  auto pipeline = UIManagerCommitPipeline{executor.asExecutor()};
+  auto log = std::vector<std::string>{};
+
+  pipeline.enqueue(1, [&]() { log.push_back("1a"); });
+  pipeline.enqueue(2, [&]() { log.push_back("2a"); });
+  pipeline.enqueue(1, [&]() { log.push_back("1b"); });
+  pipeline.enqueue(1, [&]() { log.push_back("1c"); });
+  executor.runAll();
+
+  EXPECT_EQ(log, (std::vector<std::string>{"1c", "2a"}));
+  EXPECT_EQ(pipeline.getSupersededCommitCount(), 2);
+}
+
+TEST(UIManagerCommitPipelineTest, flushRunsPendingCommitsOnCallingThread) {
+  auto executor = ManualExecutor{};
+  auto pipeline = UIManagerCommitPipeline{executor.asExecutor()};
+  auto log = std::vector<std::string>{};
+
+  pipeline.enqueue(1, [&]() { log.push_back("1a"); });
+  pipeline.enqueue(2, [&]() { log.push_back("2a"); });
+
+  pipeline.flush(2);
+  EXPECT_EQ(log, (std::vector<std::string>{"2a"}));
+
+  pipeline.flush();
+  EXPECT_EQ(log, (std::vector<std::string>{"2a", "1a"}));
+
+  // The scheduled drain has nothing left to do.
+  executor.runAll();
+  EXPECT_EQ(log, (std::vector<std::string>{"2a", "1a"}));
+}
+
+TEST(UIManagerCommitPipelineTest, flushWaitsForRunningCommit) {
+  auto pipeline = UIManagerCommitPipeline{[](std::function<void()>&& callback) {
+    std::thread(std::move(callback)).detach();
+  }};
+
+  auto didStart = std::promise<void>{};
+  auto canFinish = std::promise<void>{};
+  auto canFinishFuture = canFinish.get_future();
+  auto didFinish = std::atomic<bool>{false};
+
+  pipeline.enqueue(1, [&]() {
+    didStart.set_value();
+    canFinishFuture.wait();
+    didFinish = true;
+  });
+  didStart.get_future().wait();
+
+  auto flushThread = std::thread([&]() {
+    pipeline.flush(1);
+    EXPECT_TRUE(didFinish);
+  });
+  canFinish.set_value();
+  flushThread.join();
+
+  EXPECT_TRUE(didFinish);
+}
+
+TEST(UIManagerCommitPipelineTest, keepsRunningCommitsAfterCommitThrows) {
+  auto executor = ManualExecutor{};
+  auto pipeline = UIManagerCommitPipeline{executor.asExecutor()};
+  auto log = std::vector<std::string>{};
+
+  pipeline.enqueue(1, []() { throw std::runtime_error("Commit failed"); });
+  pipeline.enqueue(2, [&]() { log.push_back("2a"); });
+
+  // The exception reaches the executor, which gets a new drain for the
+  // remaining commits.
+  EXPECT_THROW(executor.runAll(), std::runtime_error);
+  EXPECT_TRUE(log.empty());
+  EXPECT_EQ(executor.size(), 1);
+
+  executor.runAll();
+  EXPECT_EQ(log, (std::vector<std::string>{"2a"}));
+
+  // Neither the surface of the failed commit nor the pipeline are stuck.
+  pipeline.enqueue(1, [&]() { log.push_back("1b"); });
+  executor.runAll();
+  pipeline.flush();
+  EXPECT_EQ(log, (std::vector<std::string>{"2a", "1b"}));
+}
+
+TEST(UIManagerCommitPipelineTest, dropsPendingCommitsWhenDestroyed) {
+  auto executor = ManualExecutor{};
+  auto didCommit = false;
+
+  {
+    auto pipeline = UIManagerCommitPipeline{executor.asExecutor()};
+    pipeline.enqueue(1, [&]() { didCommit = true; });
+  }
+  executor.runAll();
+
+  EXPECT_FALSE(didCommit);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr int kCallsPerIteration = 10000;
+
+/*
+ * Mirrors the previous implementation of `UIManagerBinding::get`: the name is
+ * matched against a chain of string comparisons and a new host function is
+ * created on every access.
+ */
+class UncachedBinding : public jsi::HostObject {
+ public:
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override {
+    auto methodName = name.utf8(runtime);
+    for (const auto& candidate : names_) {
+      if (methodName != candidate) {
+        continue;
+      }
+      return jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](jsi::Runtime& /*runtime*/,
+             const jsi::Value& /*thisValue*/,
+             const jsi::Value* /*arguments*/,
+             size_t /*count*/) -> jsi::Value {
+            return {serialize(ReactEventPriority::Default)};
+          });
+    }
+    return jsi::Value::undefined();
+  }
+
+ private:
+  // `unstable_getCurrentEventPriority` is the 20th property of the binding.
+  std::vector<std::string> names_{
+      "createNode",
+      "setIsJSResponder",
+      "findNodeAtPoint",
+      "cloneNodeWithNewChildren",
+      "cloneNodeWithNewProps",
+      "cloneNodeWithNewChildrenAndProps",
+      "appendChild",
+      "createChildSet",
+      "appendChildToSet",
+      "completeRoot",
+      "registerEventHandler",
+      "getRelativeLayoutMetrics",
+      "dispatchCommand",
+      "setNativeProps",
+      "measureLayout",
+      "measure",
+      "measureInWindow",
+      "sendAccessibilityEvent",
+      "configureNextLayoutAnimation",
+      "unstable_getCurrentEventPriority"};
+};
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+auto contextContainer = std::make_shared<const ContextContainer>();
+auto uiManager = std::make_shared<UIManager>(
+    [](std::function<void(jsi::Runtime&)>&& callback) {
+      callback(*runtime);
+    },
+    contextContainer);
+
+static jsi::Function createCallLoop(const std::string& globalName) {
+  auto source = "(function(count) { var manager = " + globalName +
+      "; var result = 0; for (var i = 0; i < count; i++) {" +
+      " result += manager.unstable_getCurrentEventPriority(); }" +
+      " return result; })";
+  return runtime
+      ->evaluateJavaScript(std::make_shared<jsi::StringBuffer>(source), "")
+      .asObject(*runtime)
+      .asFunction(*runtime);
+}
+
+static void uncachedHostFunctionCalls(benchmark::State& state) {
+  runtime->global().setProperty(
+      *runtime,
+      "uncachedBinding",
+      jsi::Object::createFromHostObject(
+          *runtime, std::make_shared<UncachedBinding>()));
+  auto callLoop = createCallLoop("uncachedBinding");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(callLoop.call(*runtime, kCallsPerIteration));
+  }
+  state.SetItemsProcessed(state.iterations() * kCallsPerIteration);
+}
+BENCHMARK(uncachedHostFunctionCalls);
+
+static void uiManagerBindingHostFunctionCalls(benchmark::State& state) {
+  UIManagerBinding::createAndInstallIfNeeded(*runtime, uiManager);
+  auto callLoop = createCallLoop("nativeFabricUIManager");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(callLoop.call(*runtime, kCallsPerIteration));
+  }
+  state.SetItemsProcessed(state.iterations() * kCallsPerIteration);
+}
+BENCHMARK(uiManagerBindingHostFunctionCalls);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
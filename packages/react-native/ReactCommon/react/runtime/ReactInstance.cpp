@@ -20,6 +20,7 @@
 #include <jsinspector-modern/HostTarget.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeMemoryPool.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerBinding.h>
 #include <react/runtime/JSRuntimeBindings.h>
 #include <react/timing/primitives.h>
@@ -682,6 +683,9 @@ void ReactInstance::handleMemoryPressureJs(int pressureLevel) {
       runtimeScheduler_->scheduleWork([=](jsi::Runtime& runtime) {
         TraceSection s("ReactInstance::handleMemoryPressure");
         runtime.instrumentation().collectGarbage(levelName);
+        // Shadow nodes referenced only by collected JS objects are released
+        // by the collection.
+        ShadowNodeMemoryPool::shared().trim();
       });
       break;
     default:
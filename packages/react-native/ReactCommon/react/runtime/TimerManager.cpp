@@ -53,8 +53,13 @@ inline const char* getTimerSourceName(TimerSource source) {
 } // namespace
 
 TimerManager::TimerManager(
-    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept
-    : platformTimerRegistry_(std::move(platformTimerRegistry)) {}
+    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+    bool coalesceTimers,
+    std::function<HighResTimeStamp()> now) noexcept
+    : platformTimerRegistry_(std::move(platformTimerRegistry)),
+      coalesceTimers_(coalesceTimers),
+      now_(std::move(now)),
+      timeOrigin_(now_()) {}
 
 TimerManager::~TimerManager() noexcept {
   quit();
@@ -97,9 +102,14 @@ TimerHandle TimerManager::createTimer(
           std::move(callback),
           std::move(args),
           /* repeat */ false,
-          source));
+          source,
+          delay));
 
-  platformTimerRegistry_->createTimer(timerID, delay);
+  if (coalesceTimers_) {
+    scheduleCoalescedTimer(timerID, delay);
+  } else {
+    platformTimerRegistry_->createTimer(timerID, delay);
+  }
 
   return timerID;
 }
@@ -125,9 +135,17 @@ TimerHandle TimerManager::createRecurringTimer(
       std::piecewise_construct,
       std::forward_as_tuple(timerID),
       std::forward_as_tuple(
-          std::move(callback), std::move(args), /* repeat */ true, source));
+          std::move(callback),
+          std::move(args),
+          /* repeat */ true,
+          source,
+          delay));
 
-  platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  if (coalesceTimers_) {
+    scheduleCoalescedTimer(timerID, delay);
+  } else {
+    platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  }
 
   return timerID;
 }
@@ -137,8 +155,7 @@ void TimerManager::deleteTimer(jsi::Runtime& runtime, TimerHandle timerHandle) {
     throw jsi::JSError(runtime, "clearTimeout called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
-  timers_.erase(timerHandle);
+  cancelTimer(timerHandle);
 }
 
 void TimerManager::deleteRecurringTimer(
@@ -148,11 +165,151 @@ void TimerManager::deleteRecurringTimer(
     throw jsi::JSError(runtime, "clearInterval called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
+  cancelTimer(timerHandle);
+}
+
+void TimerManager::cancelTimer(TimerHandle timerHandle) {
+  if (!coalesceTimers_) {
+    platformTimerRegistry_->deleteTimer(timerHandle);
+  } else if (timerWheel_.cancel(timerHandle) && timerWheel_.empty()) {
+    // The wakeup timer is left alone while there are other timers; if it was
+    // scheduled for the cancelled timer, it just reschedules itself when it
+    // fires.
+    if (wakeupTick_ && platformTimerRegistry_ != nullptr) {
+      platformTimerRegistry_->deleteTimer(WakeupTimerHandle);
+    }
+    wakeupTick_.reset();
+  }
   timers_.erase(timerHandle);
 }
 
+TimerWheel::Tick TimerManager::tickFromTimeStamp(
+    HighResTimeStamp timeStamp) const {
+  auto nanoseconds = (timeStamp - timeOrigin_).toNanoseconds();
+  return nanoseconds > 0 ? static_cast<TimerWheel::Tick>(nanoseconds) / 1000000
+                         : 0;
+}
+
+TimerWheel::Tick TimerManager::expirationTickForDelay(double delay) const {
+  // Rounding up, so that timers never fire before their delay elapses.
+  auto nanoseconds = (now_() - timeOrigin_).toNanoseconds() +
+      static_cast<int64_t>(std::ceil(delay * 1000000));
+  return nanoseconds > 0
+      ? (static_cast<TimerWheel::Tick>(nanoseconds) + 999999) / 1000000
+      : 0;
+}
+
+void TimerManager::scheduleCoalescedTimer(TimerHandle handle, double delay) {
+  if (timerWheel_.empty()) {
+    // Catching up with the time passed since the wheel was last advanced, so
+    // that the wheel does not need to wake up only to catch up. An empty
+    // wheel has no timers to expire. This may run from a timer callback, so
+    // it must not touch the timers `callExpiredTimers` is iterating.
+    auto noExpiredTimers = std::vector<TimerWheel::ExpiredTimer>{};
+    timerWheel_.advance(tickFromTimeStamp(now_()), noExpiredTimers);
+  }
+  timerWheel_.schedule(handle, expirationTickForDelay(delay));
+  updateWakeupTimer();
+}
+
+void TimerManager::updateWakeupTimer() {
+  if (platformTimerRegistry_ == nullptr) {
+    return;
+  }
+
+  auto nextExpirationTick = timerWheel_.nextExpirationTick();
+  if (!nextExpirationTick ||
+      (wakeupTick_ && *wakeupTick_ <= *nextExpirationTick)) {
+    // The wakeup timer fires early enough already.
+    return;
+  }
+
+  if (wakeupTick_) {
+    platformTimerRegistry_->deleteTimer(WakeupTimerHandle);
+  }
+  wakeupTick_ = nextExpirationTick;
+
+  auto wakeupTime = timeOrigin_ +
+      HighResDuration::fromMilliseconds(
+          static_cast<int64_t>(*nextExpirationTick));
+  auto delay = std::max(0.0, (wakeupTime - now_()).toDOMHighResTimeStamp());
+  platformTimerRegistry_->createTimer(WakeupTimerHandle, delay);
+}
+
+void TimerManager::callExpiredTimers(jsi::Runtime& runtime) {
+  // Timer callbacks may schedule and cancel timers, so the expired timers are
+  // kept in a local vector (reusing the storage of the previous wakeup).
+  auto expiredTimers = std::move(expiredTimers_);
+  expiredTimers.clear();
+  timerWheel_.advance(tickFromTimeStamp(now_()), expiredTimers);
+
+  TraceSection s(
+      "TimerManager::callExpiredTimers", "count", expiredTimers.size());
+
+  for (size_t index = 0; index < expiredTimers.size(); index++) {
+    auto timerHandle = expiredTimers[index].handle;
+    auto it = timers_.find(timerHandle);
+    if (it == timers_.end()) {
+      continue;
+    }
+
+    auto& timerCallback = it->second;
+    bool repeats = timerCallback.repeat;
+
+    try {
+      TraceSection s(
+          "TimerManager::callTimer",
+          "id",
+          timerHandle,
+          "type",
+          getTimerSourceName(timerCallback.source));
+      timerCallback.invoke(runtime);
+    } catch (...) {
+      // The timers which did not get to run are called on the next wakeup.
+      for (size_t next = index + 1; next < expiredTimers.size(); next++) {
+        timerWheel_.schedule(
+            expiredTimers[next].handle, expiredTimers[next].expirationTick);
+      }
+      if (!repeats) {
+        timers_.erase(timerHandle);
+      } else if (timers_.contains(timerHandle)) {
+        timerWheel_.schedule(
+            timerHandle, expirationTickForDelay(timers_.at(timerHandle).delay));
+      }
+      updateWakeupTimer();
+      throw;
+    }
+
+    // Invoking a timer has the potential to delete it (or, for intervals, to
+    // clear it). Do not re-use the existing iterator.
+    if (!repeats) {
+      timers_.erase(timerHandle);
+    } else if (auto interval = timers_.find(timerHandle);
+               interval != timers_.end()) {
+      timerWheel_.schedule(
+          timerHandle, expirationTickForDelay(interval->second.delay));
+    }
+  }
+
+  expiredTimers_ = std::move(expiredTimers);
+}
+
 void TimerManager::callTimer(TimerHandle timerHandle) {
+  if (coalesceTimers_ && timerHandle == WakeupTimerHandle) {
+    runtimeExecutor_([this](jsi::Runtime& runtime) {
+      // Platform timers may fire slightly early, or after the wakeup has been
+      // rescheduled; the wakeup timer is always scheduled anew.
+      if (wakeupTick_ && platformTimerRegistry_ != nullptr) {
+        platformTimerRegistry_->deleteTimer(WakeupTimerHandle);
+      }
+      wakeupTick_.reset();
+
+      callExpiredTimers(runtime);
+      updateWakeupTimer();
+    });
+    return;
+  }
+
   runtimeExecutor_([this, timerHandle](jsi::Runtime& runtime) {
     auto it = timers_.find(timerHandle);
     if (it != timers_.end()) {
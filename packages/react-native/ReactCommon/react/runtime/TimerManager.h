@@ -8,10 +8,14 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/timing/primitives.h>
+#include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "PlatformTimerRegistry.h"
+#include "TimerWheel.h"
 
 namespace facebook::react {
 
@@ -27,8 +31,9 @@ struct TimerCallback {
       jsi::Function callback,
       std::vector<jsi::Value> args,
       bool repeat,
-      TimerSource source = TimerSource::Unknown)
-      : callback_(std::move(callback)), args_(std::move(args)), repeat(repeat), source(source)
+      TimerSource source = TimerSource::Unknown,
+      double delay = 0)
+      : callback_(std::move(callback)), args_(std::move(args)), repeat(repeat), source(source), delay(delay)
   {
   }
 
@@ -41,11 +46,22 @@ struct TimerCallback {
   const std::vector<jsi::Value> args_;
   bool repeat;
   TimerSource source;
+  double delay;
 };
 
 class TimerManager {
  public:
-  explicit TimerManager(std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept;
+  /*
+   * If `coalesceTimers` is `true`, JS timers are kept in a `TimerWheel` and
+   * the platform registry is asked for a single timer (with
+   * `TimerManager::WakeupTimerHandle`) which fires at the next expiration;
+   * expired timers are then invoked in a single runtime executor call.
+   * Otherwise, every JS timer is a separate platform timer.
+   */
+  explicit TimerManager(
+      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+      bool coalesceTimers = false,
+      std::function<HighResTimeStamp()> now = HighResTimeStamp::now) noexcept;
   TimerManager(const TimerManager &) = delete;
   TimerManager(TimerManager &&) = delete;
   TimerManager &operator=(const TimerManager &) = delete;
@@ -54,6 +70,13 @@ class TimerManager {
 
   void setRuntimeExecutor(RuntimeExecutor runtimeExecutor) noexcept;
 
+  /*
+   * Handle of the platform timer used for waking up coalesced timers.
+   * JS timer handles start at 1, and 0 is never returned to JS as a valid
+   * handle.
+   */
+  static constexpr TimerHandle WakeupTimerHandle = 0;
+
   void callTimer(TimerHandle handle);
 
   void attachGlobals(jsi::Runtime &runtime);
@@ -77,6 +100,14 @@ class TimerManager {
 
   void deleteRecurringTimer(jsi::Runtime &runtime, TimerHandle handle);
 
+  void cancelTimer(TimerHandle handle);
+
+  TimerWheel::Tick tickFromTimeStamp(HighResTimeStamp timeStamp) const;
+  TimerWheel::Tick expirationTickForDelay(double delay) const;
+  void scheduleCoalescedTimer(TimerHandle handle, double delay);
+  void callExpiredTimers(jsi::Runtime &runtime);
+  void updateWakeupTimer();
+
   RuntimeExecutor runtimeExecutor_;
   std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry_;
 
@@ -88,6 +119,18 @@ class TimerManager {
   // As per WHATWG HTML 8.6.1 (Timers) ids must be greater than zero, i.e. start
   // at 1
   TimerHandle timerIndex_{1};
+
+  const bool coalesceTimers_;
+  const std::function<HighResTimeStamp()> now_;
+
+  // Ticks of the wheel are milliseconds since this time stamp.
+  const HighResTimeStamp timeOrigin_;
+  TimerWheel timerWheel_;
+
+  // The tick at which the wakeup platform timer fires, if it is scheduled.
+  std::optional<TimerWheel::Tick> wakeupTick_;
+  // Storage for the timers expired by a wakeup, reused by the next one.
+  std::vector<TimerWheel::ExpiredTimer> expiredTimers_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace facebook::react {
+
+TimerWheel::TimerWheel(Tick currentTick) : currentTick_(currentTick) {}
+
+void TimerWheel::schedule(Handle handle, Tick expirationTick) {
+  auto nodeIndex = kInvalidNodeIndex;
+  if (auto it = handleToNode_.find(handle); it != handleToNode_.end()) {
+    nodeIndex = it->second;
+    unlink(nodeIndex);
+  } else {
+    if (!freeNodes_.empty()) {
+      nodeIndex = freeNodes_.back();
+      freeNodes_.pop_back();
+    } else {
+      nodeIndex = static_cast<NodeIndex>(nodes_.size());
+      nodes_.emplace_back();
+    }
+    handleToNode_.emplace(handle, nodeIndex);
+  }
+
+  auto& node = nodes_[nodeIndex];
+  node.handle = handle;
+  node.expirationTick = expirationTick;
+  // The current tick has been processed already.
+  insert(nodeIndex, currentTick_ + 1);
+}
+
+bool TimerWheel::cancel(Handle handle) {
+  auto it = handleToNode_.find(handle);
+  if (it == handleToNode_.end()) {
+    return false;
+  }
+
+  unlink(it->second);
+  freeNodes_.push_back(it->second);
+  handleToNode_.erase(it);
+  return true;
+}
+
+void TimerWheel::advance(Tick tick, std::vector<ExpiredTimer>& expiredTimers) {
+  while (currentTick_ < tick) {
+    auto nextTick = nextExpirationTick();
+    if (!nextTick || *nextTick > tick) {
+      // Nothing happens until the given tick.
+      currentTick_ = tick;
+      break;
+    }
+
+    currentTick_ = *nextTick;
+
+    // Redistributing the timers from the slots reached by higher levels
+    // (from the highest one, so that timers can move down several levels)
+    // before expiring the timers of the current tick.
+    for (auto level = kLevelCount - 1; level > 0; level--) {
+      if (currentTick_ % slotDuration(level) == 0) {
+        cascade(level);
+      }
+    }
+
+    auto batchBegin = expiredTimers.size();
+    expireCurrentSlot(expiredTimers);
+    std::sort(
+        expiredTimers.begin() + static_cast<ptrdiff_t>(batchBegin),
+        expiredTimers.end(),
+        [](const ExpiredTimer& lhs, const ExpiredTimer& rhs) {
+          return lhs.expirationTick != rhs.expirationTick
+              ? lhs.expirationTick < rhs.expirationTick
+              : lhs.handle < rhs.handle;
+        });
+  }
+}
+
+std::optional<TimerWheel::Tick> TimerWheel::nextExpirationTick() const {
+  auto result = std::optional<Tick>{};
+  for (size_t level = 0; level < kLevelCount; level++) {
+    if (levels_[level].nodeCount == 0) {
+      continue;
+    }
+
+    // The slot of the current tick has been processed already; the search
+    // starts from the next one and wraps around to it.
+    auto currentSlotIndex = currentTick_ >> (kSlotBits * level);
+    auto fromSlot = static_cast<size_t>((currentSlotIndex + 1) % kSlotCount);
+    auto slot = nextOccupiedSlot(level, fromSlot);
+    if (!slot) {
+      continue;
+    }
+
+    auto distance = (*slot + kSlotCount - fromSlot) % kSlotCount + 1;
+    auto tick = (currentSlotIndex + distance) << (kSlotBits * level);
+    if (!result || tick < *result) {
+      result = tick;
+    }
+  }
+  return result;
+}
+
+void TimerWheel::insert(NodeIndex nodeIndex, Tick earliestTick) {
+  auto& node = nodes_[nodeIndex];
+  auto tick = std::max(node.expirationTick, earliestTick);
+
+  auto level = size_t{0};
+  while (level < kLevelCount - 1 &&
+         tick - currentTick_ >= slotDuration(level + 1)) {
+    level++;
+  }
+  // Timers beyond the range of the wheel stay in the highest level and are
+  // redistributed to it again until they get into the range.
+  tick = std::min(tick, currentTick_ + slotDuration(kLevelCount) - 1);
+
+  auto slotIndex =
+      static_cast<size_t>((tick >> (kSlotBits * level)) % kSlotCount);
+  auto& wheelLevel = levels_[level];
+  auto& slot = wheelLevel.slots[slotIndex];
+
+  node.level = static_cast<uint16_t>(level);
+  node.slot = static_cast<uint16_t>(slotIndex);
+  node.previous = slot.tail;
+  node.next = kInvalidNodeIndex;
+  if (slot.tail != kInvalidNodeIndex) {
+    nodes_[slot.tail].next = nodeIndex;
+  } else {
+    slot.head = nodeIndex;
+  }
+  slot.tail = nodeIndex;
+
+  wheelLevel.occupiedSlots[slotIndex / 64] |= uint64_t{1} << (slotIndex % 64);
+  wheelLevel.nodeCount++;
+}
+
+void TimerWheel::unlink(NodeIndex nodeIndex) {
+  auto& node = nodes_[nodeIndex];
+  auto& wheelLevel = levels_[node.level];
+  auto& slot = wheelLevel.slots[node.slot];
+
+  if (node.previous != kInvalidNodeIndex) {
+    nodes_[node.previous].next = node.next;
+  } else {
+    slot.head = node.next;
+  }
+  if (node.next != kInvalidNodeIndex) {
+    nodes_[node.next].previous = node.previous;
+  } else {
+    slot.tail = node.previous;
+  }
+  node.previous = kInvalidNodeIndex;
+  node.next = kInvalidNodeIndex;
+
+  if (slot.head == kInvalidNodeIndex) {
+    wheelLevel.occupiedSlots[node.slot / 64] &=
+        ~(uint64_t{1} << (node.slot % 64));
+  }
+  wheelLevel.nodeCount--;
+}
+
+void TimerWheel::cascade(size_t level) {
+  auto slotIndex =
+      static_cast<size_t>((currentTick_ >> (kSlotBits * level)) % kSlotCount);
+  auto& wheelLevel = levels_[level];
+  auto& slot = wheelLevel.slots[slotIndex];
+
+  auto nodeIndex = slot.head;
+  while (nodeIndex != kInvalidNodeIndex) {
+    auto nextNodeIndex = nodes_[nodeIndex].next;
+    unlink(nodeIndex);
+    // Redistribution happens before the current tick is processed.
+    insert(nodeIndex, currentTick_);
+    nodeIndex = nextNodeIndex;
+  }
+}
+
+void TimerWheel::expireCurrentSlot(std::vector<ExpiredTimer>& expiredTimers) {
+  auto slotIndex = static_cast<size_t>(currentTick_ % kSlotCount);
+  auto nodeIndex = levels_[0].slots[slotIndex].head;
+  while (nodeIndex != kInvalidNodeIndex) {
+    auto& node = nodes_[nodeIndex];
+    auto nextNodeIndex = node.next;
+    unlink(nodeIndex);
+    expiredTimers.push_back(ExpiredTimer{
+        .handle = node.handle, .expirationTick = node.expirationTick});
+    handleToNode_.erase(node.handle);
+    freeNodes_.push_back(nodeIndex);
+    nodeIndex = nextNodeIndex;
+  }
+}
+
+std::optional<size_t> TimerWheel::nextOccupiedSlot(
+    size_t level,
+    size_t fromSlot) const {
+  const auto& occupiedSlots = levels_[level].occupiedSlots;
+  // Scanning the bitmap words starting from the word of `fromSlot`, masking
+  // out the bits before it, and wrapping around to that word's lower bits.
+  for (size_t step = 0; step <= kBitmapWordCount; step++) {
+    auto wordIndex = (fromSlot / 64 + step) % kBitmapWordCount;
+    auto word = occupiedSlots[wordIndex];
+    if (step == 0) {
+      word &= ~uint64_t{0} << (fromSlot % 64);
+    } else if (step == kBitmapWordCount) {
+      word &= (uint64_t{1} << (fromSlot % 64)) - 1;
+    }
+    if (word != 0) {
+      return wordIndex * 64 + static_cast<size_t>(std::countr_zero(word));
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * Keeps timers (identified by `int32_t` handles) which expire at given ticks.
+ * Level 0 has a slot for every one of the next 256 ticks, every next level
+ * has slots which are 256 times longer; timers from a slot of a higher level
+ * are redistributed to lower levels once the wheel reaches the slot.
+ * Scheduling and cancelling a timer are O(1); advancing the wheel is
+ * proportional to the number of expired and redistributed timers, empty
+ * stretches of time are skipped.
+ *
+ * Not thread-safe.
+ */
+class TimerWheel final {
+ public:
+  using Tick = uint64_t;
+  using Handle = int32_t;
+
+  struct ExpiredTimer {
+    Handle handle;
+    Tick expirationTick;
+  };
+
+  explicit TimerWheel(Tick currentTick = 0);
+
+  /*
+   * Schedules the timer with the given handle to expire at the given tick;
+   * ticks which are not in the future are treated as the next tick.
+   * A timer which is already scheduled is rescheduled.
+   */
+  void schedule(Handle handle, Tick expirationTick);
+
+  /*
+   * Cancels the timer with the given handle. Returns `false` if the timer is
+   * not scheduled.
+   */
+  bool cancel(Handle handle);
+
+  /*
+   * Advances the wheel to the given tick and appends all timers expiring by
+   * then to `expiredTimers`, ordered by the expiration tick and then by the
+   * handle.
+   */
+  void advance(Tick tick, std::vector<ExpiredTimer> &expiredTimers);
+
+  /*
+   * Returns the earliest tick at which `advance` may return an expired timer,
+   * or `std::nullopt` if the wheel is empty. The returned tick is never later
+   * than the expiration of any timer, but may be earlier.
+   */
+  std::optional<Tick> nextExpirationTick() const;
+
+  Tick getCurrentTick() const
+  {
+    return currentTick_;
+  }
+
+  size_t size() const
+  {
+    return handleToNode_.size();
+  }
+
+  bool empty() const
+  {
+    return handleToNode_.empty();
+  }
+
+ private:
+  static constexpr size_t kLevelCount = 4;
+  static constexpr size_t kSlotBits = 8;
+  static constexpr size_t kSlotCount = size_t{1} << kSlotBits;
+  static constexpr size_t kBitmapWordCount = kSlotCount / 64;
+
+  using NodeIndex = uint32_t;
+  static constexpr NodeIndex kInvalidNodeIndex = UINT32_MAX;
+
+  struct Node {
+    Handle handle{0};
+    Tick expirationTick{0};
+    NodeIndex previous{kInvalidNodeIndex};
+    NodeIndex next{kInvalidNodeIndex};
+    uint16_t level{0};
+    uint16_t slot{0};
+  };
+
+  struct Slot {
+    NodeIndex head{kInvalidNodeIndex};
+    NodeIndex tail{kInvalidNodeIndex};
+  };
+
+  struct Level {
+    std::array<Slot, kSlotCount> slots{};
+    // A bit for every non-empty slot.
+    std::array<uint64_t, kBitmapWordCount> occupiedSlots{};
+    size_t nodeCount{0};
+  };
+
+  static constexpr Tick slotDuration(size_t level)
+  {
+    return Tick{1} << (kSlotBits * level);
+  }
+
+  void insert(NodeIndex nodeIndex, Tick earliestTick);
+  void unlink(NodeIndex nodeIndex);
+  void cascade(size_t level);
+  void expireCurrentSlot(std::vector<ExpiredTimer> &expiredTimers);
+  std::optional<size_t> nextOccupiedSlot(size_t level, size_t fromSlot) const;
+
+  Tick currentTick_;
+  std::array<Level, kLevelCount> levels_{};
+  std::vector<Node> nodes_;
+  std::vector<NodeIndex> freeNodes_;
+  std::unordered_map<Handle, NodeIndex> handleToNode_;
+};
+
+} // namespace facebook::react
@@ -33,6 +33,7 @@
 #import <React/RCTPerformanceLogger.h>
 #import <React/RCTRedBox.h>
 #import <React/RCTSurfacePresenter.h>
+#import <React/RCTUtils.h>
 #import <ReactCommon/RCTTurboModule.h>
 #import <ReactCommon/RCTTurboModuleManager.h>
 #import <ReactCommon/RuntimeExecutor.h>
@@ -42,6 +43,7 @@
 #import <jsireact/JSIExecutor.h>
 #import <react/featureflags/ReactNativeFeatureFlags.h>
 #import <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
+#import <react/renderer/textlayoutmanager/PersistentTextMeasureCache.h>
 #import <react/utils/ContextContainer.h>
 #import <react/utils/FollyConvert.h>
 #import <react/utils/ManagedObjectWrapper.h>
@@ -72,6 +74,30 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
   sRuntimeDiagnosticFlags = [flags copy];
 }
 
+static std::shared_ptr<PersistentTextMeasureCache> RCTCreatePersistentTextMeasureCache(void)
+{
+  NSString *cachesDirectory =
+      NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+  NSString *filePath = [cachesDirectory stringByAppendingPathComponent:@"RCTTextMeasureCache"];
+
+  // System fonts change with OS updates, and fonts bundled with the app change with app updates.
+  NSString *fontConfiguration = [NSString stringWithFormat:@"%@/%@",
+                                                           [UIDevice currentDevice].systemVersion,
+                                                           [NSBundle.mainBundle objectForInfoDictionaryKey:@"CFBundleVersion"]];
+
+  __block CGFloat fontScale = 1;
+  RCTUnsafeExecuteOnMainQueueSync(^{
+    fontScale = RCTFontSizeMultiplier();
+  });
+
+  return std::make_shared<PersistentTextMeasureCache>(
+      filePath.UTF8String, fontConfiguration.hash, fontScale, [](std::function<void()> &&task) {
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+          task();
+        });
+      });
+}
+
 @interface RCTBridgelessDisplayLinkModuleHolder : NSObject <RCTDisplayLinkModuleHolder>
 - (instancetype)initWithModule:(id<RCTBridgeModule>)module;
 @end
@@ -308,7 +334,8 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
   auto timing = objCTimerRegistry->timing;
   auto *objCTimerRegistryRawPtr = objCTimerRegistry.get();
 
-  auto timerManager = std::make_shared<TimerManager>(std::move(objCTimerRegistry));
+  auto timerManager =
+      std::make_shared<TimerManager>(std::move(objCTimerRegistry), ReactNativeFeatureFlags::enableCoalescedTimers());
   objCTimerRegistryRawPtr->setTimerManager(timerManager);
 
   __weak __typeof(self) weakSelf = self;
@@ -418,6 +445,9 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
   contextContainer->insert("RCTBridgeModuleDecorator", facebook::react::wrapManagedObject(_bridgeModuleDecorator));
   contextContainer->insert(RuntimeSchedulerKey, std::weak_ptr<RuntimeScheduler>(_reactInstance->getRuntimeScheduler()));
   contextContainer->insert("RCTBridgeProxy", facebook::react::wrapManagedObject(bridgeProxy));
+  if (ReactNativeFeatureFlags::enablePersistentTextMeasureCache()) {
+    contextContainer->insert(PersistentTextMeasureCache::ContextContainerKey, RCTCreatePersistentTextMeasureCache());
+  }
 
   _surfacePresenter = [[RCTSurfacePresenter alloc]
         initWithContextContainer:contextContainer
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/TimerManager.h>
+#include <map>
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+namespace facebook::react {
+
+constexpr int kTimerCount = 10000;
+
+/*
+ * Keeps platform timers in a single queue ordered by their firing time, like
+ * the message queue of a platform looper, and fires them as its clock is
+ * advanced.
+ */
+class QueuePlatformTimerRegistry : public PlatformTimerRegistry {
+ public:
+  void createTimer(uint32_t timerID, double delayMS) override {
+    deleteTimer(timerID);
+    entries_.emplace(timerID, queue_.emplace(now_ + delayMS, timerID));
+  }
+
+  void deleteTimer(uint32_t timerID) override {
+    if (auto it = entries_.find(timerID); it != entries_.end()) {
+      queue_.erase(it->second);
+      entries_.erase(it);
+    }
+  }
+
+  void createRecurringTimer(uint32_t timerID, double delayMS) override {
+    createTimer(timerID, delayMS);
+  }
+
+  /*
+   * Advances the clock by a millisecond and fires the timers which expired.
+   */
+  void advance(TimerManager& timerManager) {
+    now_++;
+    while (!queue_.empty() && queue_.begin()->first <= now_) {
+      auto timerID = queue_.begin()->second;
+      entries_.erase(timerID);
+      queue_.erase(queue_.begin());
+      timerManager.callTimer(static_cast<TimerHandle>(timerID));
+    }
+  }
+
+  double now() const {
+    return now_;
+  }
+
+ private:
+  using Queue = std::multimap<double, uint32_t>;
+
+  double now_{0};
+  Queue queue_;
+  std::unordered_map<uint32_t, Queue::iterator> entries_;
+};
+
+/*
+ * Delays (in milliseconds) of a mix of debounces, animations and polling.
+ */
+static jsi::Array createDelays(jsi::Runtime& runtime) {
+  auto random = std::mt19937{7};
+  auto delays = jsi::Array(runtime, kTimerCount);
+  for (size_t i = 0; i < kTimerCount; i++) {
+    switch (random() % 3) {
+      case 0:
+        delays.setValueAtIndex(runtime, i, static_cast<double>(random() % 17));
+        break;
+      case 1:
+        delays.setValueAtIndex(
+            runtime, i, static_cast<double>(100 + random() % 300));
+        break;
+      default:
+        delays.setValueAtIndex(
+            runtime, i, static_cast<double>(1000 + random() % 60000));
+        break;
+    }
+  }
+  return delays;
+}
+
+/*
+ * Schedules a timer for every delay and cancels every other timer before it
+ * fires, advancing the clock by a millisecond every 100 timers.
+ */
+constexpr auto kScheduleTimers = R"(
+(function(delays, advance) {
+  var fired = 0;
+  function onTimeout() {
+    fired++;
+  }
+  var previousHandle = 0;
+  for (var i = 0; i < delays.length; i++) {
+    var handle = setTimeout(onTimeout, delays[i]);
+    if (i % 2 === 1) {
+      clearTimeout(previousHandle);
+    }
+    previousHandle = handle;
+    if (i % 100 === 0) {
+      advance();
+    }
+  }
+  return fired;
+})
+)";
+
+static void scheduleTimers(benchmark::State& state, bool coalesceTimers) {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto delays = createDelays(*runtime);
+  auto scheduleTimersFunction =
+      runtime
+          ->evaluateJavaScript(
+              std::make_shared<jsi::StringBuffer>(kScheduleTimers), "")
+          .asObject(*runtime)
+          .asFunction(*runtime);
+
+  for (auto _ : state) {
+    auto platformTimerRegistry = std::make_unique<QueuePlatformTimerRegistry>();
+    auto* platformTimers = platformTimerRegistry.get();
+    auto timeOrigin = HighResTimeStamp::now();
+    auto timerManager = std::make_shared<TimerManager>(
+        std::move(platformTimerRegistry), coalesceTimers, [=]() {
+          return timeOrigin +
+              HighResDuration::fromDOMHighResTimeStamp(platformTimers->now());
+        });
+    timerManager->setRuntimeExecutor(
+        [&](std::function<void(jsi::Runtime & runtime)>&& callback) {
+          callback(*runtime);
+        });
+    timerManager->attachGlobals(*runtime);
+
+    auto advance = jsi::Function::createFromHostFunction(
+        *runtime,
+        jsi::PropNameID::forAscii(*runtime, "advance"),
+        0,
+        [&](jsi::Runtime& /*runtime*/,
+            const jsi::Value& /*thisValue*/,
+            const jsi::Value* /*arguments*/,
+            size_t /*count*/) {
+          platformTimers->advance(*timerManager);
+          return jsi::Value::undefined();
+        });
+
+    benchmark::DoNotOptimize(
+        scheduleTimersFunction.call(*runtime, delays, advance));
+  }
+  state.SetItemsProcessed(state.iterations() * kTimerCount);
+}
+
+/*
+ * The baseline: every JS timer is a separate platform timer.
+ */
+static void platformTimers(benchmark::State& state) {
+  scheduleTimers(state, /* coalesceTimers */ false);
+}
+BENCHMARK(platformTimers);
+
+static void coalescedTimers(benchmark::State& state) {
+  scheduleTimers(state, /* coalesceTimers */ true);
+}
+BENCHMARK(coalescedTimers);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -124,7 +124,7 @@ class ReactInstanceTest : public ::testing::Test {
     messageQueueThread_ = std::make_shared<MockMessageQueueThread>();
     auto mockRegistry = std::make_unique<MockTimerRegistry>();
     mockRegistry_ = mockRegistry.get();
-    timerManager_ = std::make_shared<TimerManager>(std::move(mockRegistry));
+    timerManager_ = createTimerManager(std::move(mockRegistry));
     auto onJsError =
         [](jsi::Runtime& /*runtime*/,
            const JsErrorHandler::ProcessedError& /*error*/) noexcept {
@@ -146,6 +146,11 @@ class ReactInstanceTest : public ::testing::Test {
         jsi::Object::createFromHostObject(*runtime_, errorHandler_));
   }
 
+  virtual std::shared_ptr<TimerManager> createTimerManager(
+      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) {
+    return std::make_shared<TimerManager>(std::move(platformTimerRegistry));
+  }
+
   void initializeRuntimeWithScript(
       ReactInstance::JSRuntimeFlags jsRuntimeFlags,
       std::string script) {
@@ -746,4 +751,152 @@ function getResult() {
   EXPECT_EQ(result.getNumber(), 1);
 }
 
+class ReactInstanceCoalescedTimersTest : public ReactInstanceTest {
+ protected:
+  std::shared_ptr<TimerManager> createTimerManager(
+      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) override {
+    return std::make_shared<TimerManager>(
+        std::move(platformTimerRegistry),
+        /* coalesceTimers */ true,
+        [this]() { return now_; });
+  }
+
+  // Advances the clock and fires the wakeup timer.
+  void wakeUpAfter(double milliseconds) {
+    now_ = now_ + HighResDuration::fromDOMHighResTimeStamp(milliseconds);
+    timerManager_->callTimer(TimerManager::WakeupTimerHandle);
+    step();
+  }
+
+  std::string getResult() {
+    return runtime_->global()
+        .getPropertyAsFunction(*runtime_, "getResult")
+        .call(*runtime_)
+        .asString(*runtime_)
+        .utf8(*runtime_);
+  }
+
+  HighResTimeStamp now_{HighResTimeStamp::now()};
+};
+
+TEST_F(ReactInstanceCoalescedTimersTest, testSetTimeout) {
+  initializeRuntimeWithScript("");
+
+  // A single platform timer wakes up all the JS timers.
+  EXPECT_CALL(
+      *mockRegistry_, createTimer(TimerManager::WakeupTimerHandle, 100))
+      .Times(1);
+  EXPECT_CALL(*mockRegistry_, createTimer(TimerManager::WakeupTimerHandle, 50))
+      .Times(1);
+  eval(R"xyz123(
+let calls = [];
+setTimeout(() => {
+  calls.push('a');
+}, 100);
+setTimeout(() => {
+  calls.push('b');
+}, 150);
+setTimeout(() => {
+  calls.push('c');
+}, 100);
+function getResult() {
+  return calls.join(',');
+}
+  )xyz123");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "a,c");
+
+  wakeUpAfter(50);
+  EXPECT_EQ(getResult(), "a,c,b");
+}
+
+TEST_F(ReactInstanceCoalescedTimersTest, testSetTimeoutFromTimerCallback) {
+  initializeRuntimeWithScript("");
+
+  // When `a` runs, both expired timers have left the wheel; scheduling a
+  // timer from `a` must not drop `b`.
+  eval(R"xyz123(
+let calls = [];
+setTimeout(() => {
+  calls.push('a');
+  setTimeout(() => {
+    calls.push('c');
+  }, 10);
+  setInterval(() => {
+    calls.push('d');
+  }, 20);
+}, 100);
+setTimeout(() => {
+  calls.push('b');
+}, 100);
+function getResult() {
+  return calls.join(',');
+}
+  )xyz123");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "a,b");
+
+  wakeUpAfter(10);
+  EXPECT_EQ(getResult(), "a,b,c");
+
+  wakeUpAfter(10);
+  EXPECT_EQ(getResult(), "a,b,c,d");
+}
+
+TEST_F(ReactInstanceCoalescedTimersTest, testSetInterval) {
+  initializeRuntimeWithScript("");
+
+  eval(R"xyz123(
+let result = 0;
+const handle = setInterval(() => {
+  result++;
+}, 100);
+function clear() {
+  clearInterval(handle);
+}
+function getResult() {
+  return String(result);
+}
+  )xyz123");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "1");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "2");
+
+  runtime_->global().getPropertyAsFunction(*runtime_, "clear").call(*runtime_);
+  step();
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "2");
+}
+
+TEST_F(ReactInstanceCoalescedTimersTest, testClearTimeoutFromTimerCallback) {
+  initializeRuntimeWithScript("");
+
+  eval(R"xyz123(
+let calls = [];
+let handle;
+setTimeout(() => {
+  calls.push('a');
+  clearTimeout(handle);
+}, 100);
+handle = setTimeout(() => {
+  calls.push('b');
+}, 100);
+function getResult() {
+  return calls.join(',');
+}
+  )xyz123");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "a");
+
+  wakeUpAfter(100);
+  EXPECT_EQ(getResult(), "a");
+}
+
 } // namespace facebook::react
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/TimerWheel.h>
+
+namespace facebook::react {
+
+using Handles = std::vector<TimerWheel::Handle>;
+
+static Handles advance(TimerWheel& timerWheel, TimerWheel::Tick tick) {
+  auto expiredTimers = std::vector<TimerWheel::ExpiredTimer>{};
+  timerWheel.advance(tick, expiredTimers);
+  auto handles = Handles{};
+  for (const auto& expiredTimer : expiredTimers) {
+    handles.push_back(expiredTimer.handle);
+  }
+  return handles;
+}
+
+TEST(TimerWheelTest, expiresTimersInOrder) {
+  auto timerWheel = TimerWheel{1000};
+  timerWheel.schedule(1, 1300);
+  timerWheel.schedule(2, 1002);
+  timerWheel.schedule(3, 1002);
+  timerWheel.schedule(4, 100000);
+
+  EXPECT_EQ(timerWheel.nextExpirationTick(), 1002);
+  EXPECT_EQ(advance(timerWheel, 1001), Handles{});
+  EXPECT_EQ(advance(timerWheel, 1400), (Handles{2, 3, 1}));
+  EXPECT_EQ(timerWheel.size(), 1);
+  EXPECT_EQ(advance(timerWheel, 99999), Handles{});
+  EXPECT_EQ(advance(timerWheel, 100000), Handles{4});
+  EXPECT_TRUE(timerWheel.empty());
+  EXPECT_EQ(timerWheel.nextExpirationTick(), std::nullopt);
+}
+
+TEST(TimerWheelTest, expiresPastTimersOnNextTick) {
+  auto timerWheel = TimerWheel{1000};
+  timerWheel.schedule(1, 10);
+  timerWheel.schedule(2, 1000);
+
+  EXPECT_EQ(timerWheel.nextExpirationTick(), 1001);
+  EXPECT_EQ(advance(timerWheel, 1000), Handles{});
+  EXPECT_EQ(advance(timerWheel, 1001), (Handles{1, 2}));
+}
+
+TEST(TimerWheelTest, cancelsAndReschedulesTimers) {
+  auto timerWheel = TimerWheel{};
+  timerWheel.schedule(1, 10);
+  timerWheel.schedule(2, 20);
+  timerWheel.schedule(3, 30);
+
+  EXPECT_TRUE(timerWheel.cancel(2));
+  EXPECT_FALSE(timerWheel.cancel(2));
+  EXPECT_FALSE(timerWheel.cancel(42));
+  timerWheel.schedule(1, 40);
+
+  EXPECT_EQ(advance(timerWheel, 35), Handles{3});
+  EXPECT_EQ(advance(timerWheel, 40), Handles{1});
+  EXPECT_TRUE(timerWheel.empty());
+}
+
+TEST(TimerWheelTest, handlesTimersBeyondRange) {
+  auto timerWheel = TimerWheel{5};
+  auto farTick = (TimerWheel::Tick{1} << 34) + 17;
+  timerWheel.schedule(1, farTick);
+
+  EXPECT_EQ(advance(timerWheel, farTick - 1), Handles{});
+  EXPECT_EQ(advance(timerWheel, farTick), Handles{1});
+}
+
+TEST(TimerWheelTest, matchesReferenceImplementation) {
+  using Tick = TimerWheel::Tick;
+  static constexpr std::array<Tick, 5> kDelayRanges{
+      3, 300, 70000, 20000000, Tick{1} << 34};
+  static constexpr std::array<Tick, 4> kAdvanceRanges{
+      5, 1000, 100000, Tick{1} << 33};
+
+  auto random = std::mt19937_64{42};
+  auto tick = Tick{123456};
+  auto timerWheel = TimerWheel{tick};
+
+  // Handle => (effective expiration tick, requested expiration tick).
+  auto timers = std::map<TimerWheel::Handle, std::pair<Tick, Tick>>{};
+  auto nextHandle = TimerWheel::Handle{1};
+
+  for (int step = 0; step < 20000; step++) {
+    auto operation = random() % 10;
+    if (operation < 5) {
+      auto delay = random() % kDelayRanges[random() % kDelayRanges.size()];
+      timerWheel.schedule(nextHandle, tick + delay);
+      timers[nextHandle] = {std::max(tick + delay, tick + 1), tick + delay};
+      nextHandle++;
+    } else if (operation < 7 && !timers.empty()) {
+      auto it = std::next(
+          timers.begin(), static_cast<ptrdiff_t>(random() % timers.size()));
+      EXPECT_TRUE(timerWheel.cancel(it->first));
+      timers.erase(it);
+    } else {
+      auto nextExpirationTick = timerWheel.nextExpirationTick();
+      if (timers.empty()) {
+        EXPECT_EQ(nextExpirationTick, std::nullopt);
+      } else {
+        auto earliestTick = std::numeric_limits<Tick>::max();
+        for (const auto& [handle, ticks] : timers) {
+          earliestTick = std::min(earliestTick, ticks.first);
+        }
+        ASSERT_TRUE(nextExpirationTick.has_value());
+        EXPECT_GT(*nextExpirationTick, tick);
+        EXPECT_LE(*nextExpirationTick, earliestTick);
+      }
+
+      tick += random() % kAdvanceRanges[random() % kAdvanceRanges.size()];
+
+      // Timers expire by the tick, then by the requested tick, then by the
+      // handle.
+      auto expectedTimers =
+          std::vector<std::tuple<Tick, Tick, TimerWheel::Handle>>{};
+      for (auto it = timers.begin(); it != timers.end();) {
+        if (it->second.first <= tick) {
+          expectedTimers.emplace_back(
+              it->second.first, it->second.second, it->first);
+          it = timers.erase(it);
+        } else {
+          it++;
+        }
+      }
+      std::sort(expectedTimers.begin(), expectedTimers.end());
+      auto expectedHandles = Handles{};
+      for (const auto& expectedTimer : expectedTimers) {
+        expectedHandles.push_back(std::get<2>(expectedTimer));
+      }
+
+      ASSERT_EQ(advance(timerWheel, tick), expectedHandles);
+    }
+    ASSERT_EQ(timerWheel.size(), timers.size());
+  }
+}
+
+} // namespace facebook::react
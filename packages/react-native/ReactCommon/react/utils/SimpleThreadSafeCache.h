@@ -7,10 +7,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
-#include <list>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 namespace facebook::react {
 
@@ -20,14 +28,40 @@ concept CacheGeneratorFunction = std::invocable<GeneratorT> && std::same_as<std:
 /*
  * Simple thread-safe LRU cache.
  *
+ * The cache is split into shards (selected by the hash of the key), each with
+ * its own lock and LRU list, so lookups of different keys rarely contend.
+ * Small caches use a single shard and therefore have exact LRU semantics.
+ * Generators run outside of any lock; concurrent requests for a key which is
+ * being generated wait for that generator instead of running their own.
+ * Entries are stored in per-shard node pools and evicted nodes are reused for
+ * new entries.
+ *
  * TODO T228961279: The maxSize template parameter should be removed, since it
  * may be overriden by the constructor.
  */
 template <typename KeyT, typename ValueT, int maxSize>
 class SimpleThreadSafeCache {
  public:
-  SimpleThreadSafeCache() : maxSize_(maxSize) {}
-  SimpleThreadSafeCache(unsigned long size) : maxSize_{size} {}
+  /*
+   * Cumulative counters of cache lookups.
+   */
+  struct Statistics {
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t evictions{0};
+  };
+
+  SimpleThreadSafeCache() : SimpleThreadSafeCache(static_cast<unsigned long>(maxSize)) {}
+  SimpleThreadSafeCache(unsigned long size)
+      : maxSize_(size),
+        shardCount_(shardCountForSize(size)),
+        shards_(std::make_unique<Shard[]>(shardCount_))
+  {
+    auto shardCapacity = std::max<size_t>(maxSize_ / shardCount_ + (maxSize_ % shardCount_ != 0 ? 1 : 0), 1);
+    for (size_t index = 0; index < shardCount_; index++) {
+      shards_[index].capacity = shardCapacity;
+    }
+  }
 
   /*
    * Returns a value from the map with a given key.
@@ -37,20 +71,22 @@ class SimpleThreadSafeCache {
    */
   ValueT get(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
   {
-    return getMapIterator(key, std::move(generator))->second->second;
+    return getOrGenerate(key, std::move(generator), [](const Node &node) { return node.entry->second; });
   }
 
   /*
    * Returns pointers to both the key and value from the map with a given key.
    * If the value wasn't found in the cache, constructs the value using given
    * generator function, stores it inside a cache and returns it.
+   * The pointers stay valid until the entry is evicted.
    * Can be called from any thread.
    */
   std::pair<const KeyT *, const ValueT *> getWithKey(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator)
       const
   {
-    auto it = getMapIterator(key, std::move(generator));
-    return std::make_pair(&it->first, &it->second->second);
+    return getOrGenerate(key, std::move(generator), [](const Node &node) {
+      return std::make_pair(&node.entry->first, &node.entry->second);
+    });
   }
 
   /*
@@ -60,47 +96,202 @@ class SimpleThreadSafeCache {
    */
   std::optional<ValueT> get(const KeyT &key) const
   {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shardForHash(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    if (auto it = map_.find(key); it != map_.end()) {
-      // Move accessed item to front of list
-      list_.splice(list_.begin(), list_, it->second);
-      return it->second->second;
+    if (auto *node = shard.find(key, hash)) {
+      shard.statistics.hits++;
+      shard.moveToFront(*node);
+      return node->entry->second;
     }
 
+    shard.statistics.misses++;
     return ValueT{};
   }
 
+  /*
+   * Returns counters accumulated over all shards.
+   * Can be called from any thread.
+   */
+  Statistics getStatistics() const
+  {
+    auto statistics = Statistics{};
+    for (size_t index = 0; index < shardCount_; index++) {
+      auto &shard = shards_[index];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      statistics.hits += shard.statistics.hits;
+      statistics.misses += shard.statistics.misses;
+      statistics.evictions += shard.statistics.evictions;
+    }
+    return statistics;
+  }
+
  private:
   using EntryT = std::pair<KeyT, ValueT>;
-  using iterator = typename std::list<EntryT>::iterator;
 
-  auto getMapIterator(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator) const
+  struct Node {
+    std::optional<EntryT> entry;
+    size_t hash{0};
+    Node *previous{nullptr};
+    Node *next{nullptr};
+  };
+
+  /*
+   * Map key referring to the key stored in a node, with a precomputed hash.
+   */
+  struct NodeKey {
+    const KeyT *key;
+    size_t hash;
+
+    bool operator==(const NodeKey &rhs) const
+    {
+      return hash == rhs.hash && *key == *rhs.key;
+    }
+  };
+
+  struct NodeKeyHash {
+    size_t operator()(const NodeKey &nodeKey) const
+    {
+      return nodeKey.hash;
+    }
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    size_t capacity{1};
+
+    // Most recently used node first.
+    Node *head{nullptr};
+    Node *tail{nullptr};
+    std::deque<Node> nodes;
+    std::unordered_map<NodeKey, Node *, NodeKeyHash> map;
+
+    // Keys which are being generated at the moment (referring to the keys
+    // owned by the generating callers).
+    std::unordered_set<NodeKey, NodeKeyHash> keysInFlight;
+    std::condition_variable keysInFlightCondition;
+
+    Statistics statistics;
+
+    Node *find(const KeyT &key, size_t hash)
+    {
+      auto it = map.find(NodeKey{.key = &key, .hash = hash});
+      return it != map.end() ? it->second : nullptr;
+    }
+
+    void unlink(Node &node)
+    {
+      (node.previous != nullptr ? node.previous->next : head) = node.next;
+      (node.next != nullptr ? node.next->previous : tail) = node.previous;
+      node.previous = nullptr;
+      node.next = nullptr;
+    }
+
+    void linkToFront(Node &node)
+    {
+      node.next = head;
+      (head != nullptr ? head->previous : tail) = &node;
+      head = &node;
+    }
+
+    void moveToFront(Node &node)
+    {
+      if (head != &node) {
+        unlink(node);
+        linkToFront(node);
+      }
+    }
+
+    Node &insert(const KeyT &key, size_t hash, ValueT &&value)
+    {
+      Node *node = nullptr;
+      if (nodes.size() < capacity) {
+        node = &nodes.emplace_back();
+      } else {
+        // Reusing the least recently used node.
+        node = tail;
+        unlink(*node);
+        map.erase(NodeKey{.key = &node->entry->first, .hash = node->hash});
+        statistics.evictions++;
+      }
+
+      node->entry.emplace(key, std::move(value));
+      node->hash = hash;
+      linkToFront(*node);
+      map.emplace(NodeKey{.key = &node->entry->first, .hash = hash}, node);
+      return *node;
+    }
+  };
+
+  static size_t shardCountForSize(size_t size)
   {
-    std::lock_guard<std::mutex> lock(mutex_);
+    // Aiming for at least 64 entries per shard.
+    size_t shardCount = 1;
+    while (shardCount < 16 && shardCount * 2 * 64 <= size) {
+      shardCount *= 2;
+    }
+    return shardCount;
+  }
+
+  Shard &shardForHash(size_t hash) const
+  {
+    // Mixing the bits so that shards and buckets inside a shard do not depend
+    // on the same bits of the hash.
+    auto mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return shards_[(mixed >> 32) % shardCount_];
+  }
+
+  auto getOrGenerate(const KeyT &key, CacheGeneratorFunction<ValueT> auto generator, auto visitor) const
+  {
+    auto hash = std::hash<KeyT>{}(key);
+    auto &shard = shardForHash(hash);
+    auto nodeKey = NodeKey{.key = &key, .hash = hash};
+
+    {
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      while (true) {
+        if (auto *node = shard.find(key, hash)) {
+          shard.statistics.hits++;
+          shard.moveToFront(*node);
+          return visitor(*node);
+        }
+
+        if (!shard.keysInFlight.contains(nodeKey)) {
+          break;
+        }
 
-    if (auto it = map_.find(key); it != map_.end()) {
-      // Move accessed item to front of list
-      list_.splice(list_.begin(), list_, it->second);
-      return it;
+        // Some other thread is generating the value; waiting for it and
+        // looking the key up again.
+        shard.keysInFlightCondition.wait(lock);
+      }
+
+      shard.statistics.misses++;
+      shard.keysInFlight.insert(nodeKey);
     }
 
-    auto value = generator();
-    // Add new value to front of list and map
-    list_.emplace_front(key, value);
-    auto [it, _] = map_.insert_or_assign(key, list_.begin());
-    if (list_.size() > maxSize_) {
-      // Evict least recently used item (back of list)
-      map_.erase(list_.back().first);
-      list_.pop_back();
+    auto finishInFlight = [&]() {
+      shard.keysInFlight.erase(nodeKey);
+      shard.keysInFlightCondition.notify_all();
+    };
+
+    auto value = std::optional<ValueT>{};
+    try {
+      value.emplace(generator());
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      finishInFlight();
+      throw;
     }
-    return it;
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    finishInFlight();
+    return visitor(shard.insert(key, hash, std::move(*value)));
   }
 
   size_t maxSize_;
-  mutable std::mutex mutex_;
-  mutable std::list<EntryT> list_;
-  mutable std::unordered_map<KeyT, iterator> map_;
+  size_t shardCount_;
+  std::unique_ptr<Shard[]> shards_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "WorkStealingThreadPool.h"
+
+#include <optional>
+
+namespace facebook::react {
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t threadCount) {
+  // One queue per worker plus a shared one for jobs pushed by threads which
+  // don't belong to the pool.
+  queues_.reserve(threadCount + 1);
+  for (size_t i = 0; i < threadCount + 1; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  threads_.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++) {
+    threads_.emplace_back([this, i]() { workerLoop(i); });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    stopping_ = true;
+  }
+  sleepCondition_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t WorkStealingThreadPool::getThreadCount() const {
+  return threads_.size();
+}
+
+void WorkStealingThreadPool::run(std::vector<Task>& tasks) {
+  if (tasks.empty()) {
+    return;
+  }
+
+  if (threads_.empty() || tasks.size() == 1) {
+    for (auto& task : tasks) {
+      task();
+    }
+    return;
+  }
+
+  Batch batch;
+  batch.remaining = tasks.size();
+
+  // Accounted before the jobs become visible so that the counter never goes
+  // below zero when a worker grabs a job right away.
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    pendingJobs_ += tasks.size();
+  }
+
+  // Spread the jobs over all queues so that workers mostly pop from their own
+  // queue and only steal when they run out of work.
+  for (auto& task : tasks) {
+    auto& queue =
+        *queues_[nextQueueIndex_.fetch_add(1, std::memory_order_relaxed) %
+                 queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.jobs.push_back({.task = &task, .batch = &batch});
+  }
+  sleepCondition_.notify_all();
+
+  // The submitting thread helps until the batch is drained. It might run jobs
+  // of other batches too, which is fine since those are independent.
+  while (batch.remaining.load(std::memory_order_acquire) != 0) {
+    if (!tryRunJob(queues_.size() - 1)) {
+      std::unique_lock<std::mutex> lock(batch.mutex);
+      batch.condition.wait(lock, [&]() {
+        return batch.remaining.load(std::memory_order_acquire) == 0;
+      });
+    }
+  }
+
+  // Waits for the last `runJob` to release the batch.
+  std::lock_guard<std::mutex> lock(batch.mutex);
+  if (batch.exception) {
+    std::rethrow_exception(batch.exception);
+  }
+}
+
+void WorkStealingThreadPool::workerLoop(size_t index) {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(sleepMutex_);
+      sleepCondition_.wait(
+          lock, [this]() { return stopping_ || pendingJobs_ != 0; });
+      if (stopping_) {
+        return;
+      }
+    }
+
+    while (tryRunJob(index)) {
+    }
+  }
+}
+
+bool WorkStealingThreadPool::tryRunJob(size_t preferredQueueIndex) {
+  auto job = std::optional<Job>{};
+
+  {
+    auto& queue = *queues_[preferredQueueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = queue.jobs.back();
+      queue.jobs.pop_back();
+    }
+  }
+
+  for (size_t offset = 1; !job && offset < queues_.size(); offset++) {
+    auto& queue = *queues_[(preferredQueueIndex + offset) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = queue.jobs.front();
+      queue.jobs.pop_front();
+    }
+  }
+
+  if (!job) {
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    pendingJobs_--;
+  }
+
+  runJob(*job);
+  return true;
+}
+
+void WorkStealingThreadPool::runJob(const Job& job) {
+  auto exception = std::exception_ptr{};
+  try {
+    (*job.task)();
+  } catch (...) {
+    exception = std::current_exception();
+  }
+
+  // The batch lives on the stack of the submitting thread, which may return
+  // as soon as `remaining` drops to zero, so the batch must not be touched
+  // after the mutex is released.
+  auto& batch = *job.batch;
+  std::lock_guard<std::mutex> lock(batch.mutex);
+  if (exception && !batch.exception) {
+    batch.exception = exception;
+  }
+  if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    batch.condition.notify_all();
+  }
+}
+
+} // namespace facebook::react
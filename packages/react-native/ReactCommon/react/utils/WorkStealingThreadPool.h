@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * A fixed-size pool of threads for fork-join style workloads.
+ * Every worker owns a queue: it takes jobs from the back of its own queue and
+ * steals from the front of the queues of other workers when its own queue is
+ * empty. The thread submitting a batch participates in running it.
+ */
+class WorkStealingThreadPool final {
+ public:
+  using Task = std::function<void()>;
+
+  /*
+   * Creates a pool with `threadCount` worker threads (in addition to the
+   * threads submitting batches).
+   */
+  explicit WorkStealingThreadPool(size_t threadCount);
+
+  /*
+   * Not copyable, not movable.
+   */
+  WorkStealingThreadPool(const WorkStealingThreadPool &) = delete;
+  WorkStealingThreadPool &operator=(const WorkStealingThreadPool &) = delete;
+
+  ~WorkStealingThreadPool();
+
+  /*
+   * Runs all given tasks, potentially concurrently, and returns once all of
+   * them have completed. If any of the tasks throws, the first exception is
+   * rethrown after all tasks have completed.
+   * Can be called from any thread, including from within a task.
+   */
+  void run(std::vector<Task> &tasks);
+
+  size_t getThreadCount() const;
+
+ private:
+  struct Batch {
+    std::atomic<size_t> remaining{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::exception_ptr exception{};
+  };
+
+  struct Job {
+    Task *task;
+    Batch *batch;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  void workerLoop(size_t index);
+  bool tryRunJob(size_t preferredQueueIndex);
+  void runJob(const Job &job);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> nextQueueIndex_{0};
+
+  std::mutex sleepMutex_;
+  std::condition_variable sleepCondition_;
+  size_t pendingJobs_{0}; // Protected by `sleepMutex_`.
+  bool stopping_{false}; // Protected by `sleepMutex_`.
+};
+
+} // namespace facebook::react
@@ -8,6 +8,13 @@
 #include <gtest/gtest.h>
 #include <react/utils/SimpleThreadSafeCache.h>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace facebook::react {
 
 TEST(EvictingCacheMapTest, BasicInsertAndGet) {
@@ -37,4 +44,74 @@ TEST(EvictingCacheMapTest, Eviction) {
   EXPECT_EQ(cache.get(3), "three");
 }
 
+TEST(EvictingCacheMapTest, Statistics) {
+  SimpleThreadSafeCache<int, std::string, 2> cache;
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(1, []() { return std::string("one"); });
+  cache.get(2, []() { return std::string("two"); });
+  cache.get(3, []() { return std::string("three"); }); // should evict key 1
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.hits, 1);
+  EXPECT_EQ(statistics.misses, 3);
+  EXPECT_EQ(statistics.evictions, 1);
+}
+
+TEST(EvictingCacheMapTest, ConcurrentGeneratorsAreDeduplicated) {
+  SimpleThreadSafeCache<int, std::string, 16> cache;
+  std::atomic<int> generatorCallCount{0};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&]() {
+      auto value = cache.get(1, [&]() {
+        generatorCallCount++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return std::string("one");
+      });
+      EXPECT_EQ(value, "one");
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(generatorCallCount, 1);
+}
+
+TEST(EvictingCacheMapTest, ThrowingGenerator) {
+  SimpleThreadSafeCache<int, std::string, 2> cache;
+  EXPECT_THROW(
+      cache.get(1, []() -> std::string { throw std::runtime_error("error"); }),
+      std::runtime_error);
+
+  // The key must not stay blocked by the failed generator.
+  EXPECT_EQ(cache.get(1, []() { return std::string("one"); }), "one");
+}
+
+TEST(EvictingCacheMapTest, ShardedCacheFromManyThreads) {
+  SimpleThreadSafeCache<int, std::string, 1024> cache;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&, i]() {
+      for (int j = 0; j < 10000; j++) {
+        auto key = (j * 7 + i) % 1500;
+        auto value =
+            cache.get(key, [key]() { return std::to_string(key); });
+        EXPECT_EQ(value, std::to_string(key));
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.hits + statistics.misses, 8 * 10000);
+  EXPECT_GT(statistics.evictions, 0);
+}
+
 } // namespace facebook::react
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/WorkStealingThreadPool.h>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace facebook::react {
+
+TEST(WorkStealingThreadPoolTest, RunsAllTasks) {
+  WorkStealingThreadPool threadPool{3};
+  std::atomic<int> sum{0};
+
+  auto tasks = std::vector<WorkStealingThreadPool::Task>{};
+  for (int i = 1; i <= 100; i++) {
+    tasks.emplace_back([&sum, i]() { sum += i; });
+  }
+  threadPool.run(tasks);
+
+  EXPECT_EQ(sum, 5050);
+}
+
+TEST(WorkStealingThreadPoolTest, RunsTasksWithoutWorkerThreads) {
+  WorkStealingThreadPool threadPool{0};
+  int count = 0;
+
+  auto tasks = std::vector<WorkStealingThreadPool::Task>{
+      [&]() { count++; }, [&]() { count++; }};
+  threadPool.run(tasks);
+
+  EXPECT_EQ(count, 2);
+}
+
+TEST(WorkStealingThreadPoolTest, SupportsNestedBatches) {
+  WorkStealingThreadPool threadPool{2};
+  std::atomic<int> count{0};
+
+  auto tasks = std::vector<WorkStealingThreadPool::Task>{};
+  for (int i = 0; i < 8; i++) {
+    tasks.emplace_back([&]() {
+      auto innerTasks = std::vector<WorkStealingThreadPool::Task>{
+          [&]() { count++; }, [&]() { count++; }};
+      threadPool.run(innerTasks);
+    });
+  }
+  threadPool.run(tasks);
+
+  EXPECT_EQ(count, 16);
+}
+
+TEST(WorkStealingThreadPoolTest, RethrowsExceptionAfterCompletingBatch) {
+  WorkStealingThreadPool threadPool{2};
+  std::atomic<int> count{0};
+
+  auto tasks = std::vector<WorkStealingThreadPool::Task>{
+      [&]() { throw std::runtime_error("task failed"); },
+      [&]() { count++; },
+      [&]() { count++; }};
+
+  EXPECT_THROW(threadPool.run(tasks), std::runtime_error);
+  EXPECT_EQ(count, 2);
+}
+
+} // namespace facebook::react
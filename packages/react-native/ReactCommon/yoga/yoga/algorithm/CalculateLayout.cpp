@@ -2348,7 +2348,8 @@ void calculateLayout(
     yoga::Node* const node,
     const float ownerWidth,
     const float ownerHeight,
-    const Direction ownerDirection) {
+    const Direction ownerDirection,
+    const LayoutTaskExecutor& taskExecutor) {
   Event::publish<Event::LayoutPassStart>(node);
   LayoutData markerData = {};
 
@@ -2412,6 +2413,15 @@ void calculateLayout(
     heightSizingMode = yoga::isUndefined(height) ? SizingMode::MaxContent
                                                  : SizingMode::StretchFit;
   }
+  if (taskExecutor) {
+    layoutIndependentSubtrees(
+        node,
+        ownerDirection,
+        taskExecutor,
+        markerData,
+        gCurrentGenerationCount.load(std::memory_order_relaxed));
+  }
+
   if (calculateLayoutInternal(
           node,
           width,
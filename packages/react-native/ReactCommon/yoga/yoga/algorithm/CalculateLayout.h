@@ -9,16 +9,20 @@
 
 #include <yoga/Yoga.h>
 #include <yoga/algorithm/FlexDirection.h>
+#include <yoga/algorithm/ParallelLayout.h>
 #include <yoga/event/event.h>
 #include <yoga/node/Node.h>
 
 namespace facebook::yoga {
 
+// When `taskExecutor` is set, independent subtrees are laid out using it
+// before the serial layout pass (see `layoutIndependentSubtrees`).
 void calculateLayout(
     yoga::Node* node,
     float ownerWidth,
     float ownerHeight,
-    Direction ownerDirection);
+    Direction ownerDirection,
+    const LayoutTaskExecutor& taskExecutor = nullptr);
 
 bool calculateLayoutInternal(
     yoga::Node* node,
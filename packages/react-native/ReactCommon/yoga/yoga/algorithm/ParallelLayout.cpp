@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <yoga/algorithm/Baseline.h>
+#include <yoga/algorithm/CalculateLayout.h>
+#include <yoga/algorithm/FlexDirection.h>
+#include <yoga/algorithm/ParallelLayout.h>
+#include <yoga/algorithm/SizingMode.h>
+#include <yoga/numeric/Comparison.h>
+
+namespace facebook::yoga {
+
+namespace {
+
+struct IndependentSubtree {
+  yoga::Node* node;
+  Direction ownerDirection;
+  float availableWidth;
+  float availableHeight;
+  uint32_t depth;
+};
+
+} // namespace
+
+static bool hasOwnerRelativeEdges(const Style& style) {
+  for (auto edge : ordinals<Edge>()) {
+    if (style.margin(edge).isPercent() || style.padding(edge).isPercent() ||
+        style.border(edge).isPercent()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// A node is the root of an independent subtree if every owner passes it the
+// same constraints during the final layout pass: its size is defined in
+// points, it cannot be flexed, stretched or clamped, and nothing in its own
+// style resolves against the size of its owner. Statically positioned nodes
+// are excluded because they do not form a containing block for their
+// absolutely positioned descendants.
+static bool isIndependentSubtreeRoot(const yoga::Node* node) {
+  const auto& style = node->style();
+  if (style.display() != Display::Flex ||
+      style.positionType() == PositionType::Static) {
+    return false;
+  }
+
+  for (auto dimension : {Dimension::Width, Dimension::Height}) {
+    if (!node->getProcessedDimension(dimension).isPoints() ||
+        style.minDimension(dimension).isDefined() ||
+        style.maxDimension(dimension).isDefined()) {
+      return false;
+    }
+  }
+
+  return style.aspectRatio().isUndefined() &&
+      (style.flexBasis().isAuto() || style.flexBasis().isUndefined()) &&
+      node->resolveFlexGrow() == 0 && node->resolveFlexShrink() == 0 &&
+      !hasOwnerRelativeEdges(style);
+}
+
+static void collectIndependentSubtrees(
+    yoga::Node* node,
+    Direction direction,
+    uint32_t depth,
+    std::vector<IndependentSubtree>& subtrees) {
+  // Children of a baseline layout are positioned against the baselines of
+  // their siblings, which are computed from whatever layout their descendants
+  // hold at that point. Laying any of these descendants out ahead of time
+  // would change the result, so the whole subtree stays serial.
+  if (node->style().alignItems() == Align::Baseline ||
+      isBaselineLayout(node)) {
+    return;
+  }
+
+  for (auto child : node->getChildren()) {
+    // Children which are not owned by `node` are cloned by the serial pass
+    // and clean subtrees are served from the cache anyway.
+    if (child->getOwner() != node || !child->isDirty() ||
+        child->style().display() != Display::Flex) {
+      continue;
+    }
+
+    child->processDimensions();
+
+    if (isIndependentSubtreeRoot(child)) {
+      const auto& style = child->style();
+      subtrees.push_back(
+          {.node = child,
+           .ownerDirection = direction,
+           .availableWidth =
+               child
+                   ->getResolvedDimension(
+                       direction, Dimension::Width, YGUndefined, YGUndefined)
+                   .unwrap() +
+               style.computeMarginForAxis(FlexDirection::Row, YGUndefined),
+           .availableHeight =
+               child
+                   ->getResolvedDimension(
+                       direction, Dimension::Height, YGUndefined, YGUndefined)
+                   .unwrap() +
+               style.computeMarginForAxis(FlexDirection::Column, YGUndefined),
+           .depth = depth + 1});
+      continue;
+    }
+
+    collectIndependentSubtrees(
+        child, child->resolveDirection(direction), depth + 1, subtrees);
+  }
+}
+
+void layoutIndependentSubtrees(
+    yoga::Node* node,
+    Direction ownerDirection,
+    const LayoutTaskExecutor& executor,
+    LayoutData& layoutMarkerData,
+    uint32_t generationCount) {
+  if (!node->isDirty() || node->style().display() != Display::Flex) {
+    return;
+  }
+
+  auto subtrees = std::vector<IndependentSubtree>{};
+  collectIndependentSubtrees(
+      node, node->resolveDirection(ownerDirection), 0, subtrees);
+
+  // A single subtree would be laid out on one thread anyway.
+  if (subtrees.size() < 2) {
+    return;
+  }
+
+  auto markerData = std::vector<LayoutData>(subtrees.size());
+  auto tasks = std::vector<LayoutTask>{};
+  tasks.reserve(subtrees.size());
+  for (size_t i = 0; i < subtrees.size(); i++) {
+    tasks.emplace_back([&subtree = subtrees[i],
+                        &layoutData = markerData[i],
+                        generationCount]() {
+      calculateLayoutInternal(
+          subtree.node,
+          subtree.availableWidth,
+          subtree.availableHeight,
+          subtree.ownerDirection,
+          SizingMode::StretchFit,
+          SizingMode::StretchFit,
+          YGUndefined,
+          YGUndefined,
+          true,
+          LayoutPassReason::kFlexLayout,
+          layoutData,
+          subtree.depth,
+          generationCount);
+    });
+  }
+
+  executor(tasks);
+
+  for (const auto& layoutData : markerData) {
+    layoutMarkerData.layouts += layoutData.layouts;
+    layoutMarkerData.measures += layoutData.measures;
+    layoutMarkerData.maxMeasureCache =
+        std::max(layoutMarkerData.maxMeasureCache, layoutData.maxMeasureCache);
+    layoutMarkerData.cachedLayouts += layoutData.cachedLayouts;
+    layoutMarkerData.cachedMeasures += layoutData.cachedMeasures;
+    layoutMarkerData.measureCallbacks += layoutData.measureCallbacks;
+    for (size_t i = 0; i < layoutData.measureCallbackReasonsCount.size();
+         i++) {
+      layoutMarkerData.measureCallbackReasonsCount[i] +=
+          layoutData.measureCallbackReasonsCount[i];
+    }
+  }
+}
+
+} // namespace facebook::yoga
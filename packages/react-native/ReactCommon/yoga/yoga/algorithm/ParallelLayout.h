@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <yoga/enums/Direction.h>
+#include <yoga/event/event.h>
+#include <yoga/node/Node.h>
+
+namespace facebook::yoga {
+
+using LayoutTask = std::function<void()>;
+
+// Runs every task of the list, potentially concurrently, and returns once all
+// of them have completed.
+using LayoutTaskExecutor = std::function<void(std::vector<LayoutTask>& tasks)>;
+
+// Lays out subtrees of `node` whose layout does not depend on their ancestors
+// (children with a definite size in points which are neither flexible nor
+// sized relative to their owner) using the given executor. The serial layout
+// pass which follows picks the results up from the layout cache, so the final
+// layout is identical to a purely serial one. Must be called with the
+// generation count of the layout pass that follows.
+//
+// Tasks access disjoint subtrees only, but measure, baseline and clone
+// callbacks of nodes in these subtrees may be invoked from the executor's
+// threads and must be thread-safe.
+void layoutIndependentSubtrees(
+    yoga::Node* node,
+    Direction ownerDirection,
+    const LayoutTaskExecutor& executor,
+    LayoutData& layoutMarkerData,
+    uint32_t generationCount);
+
+} // namespace facebook::yoga
@@ -8,6 +8,8 @@
 #include "ImageLoaderModule.h"
 #include "IImageLoader.h"
 
+#include <react/renderer/imagemanager/ImagePipeline.h>
+
 namespace facebook::react {
 
 jsi::Object ImageLoaderModule::getConstants(jsi::Runtime& rt) {
@@ -51,7 +53,19 @@ AsyncPromise<bool> ImageLoaderModule::prefetchImage(
     const std::string& uri,
     int32_t /*requestId*/) {
   auto promise = AsyncPromise<bool>(rt, jsInvoker_);
-  if (auto imageLoader = imageLoader_.lock()) {
+  if (auto imagePipeline = imagePipeline_.lock()) {
+    imagePipeline->prefetchImage(
+        ImageSource{.type = ImageSource::Type::Remote, .uri = uri},
+        {},
+        ImagePriority::Prefetch,
+        [promise, uri](const std::optional<ImageLoadError>& error) mutable {
+          if (!error.has_value()) {
+            promise.resolve(true);
+          } else {
+            promise.reject("Failed to prefetch image: " + uri);
+          }
+        });
+  } else if (auto imageLoader = imageLoader_.lock()) {
     imageLoader->loadImage(
         uri,
         [promise](
@@ -17,6 +17,7 @@
 namespace facebook::react {
 
 class IImageLoader;
+class ImagePipeline;
 
 using ImageSize = NativeImageLoaderAndroidImageSize<double, double>;
 
@@ -25,10 +26,17 @@ struct Bridging<ImageSize> : NativeImageLoaderAndroidImageSizeBridging<ImageSize
 
 class ImageLoaderModule : public NativeImageLoaderAndroidCxxSpec<ImageLoaderModule> {
  public:
+  /*
+   * Prefetches go through `imagePipeline` (if any), so that the images they
+   * load are shared with image views.
+   */
   explicit ImageLoaderModule(
       std::shared_ptr<CallInvoker> jsInvoker,
-      std::weak_ptr<IImageLoader> imageLoader = std::weak_ptr<IImageLoader>())
-      : NativeImageLoaderAndroidCxxSpec(jsInvoker), imageLoader_(std::move(imageLoader))
+      std::weak_ptr<IImageLoader> imageLoader = std::weak_ptr<IImageLoader>(),
+      std::weak_ptr<ImagePipeline> imagePipeline = std::weak_ptr<ImagePipeline>())
+      : NativeImageLoaderAndroidCxxSpec(jsInvoker),
+        imageLoader_(std::move(imageLoader)),
+        imagePipeline_(std::move(imagePipeline))
   {
   }
 
@@ -45,6 +53,7 @@ class ImageLoaderModule : public NativeImageLoaderAndroidCxxSpec<ImageLoaderModu
 
  private:
   std::weak_ptr<IImageLoader> imageLoader_;
+  std::weak_ptr<ImagePipeline> imagePipeline_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImagePipelineLoaderAdapter.h"
+#include "IImageLoader.h"
+
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+ImageLoadError makeImageLoadError(std::string message) {
+  return ImageLoadError{std::make_shared<std::string>(std::move(message))};
+}
+
+} // namespace
+
+ImagePipelineLoaderAdapter::ImagePipelineLoaderAdapter(
+    std::weak_ptr<IImageLoader> imageLoader)
+    : imageLoader_(std::move(imageLoader)) {}
+
+void ImagePipelineLoaderAdapter::loadImage(
+    const ImageSource& imageSource,
+    const ImageRequestParams& /*imageRequestParams*/,
+    ImagePriority /*priority*/,
+    OnLoad onLoad,
+    OnError onError) {
+  auto imageLoader = imageLoader_.lock();
+  if (imageLoader == nullptr) {
+    onError(makeImageLoadError("Image loader is not available."));
+    return;
+  }
+
+  imageLoader->loadImage(
+      imageSource.uri,
+      [onLoad = std::move(onLoad), onError = std::move(onError)](
+          double imageWidth, double imageHeight, const char* errorMessage) {
+        if (errorMessage != nullptr) {
+          onError(makeImageLoadError(errorMessage));
+          return;
+        }
+        // The cache is bounded by the memory the host takes for the decoded
+        // image, assuming 4 bytes per pixel.
+        onLoad(
+            LoadedImage{
+                .image = nullptr,
+                .metadata = nullptr,
+                .size =
+                    {.width = static_cast<Float>(imageWidth),
+                     .height = static_cast<Float>(imageHeight)},
+                .byteSize =
+                    static_cast<size_t>(imageWidth * imageHeight * 4)});
+      });
+}
+
+} // namespace facebook::react
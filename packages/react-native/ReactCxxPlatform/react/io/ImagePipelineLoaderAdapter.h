@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImagePipelineLoader.h>
+#include <memory>
+
+namespace facebook::react {
+
+class IImageLoader;
+
+/*
+ * Loads the images of an `ImagePipeline` with the `IImageLoader` of the host.
+ * `IImageLoader` only reports the size of loaded images, so the pipeline caches
+ * their sizes and the host keeps the decoded images. Load errors wrap the
+ * error message as `std::string`.
+ */
+class ImagePipelineLoaderAdapter : public ImagePipelineLoader {
+ public:
+  explicit ImagePipelineLoaderAdapter(std::weak_ptr<IImageLoader> imageLoader);
+
+  void loadImage(
+      const ImageSource &imageSource,
+      const ImageRequestParams &imageRequestParams,
+      ImagePriority priority,
+      OnLoad onLoad,
+      OnError onError) override;
+
+ private:
+  std::weak_ptr<IImageLoader> imageLoader_;
+};
+
+} // namespace facebook::react
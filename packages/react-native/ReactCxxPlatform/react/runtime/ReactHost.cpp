@@ -15,14 +15,17 @@
 #include <jsinspector-modern/InspectorFlags.h>
 #include <react/debug/react_native_assert.h>
 #include <react/devsupport/DevServerHelper.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/devsupport/IDevUIDelegate.h>
 #include <react/devsupport/PackagerConnection.h>
 #include <react/devsupport/inspector/Inspector.h>
 #include <react/http/IHttpClient.h>
 #include <react/http/IWebSocketClient.h>
+#include <react/io/ImagePipelineLoaderAdapter.h>
 #include <react/io/ResourceLoader.h>
 #include <react/logging/LogOnce.h>
 #include <react/renderer/componentregistry/native/NativeComponentRegistryBinding.h>
+#include <react/renderer/imagemanager/ImagePipeline.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
 #include <react/renderer/scheduler/SchedulerDelegate.h>
 #include <react/renderer/scheduler/SchedulerDelegateImpl.h>
@@ -41,6 +44,7 @@ namespace facebook::react {
 struct ReactInstanceData {
   std::shared_ptr<IMountingManager> mountingManager;
   std::shared_ptr<MessageQueueThread> messageQueueThread;
+  std::shared_ptr<MessageQueueThread> backgroundMessageQueueThread;
   std::shared_ptr<RunLoopObserverManager> runLoopObserverManager;
   std::shared_ptr<const ContextContainer> contextContainer;
   ComponentRegistryFactory componentRegistryFactory;
@@ -73,6 +77,7 @@ ReactHost::ReactHost(
   reactInstanceData_ = std::make_unique<ReactInstanceData>(ReactInstanceData{
       .mountingManager = mountingManager,
       .messageQueueThread = nullptr,
+      .backgroundMessageQueueThread = nullptr,
       .runLoopObserverManager = runLoopObserverManager,
       .contextContainer = std::move(contextContainer),
       .componentRegistryFactory = std::move(componentRegistryFactory),
@@ -112,7 +117,9 @@ void ReactHost::createReactInstance() {
   // Set up timers
   auto platformTimers = std::make_unique<PlatformTimerRegistryImpl>();
   auto* platformTimersPtr = platformTimers.get();
-  auto timerManager = std::make_shared<TimerManager>(std::move(platformTimers));
+  auto timerManager = std::make_shared<TimerManager>(
+      std::move(platformTimers),
+      ReactNativeFeatureFlags::enableCoalescedTimers());
   platformTimersPtr->setTimerManager(timerManager);
 
   auto httpClientFactory =
@@ -208,6 +215,24 @@ void ReactHost::createReactInstance() {
       RuntimeSchedulerKey,
       std::weak_ptr<RuntimeScheduler>(reactInstance_->getRuntimeScheduler()));
 
+  // Set up the image pipeline, shared by the ImageManager and the image
+  // module. Unless the host provided one, images are loaded with the image
+  // loader of the mounting manager.
+  auto imagePipeline =
+      reactInstanceData_->contextContainer
+          ->find<std::shared_ptr<ImagePipeline>>(
+              ImagePipeline::ContextContainerKey)
+          .value_or(nullptr);
+  if (imagePipeline == nullptr) {
+    if (auto imageLoader =
+            reactInstanceData_->mountingManager->getImageLoader()) {
+      imagePipeline = std::make_shared<ImagePipeline>(
+          std::make_shared<ImagePipelineLoaderAdapter>(imageLoader));
+      reactInstanceData_->contextContainer->insert(
+          ImagePipeline::ContextContainerKey, imagePipeline);
+    }
+  }
+
   // Create scheduler
   auto toolbox = SchedulerToolbox{};
   toolbox.contextContainer = reactInstanceData_->contextContainer;
@@ -223,6 +248,17 @@ void ReactHost::createReactInstance() {
         return runLoopObserverManager->createEventBeat(
             ownerBox, *runtimeScheduler);
       };
+  if (ReactNativeFeatureFlags::enableBackgroundCommits() ||
+      ReactNativeFeatureFlags::enableBackgroundDiffing()) {
+    reactInstanceData_->backgroundMessageQueueThread =
+        messageQueueThreadFactory();
+    toolbox.backgroundExecutor =
+        [backgroundMessageQueueThread =
+             reactInstanceData_->backgroundMessageQueueThread](
+            std::function<void()>&& callback) {
+          backgroundMessageQueueThread->runOnQueue(std::move(callback));
+        };
+  }
 
   schedulerDelegate_ = std::make_unique<SchedulerDelegateImpl>(
       reactInstanceData_->mountingManager);
@@ -253,7 +289,8 @@ void ReactHost::createReactInstance() {
       reactInstanceData_->logBoxSurfaceDelegate,
       httpClientFactory,
       webSocketClientFactory,
-      std::move(liveReloadCallback));
+      std::move(liveReloadCallback),
+      imagePipeline);
 
   reactInstance_->initializeRuntime(
       {
@@ -302,6 +339,10 @@ void ReactHost::destroyReactInstance() {
   surfaceManager_ = nullptr;
   scheduler_ = nullptr;
   schedulerDelegate_ = nullptr;
+  if (reactInstanceData_->backgroundMessageQueueThread) {
+    reactInstanceData_->backgroundMessageQueueThread->quitSynchronous();
+    reactInstanceData_->backgroundMessageQueueThread = nullptr;
+  }
 
   reactInstanceData_->contextContainer->erase(RuntimeSchedulerKey);
   reactInstanceData_->mountingManager->setSchedulerTaskExecutor(nullptr);
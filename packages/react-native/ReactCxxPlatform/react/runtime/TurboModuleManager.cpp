@@ -38,7 +38,8 @@ TurboModuleManager::TurboModuleManager(
     std::shared_ptr<SurfaceDelegate> logBoxSurfaceDelegate,
     HttpClientFactory httpClientFactory,
     WebSocketClientFactory webSocketClientFactory,
-    std::function<void()> liveReloadCallback)
+    std::function<void()> liveReloadCallback,
+    std::weak_ptr<ImagePipeline> imagePipeline)
     : turboModuleProviders_(std::move(turboModuleProviders)),
       jsInvoker_(std::move(jsInvoker)),
       onJsError_(std::move(onJsError)),
@@ -48,7 +49,8 @@ TurboModuleManager::TurboModuleManager(
       logBoxSurfaceDelegate_(std::move(logBoxSurfaceDelegate)),
       httpClientFactory_(std::move(httpClientFactory)),
       webSocketClientFactory_(std::move(webSocketClientFactory)),
-      liveReloadCallback_(std::move(liveReloadCallback)) {}
+      liveReloadCallback_(std::move(liveReloadCallback)),
+      imagePipeline_(std::move(imagePipeline)) {}
 
 std::shared_ptr<TurboModule> TurboModuleManager::operator()(
     const std::string& name) const {
@@ -83,7 +85,8 @@ std::shared_ptr<TurboModule> TurboModuleManager::operator()(
   } else if (name == PlatformConstantsModule::kModuleName) {
     return std::make_shared<PlatformConstantsModule>(jsInvoker_);
   } else if (name == ImageLoaderModule::kModuleName) {
-    return std::make_shared<ImageLoaderModule>(jsInvoker_);
+    return std::make_shared<ImageLoaderModule>(
+        jsInvoker_, std::weak_ptr<IImageLoader>(), imagePipeline_);
   } else if (name == SourceCodeModule::kModuleName) {
     return std::make_shared<SourceCodeModule>(jsInvoker_, devServerHelper_);
   } else if (name == WebSocketModule::kModuleName) {
@@ -17,6 +17,7 @@ namespace facebook::react {
 
 class CallInvoker;
 class DevServerHelper;
+class ImagePipeline;
 class NativeAnimatedNodesManagerProvider;
 class SurfaceDelegate;
 struct IDevUIDelegate;
@@ -33,7 +34,8 @@ class TurboModuleManager final {
       std::shared_ptr<SurfaceDelegate> logBoxSurfaceDelegate = nullptr,
       HttpClientFactory httpClientFactory = nullptr,
       WebSocketClientFactory webSocketClientFactory = nullptr,
-      std::function<void()> liveReloadCallback = nullptr);
+      std::function<void()> liveReloadCallback = nullptr,
+      std::weak_ptr<ImagePipeline> imagePipeline = std::weak_ptr<ImagePipeline>());
 
   std::shared_ptr<TurboModule> operator()(const std::string &name) const;
 
@@ -48,6 +50,7 @@ class TurboModuleManager final {
   HttpClientFactory httpClientFactory_;
   WebSocketClientFactory webSocketClientFactory_;
   std::function<void()> liveReloadCallback_;
+  std::weak_ptr<ImagePipeline> imagePipeline_;
 };
 
 } // namespace facebook::react
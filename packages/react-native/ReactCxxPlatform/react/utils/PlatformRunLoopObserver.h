@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <react/timing/primitives.h>
 #include <react/utils/RunLoopObserver.h>
 #include <functional>
 #include <utility>
@@ -33,6 +34,17 @@ class PlatformRunLoopObserver : public RunLoopObserver {
     return false;
   }
 
+  using FrameCallback = std::function<void(HighResTimeStamp frameDeadline, HighResDuration frameInterval)>;
+
+  /*
+   * Sets the callback receiving the frame timing passed to `onRender`.
+   * Must be called before the observer is enabled.
+   */
+  void setFrameCallback(FrameCallback frameCallback) noexcept
+  {
+    frameCallback_ = std::move(frameCallback);
+  }
+
   void onRender() const noexcept
   {
     if (auto owner = owner_.lock()) {
@@ -40,9 +52,21 @@ class PlatformRunLoopObserver : public RunLoopObserver {
     }
   }
 
+  void onRender(HighResTimeStamp frameDeadline, HighResDuration frameInterval) const noexcept
+  {
+    if (auto owner = owner_.lock()) {
+      if (frameCallback_) {
+        frameCallback_(frameDeadline, frameInterval);
+      }
+      activityDidChange(activities_);
+    }
+  }
+
  private:
   void startObserving() const noexcept override {}
   void stopObserving() const noexcept override {}
+
+  FrameCallback frameCallback_;
 };
 
 } // namespace facebook::react
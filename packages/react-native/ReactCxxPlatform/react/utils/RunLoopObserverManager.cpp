@@ -19,10 +19,14 @@ class EventBeatImpl : public EventBeat, public RunLoopObserver::Delegate {
  public:
   EventBeatImpl(
       std::shared_ptr<OwnerBox> ownerBox,
-      std::shared_ptr<const RunLoopObserver> uiRunLoopObserver,
+      std::shared_ptr<PlatformRunLoopObserver> uiRunLoopObserver,
       RuntimeScheduler& runtimeScheduler)
-      : EventBeat(std::move(ownerBox), runtimeScheduler),
-        uiRunLoopObserver_(std::move(uiRunLoopObserver)) {
+      : EventBeat(std::move(ownerBox), runtimeScheduler) {
+    uiRunLoopObserver->setFrameCallback(
+        [this](HighResTimeStamp frameDeadline, HighResDuration frameInterval) {
+          setFrameDeadline(frameDeadline, frameInterval);
+        });
+    uiRunLoopObserver_ = std::move(uiRunLoopObserver);
     uiRunLoopObserver_->setDelegate(this);
     uiRunLoopObserver_->enable();
   }
@@ -43,7 +47,7 @@ class EventBeatImpl : public EventBeat, public RunLoopObserver::Delegate {
 std::unique_ptr<EventBeat> RunLoopObserverManager::createEventBeat(
     std::shared_ptr<EventBeat::OwnerBox> ownerBox,
     RuntimeScheduler& runtimeScheduler) {
-  auto observer = std::make_shared<const PlatformRunLoopObserver>(
+  auto observer = std::make_shared<PlatformRunLoopObserver>(
       RunLoopObserver::Activity::BeforeWaiting, ownerBox->owner);
   observer_ = observer;
   return std::make_unique<EventBeatImpl>(
@@ -56,4 +60,12 @@ void RunLoopObserverManager::onRender() const noexcept {
   }
 }
 
+void RunLoopObserverManager::onRender(
+    HighResTimeStamp frameDeadline,
+    HighResDuration frameInterval) const noexcept {
+  if (auto observer = observer_.lock()) {
+    observer->onRender(frameDeadline, frameInterval);
+  }
+}
+
 } // namespace facebook::react
@@ -23,6 +23,13 @@ class RunLoopObserverManager : std::enable_shared_from_this<RunLoopObserverManag
 
   void onRender() const noexcept;
 
+  /*
+   * Same as `onRender()`, also reporting the deadline of the frame being
+   * rendered and the interval between frames to the event beat, which lets
+   * `RuntimeScheduler` yield before the frame is missed.
+   */
+  void onRender(HighResTimeStamp frameDeadline, HighResDuration frameInterval) const noexcept;
+
   void induce() const noexcept;
 
  private:
@@ -213,6 +213,28 @@ const definitions: FeatureFlagDefinitions = {
       },
       ossReleaseStage: 'none',
     },
+    enableBackgroundCommits: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-17',
+        description:
+          'Commits the trees completed by React (with layout, commit hooks and mounting) on the background executor of the host, instead of on the JavaScript thread.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+      ossReleaseStage: 'none',
+    },
+    enableBackgroundDiffing: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-17',
+        description:
+          'Calculates the mutations of committed trees on the background executor of the host ahead of mounting, instead of on the mounting thread.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+      ossReleaseStage: 'none',
+    },
     enableBridgelessArchitecture: {
       defaultValue: false,
       metadata: {
@@ -223,6 +245,17 @@ const definitions: FeatureFlagDefinitions = {
       },
       ossReleaseStage: 'canary',
     },
+    enableCoalescedTimers: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-17',
+        description:
+          'Keeps JS timers in a timer wheel and wakes them up with a single platform timer, instead of scheduling a platform timer for each JS timer.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+      ossReleaseStage: 'none',
+    },
     enableCppPropsIteratorSetter: {
       defaultValue: false,
       metadata: {
@@ -326,6 +359,17 @@ const definitions: FeatureFlagDefinitions = {
       },
       ossReleaseStage: 'none',
     },
+    enableFrameDeadlineScheduling: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-17',
+        description:
+          'Reports the frame timing of the host platform to the RuntimeScheduler, which then asks JavaScript tasks to yield at frame deadlines and reports tasks which miss a frame as long tasks.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+      ossReleaseStage: 'none',
+    },
     enableIOSTextBaselineOffsetPerLine: {
       defaultValue: false,
       metadata: {
@@ -496,6 +540,17 @@ const definitions: FeatureFlagDefinitions = {
       },
       ossReleaseStage: 'none',
     },
+    enablePersistentTextMeasureCache: {
+      defaultValue: false,
+      metadata: {
+        dateAdded: '2026-10-17',
+        description:
+          'Persists text measurements in a file across app launches, as a second-level cache of the TextLayoutManager.',
+        expectedReleaseValue: true,
+        purpose: 'experimentation',
+      },
+      ossReleaseStage: 'none',
+    },
     enablePreparedTextLayout: {
       defaultValue: false,
       metadata: {
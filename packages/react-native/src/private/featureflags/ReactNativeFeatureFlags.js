@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<b16ca6ca4e47b347e4f5cb8555d3308f>>
+ * @generated SignedSource<<2c6c1008b851cf816a74eebb4c90a240>>
  * @flow strict
  * @noformat
  */
@@ -66,7 +66,10 @@ export type ReactNativeFeatureFlags = $ReadOnly<{
   enableAndroidAntialiasedBorderRadiusClipping: Getter<boolean>,
   enableAndroidLinearText: Getter<boolean>,
   enableAndroidTextMeasurementOptimizations: Getter<boolean>,
+  enableBackgroundCommits: Getter<boolean>,
+  enableBackgroundDiffing: Getter<boolean>,
   enableBridgelessArchitecture: Getter<boolean>,
+  enableCoalescedTimers: Getter<boolean>,
   enableCppPropsIteratorSetter: Getter<boolean>,
   enableCustomFocusSearchOnClippedElementsAndroid: Getter<boolean>,
   enableDestroyShadowTreeRevisionAsync: Getter<boolean>,
@@ -77,6 +80,7 @@ export type ReactNativeFeatureFlags = $ReadOnly<{
   enableFabricLogs: Getter<boolean>,
   enableFabricRenderer: Getter<boolean>,
   enableFontScaleChangesUpdatingLayout: Getter<boolean>,
+  enableFrameDeadlineScheduling: Getter<boolean>,
   enableIOSTextBaselineOffsetPerLine: Getter<boolean>,
   enableIOSViewClipToPaddingBox: Getter<boolean>,
   enableImagePrefetchingAndroid: Getter<boolean>,
@@ -93,6 +97,7 @@ export type ReactNativeFeatureFlags = $ReadOnly<{
   enableModuleArgumentNSNullConversionIOS: Getter<boolean>,
   enableNativeCSSParsing: Getter<boolean>,
   enableNetworkEventReporting: Getter<boolean>,
+  enablePersistentTextMeasureCache: Getter<boolean>,
   enablePreparedTextLayout: Getter<boolean>,
   enablePropsUpdateReconciliationAndroid: Getter<boolean>,
   enableSwiftUIBasedFilters: Getter<boolean>,
@@ -287,10 +292,22 @@ export const enableAndroidLinearText: Getter<boolean> = createNativeFlagGetter('
  * Enables various optimizations throughout the path of measuring text on Android.
  */
 export const enableAndroidTextMeasurementOptimizations: Getter<boolean> = createNativeFlagGetter('enableAndroidTextMeasurementOptimizations', false);
+/**
+ * Commits the trees completed by React (with layout, commit hooks and mounting) on the background executor of the host, instead of on the JavaScript thread.
+ */
+export const enableBackgroundCommits: Getter<boolean> = createNativeFlagGetter('enableBackgroundCommits', false);
+/**
+ * Calculates the mutations of committed trees on the background executor of the host ahead of mounting, instead of on the mounting thread.
+ */
+export const enableBackgroundDiffing: Getter<boolean> = createNativeFlagGetter('enableBackgroundDiffing', false);
 /**
  * Feature flag to enable the new bridgeless architecture. Note: Enabling this will force enable the following flags: `useTurboModules` & `enableFabricRenderer`.
  */
 export const enableBridgelessArchitecture: Getter<boolean> = createNativeFlagGetter('enableBridgelessArchitecture', false);
+/**
+ * Keeps JS timers in a timer wheel and wakes them up with a single platform timer, instead of scheduling a platform timer for each JS timer.
+ */
+export const enableCoalescedTimers: Getter<boolean> = createNativeFlagGetter('enableCoalescedTimers', false);
 /**
  * Enable prop iterator setter-style construction of Props in C++ (this flag is not used in Java).
  */
@@ -331,6 +348,10 @@ export const enableFabricRenderer: Getter<boolean> = createNativeFlagGetter('ena
  * Enables font scale changes updating layout for measurable nodes.
  */
 export const enableFontScaleChangesUpdatingLayout: Getter<boolean> = createNativeFlagGetter('enableFontScaleChangesUpdatingLayout', true);
+/**
+ * Reports the frame timing of the host platform to the RuntimeScheduler, which then asks JavaScript tasks to yield at frame deadlines and reports tasks which miss a frame as long tasks.
+ */
+export const enableFrameDeadlineScheduling: Getter<boolean> = createNativeFlagGetter('enableFrameDeadlineScheduling', false);
 /**
  * Applies base offset for each line of text separately on iOS.
  */
@@ -395,6 +416,10 @@ export const enableNativeCSSParsing: Getter<boolean> = createNativeFlagGetter('e
  * Enable network event reporting hooks in each native platform through `NetworkReporter` (Web Perf APIs + CDP). This flag should be combined with `fuseboxNetworkInspectionEnabled` to enable Network CDP debugging.
  */
 export const enableNetworkEventReporting: Getter<boolean> = createNativeFlagGetter('enableNetworkEventReporting', false);
+/**
+ * Persists text measurements in a file across app launches, as a second-level cache of the TextLayoutManager.
+ */
+export const enablePersistentTextMeasureCache: Getter<boolean> = createNativeFlagGetter('enablePersistentTextMeasureCache', false);
 /**
  * Enables caching text layout artifacts for later reuse
  */
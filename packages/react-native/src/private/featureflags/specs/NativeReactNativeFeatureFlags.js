@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<c43da900298aae909ac525053b5ba848>>
+ * @generated SignedSource<<41453c91769481d59c2ce87f9ca0a94d>>
  * @flow strict
  * @noformat
  */
@@ -40,7 +40,10 @@ export interface Spec extends TurboModule {
   +enableAndroidAntialiasedBorderRadiusClipping?: () => boolean;
   +enableAndroidLinearText?: () => boolean;
   +enableAndroidTextMeasurementOptimizations?: () => boolean;
+  +enableBackgroundCommits?: () => boolean;
+  +enableBackgroundDiffing?: () => boolean;
   +enableBridgelessArchitecture?: () => boolean;
+  +enableCoalescedTimers?: () => boolean;
   +enableCppPropsIteratorSetter?: () => boolean;
   +enableCustomFocusSearchOnClippedElementsAndroid?: () => boolean;
   +enableDestroyShadowTreeRevisionAsync?: () => boolean;
@@ -51,6 +54,7 @@ export interface Spec extends TurboModule {
   +enableFabricLogs?: () => boolean;
   +enableFabricRenderer?: () => boolean;
   +enableFontScaleChangesUpdatingLayout?: () => boolean;
+  +enableFrameDeadlineScheduling?: () => boolean;
   +enableIOSTextBaselineOffsetPerLine?: () => boolean;
   +enableIOSViewClipToPaddingBox?: () => boolean;
   +enableImagePrefetchingAndroid?: () => boolean;
@@ -67,6 +71,7 @@ export interface Spec extends TurboModule {
   +enableModuleArgumentNSNullConversionIOS?: () => boolean;
   +enableNativeCSSParsing?: () => boolean;
   +enableNetworkEventReporting?: () => boolean;
+  +enablePersistentTextMeasureCache?: () => boolean;
   +enablePreparedTextLayout?: () => boolean;
   +enablePropsUpdateReconciliationAndroid?: () => boolean;
   +enableSwiftUIBasedFilters?: () => boolean;